@@ -44,6 +44,12 @@
 
 #include <bsp/default-initial-extension.h>
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+#include <rtems/clockdrv.h>
+
+#define BSP_IDLE_TASK_BODY Clock_driver_tickless_idle_body
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -23,11 +23,27 @@
 
 #define A9MPCORE_GT ((volatile a9mpcore_gt *) BSP_ARM_A9MPCORE_GT_BASE)
 
+#if CLOCK_DRIVER_USE_HIGH_RESOLUTION_EVENTS && \
+  !(defined(RTEMS_SMP) && defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR))
+#ifndef BSP_ARM_A9MPCORE_PT_BASE
+#error "High resolution events require BSP_ARM_A9MPCORE_PT_BASE"
+#endif
+
+#define A9MPCORE_CLOCK_USE_PT_EVENTS
+
+#define A9MPCORE_PT ((volatile a9mpcore_pt *) BSP_ARM_A9MPCORE_PT_BASE)
+#endif
+
 static struct timecounter a9mpcore_tc;
 
 /* This is defined in dev/clock/clockimpl.h */
 void Clock_isr(rtems_irq_hdl_param arg);
 
+#ifdef A9MPCORE_CLOCK_USE_PT_EVENTS
+/* This is defined in dev/clock/clockimpl.h */
+void Clock_event_isr(void *arg);
+#endif
+
 __attribute__ ((weak)) uint32_t a9mpcore_clock_periphclk(void)
 {
   /* default to the BSP option. */
@@ -79,6 +95,142 @@ static uint32_t a9mpcore_clock_get_timecount(struct timecounter *tc)
   return gt->cntrlower;
 }
 
+#ifdef A9MPCORE_CLOCK_USE_PT_EVENTS
+static uint32_t a9mpcore_clock_event_frequency;
+
+static void a9mpcore_clock_at_event(void)
+{
+  volatile a9mpcore_pt *pt = A9MPCORE_PT;
+
+  pt->irqst = A9MPCORE_PT_IRQST_EFLG;
+}
+
+static void a9mpcore_clock_event_handler_install(void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_interrupt_handler_install(
+    A9MPCORE_IRQ_PT,
+    "Clock Event",
+    RTEMS_INTERRUPT_UNIQUE,
+    Clock_event_isr,
+    NULL
+  );
+  if (sc != RTEMS_SUCCESSFUL) {
+    bsp_fatal(BSP_ARM_A9MPCORE_FATAL_CLOCK_EVENT_IRQ_INSTALL);
+  }
+}
+
+static void a9mpcore_clock_set_event(uint64_t expire)
+{
+  volatile a9mpcore_pt *pt = A9MPCORE_PT;
+  uint64_t now = rtems_clock_get_uptime_nanoseconds();
+  uint64_t load;
+
+  /*
+   * The private timer counts down to zero at the PERIPHCLK rate.  Events far
+   * in the future are clamped, the next event re-arms the timer.
+   */
+  if (expire > now) {
+    uint64_t delta = expire - now;
+
+    if (delta > UINT32_MAX) {
+      delta = UINT32_MAX;
+    }
+
+    load = (delta * a9mpcore_clock_event_frequency) / 1000000000;
+
+    if (load > UINT32_MAX) {
+      load = UINT32_MAX;
+    }
+  } else {
+    load = 0;
+  }
+
+  if (load == 0) {
+    load = 1;
+  }
+
+  pt->ctrl = 0;
+  pt->irqst = A9MPCORE_PT_IRQST_EFLG;
+  pt->load = (uint32_t) load;
+  pt->ctrl = A9MPCORE_PT_CTRL_IRQ_EN | A9MPCORE_PT_CTRL_TMR_EN;
+}
+
+static void a9mpcore_clock_pt_init(volatile a9mpcore_pt *pt)
+{
+  pt->ctrl = 0;
+  pt->irqst = A9MPCORE_PT_IRQST_EFLG;
+}
+#endif
+
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+static uint32_t a9mpcore_clock_interval;
+
+static uint64_t a9mpcore_clock_get_comparator(volatile a9mpcore_gt *gt)
+{
+  return ((uint64_t) gt->cmpvalupper << 32) | gt->cmpvallower;
+}
+
+static void a9mpcore_clock_set_comparator(
+  volatile a9mpcore_gt *gt,
+  uint64_t cmpval
+)
+{
+  uint32_t ctrl = gt->ctrl;
+
+  gt->ctrl = ctrl & ~A9MPCORE_GT_CTRL_COMP_EN;
+  gt->cmpvallower = (uint32_t) cmpval;
+  gt->cmpvalupper = (uint32_t) (cmpval >> 32);
+  gt->ctrl = ctrl;
+}
+
+static bool a9mpcore_clock_stop_tick(uint32_t ticks)
+{
+  volatile a9mpcore_gt *gt = A9MPCORE_GT;
+  uint64_t cmpval = a9mpcore_clock_get_comparator(gt);
+
+  /* The comparator value is the time point of the next tick */
+  if (
+    (gt->irqst & A9MPCORE_GT_IRQST_EFLG) != 0
+      || a9mpcore_clock_get_counter(gt) >= cmpval
+  ) {
+    return false;
+  }
+
+  cmpval += (uint64_t) (ticks - 1) * a9mpcore_clock_interval;
+  a9mpcore_clock_set_comparator(gt, cmpval);
+
+  return true;
+}
+
+static uint32_t a9mpcore_clock_restart_tick(void)
+{
+  volatile a9mpcore_gt *gt = A9MPCORE_GT;
+  uint64_t cmpval = a9mpcore_clock_get_comparator(gt);
+  uint64_t counter = a9mpcore_clock_get_counter(gt);
+  uint32_t remaining;
+
+  if (counter >= cmpval) {
+    return 0;
+  }
+
+  remaining = (uint32_t) ((cmpval - counter - 1) / a9mpcore_clock_interval);
+
+  if (remaining > 0) {
+    cmpval -= (uint64_t) remaining * a9mpcore_clock_interval;
+    a9mpcore_clock_set_comparator(gt, cmpval);
+  }
+
+  return remaining;
+}
+
+static void a9mpcore_clock_idle_wait(void)
+{
+  __asm__ volatile ("wfi");
+}
+#endif
+
 static void a9mpcore_clock_gt_init(
   volatile a9mpcore_gt *gt,
   uint64_t cmpval,
@@ -107,6 +259,11 @@ static void a9mpcore_clock_secondary_action(void *arg)
 
   a9mpcore_clock_gt_init(gt, init_data->cmpval, init_data->interval);
   bsp_interrupt_vector_enable(A9MPCORE_IRQ_GT);
+
+#ifdef A9MPCORE_CLOCK_USE_PT_EVENTS
+  a9mpcore_clock_pt_init(A9MPCORE_PT);
+  bsp_interrupt_vector_enable(A9MPCORE_IRQ_PT);
+#endif
 }
 #endif
 
@@ -144,6 +301,15 @@ static void a9mpcore_clock_initialize(void)
   cmpval = a9mpcore_clock_get_counter(gt);
   cmpval += interval;
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+  a9mpcore_clock_interval = interval;
+#endif
+
+#ifdef A9MPCORE_CLOCK_USE_PT_EVENTS
+  a9mpcore_clock_event_frequency = (uint32_t) periphclk;
+  a9mpcore_clock_pt_init(A9MPCORE_PT);
+#endif
+
   a9mpcore_clock_gt_init(gt, cmpval, interval);
   a9mpcore_clock_secondary_initialization(gt, cmpval, interval);
 
@@ -175,5 +341,27 @@ CPU_Counter_ticks _CPU_Counter_read(void)
 #define Clock_driver_support_install_isr(isr) \
   a9mpcore_clock_handler_install()
 
+#ifdef A9MPCORE_CLOCK_USE_PT_EVENTS
+#define Clock_driver_support_set_event(expire) \
+  a9mpcore_clock_set_event(expire)
+
+#define Clock_driver_support_at_event() \
+  a9mpcore_clock_at_event()
+
+#define Clock_driver_support_install_event_isr(isr) \
+  a9mpcore_clock_event_handler_install()
+#endif
+
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+#define Clock_driver_support_stop_tick(ticks) \
+  a9mpcore_clock_stop_tick(ticks)
+
+#define Clock_driver_support_restart_tick() \
+  a9mpcore_clock_restart_tick()
+
+#define Clock_driver_support_idle_wait() \
+  a9mpcore_clock_idle_wait()
+#endif
+
 /* Include shared source clock driver code */
 #include "../../shared/dev/clock/clockimpl.h"
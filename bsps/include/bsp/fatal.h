@@ -51,6 +51,7 @@ typedef enum {
   BSP_ARM_A9MPCORE_FATAL_CLOCK_SMP_INIT,
   BSP_ARM_ARMV7M_CPU_COUNTER_INIT,
   BSP_ARM_FATAL_GENERIC_TIMER_CLOCK_IRQ_INSTALL,
+  BSP_ARM_A9MPCORE_FATAL_CLOCK_EVENT_IRQ_INSTALL,
 
   /* LEON3 fatal codes */
   LEON3_FATAL_NO_IRQMP_CONTROLLER = BSP_FATAL_CODE_BLOCK(2),
@@ -23,6 +23,7 @@
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/timecounter.h>
 #include <rtems/score/thread.h>
+#include <rtems/score/threaddispatch.h>
 #include <rtems/score/watchdogimpl.h>
 
 #ifdef Clock_driver_nanoseconds_since_last_tick
@@ -41,6 +42,19 @@
 #error "Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE && \
+  (CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK || \
+    defined(CLOCK_DRIVER_USE_DUMMY_TIMECOUNTER))
+#error "Tickless Idle PLUS Fast Idle, n ISRs per tick, or dummy timecounter is not supported"
+#endif
+
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE && \
+  (!defined(Clock_driver_support_stop_tick) || \
+    !defined(Clock_driver_support_restart_tick) || \
+    !defined(Clock_driver_support_idle_wait))
+#error "Tickless Idle requires Clock_driver_support_stop_tick(), Clock_driver_support_restart_tick(), and Clock_driver_support_idle_wait()"
+#endif
+
 /**
  * @brief Do nothing by default.
  */
@@ -113,6 +127,201 @@ static void Clock_driver_timecounter_tick( void )
  */
 volatile uint32_t    Clock_driver_ticks;
 
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE
+/*
+ * The clock driver support of the tickless idle mode provides the following
+ * functions:
+ *
+ * bool Clock_driver_support_stop_tick(uint32_t ticks): Suppresses the clock
+ * interrupt, so that the next clock interrupt occurs the specified count of
+ * tick intervals after the previous clock interrupt.  The interrupt rate
+ * returns to one interrupt per tick afterwards.  Returns false and leaves the
+ * clock unchanged, if the next clock interrupt is already due.
+ *
+ * uint32_t Clock_driver_support_restart_tick(void): Reprograms a stopped
+ * clock, so that the next clock interrupt occurs at the next tick boundary.
+ * Returns the count of tick boundaries between the next tick boundary and the
+ * previously programmed clock interrupt.
+ *
+ * void Clock_driver_support_idle_wait(void): Waits for an interrupt.  It is
+ * called with interrupts disabled and returns if an interrupt is pending.
+ */
+
+/**
+ * @brief Count of ticks accounted for by the next clock interrupt.
+ *
+ * It is greater than one while the clock interrupt is suppressed.
+ */
+static uint32_t Clock_driver_tickless_pending = 1;
+
+/**
+ * @brief Maximum count of ticks which may be skipped.
+ *
+ * It is zero, if the tickless idle mode is not available.
+ */
+static uint32_t Clock_driver_tickless_maximum;
+
+/*
+ * Accounts for the ticks skipped up to now.  It must be called with interrupts
+ * disabled, so that the interrupt which woke up the idle thread observes the
+ * current tick count.
+ */
+static void Clock_driver_tickless_restart( void )
+{
+  uint32_t pending;
+  uint32_t elapsed;
+
+  pending = Clock_driver_tickless_pending;
+
+  if ( pending > 1 ) {
+    elapsed = pending - 1 - Clock_driver_support_restart_tick();
+    Clock_driver_tickless_pending = 1;
+
+    if ( elapsed > 0 ) {
+      _Timecounter_Tick_catch_up( elapsed );
+    }
+  }
+}
+
+static void Clock_driver_tickless_tick( void )
+{
+  uint32_t pending;
+
+  pending = Clock_driver_tickless_pending;
+  Clock_driver_tickless_pending = 1;
+
+  if ( pending > 1 ) {
+    _Timecounter_Tick_catch_up( pending - 1 );
+  }
+
+  Clock_driver_timecounter_tick();
+}
+
+static void Clock_driver_tickless_initialize( void )
+{
+#if !defined(RTEMS_SMP)
+  struct timecounter *tc = _Timecounter;
+  uint64_t us_per_tick = rtems_configuration_get_microseconds_per_tick();
+  uint64_t interval = (tc->tc_frequency * us_per_tick) / 1000000;
+  uint64_t maximum;
+
+  if ( interval == 0 ) {
+    return;
+  }
+
+  /*
+   * The timecounter must not overflow between two consecutive windups.
+   */
+  maximum = ( tc->tc_counter_mask / 2 ) / interval;
+
+  if ( maximum > UINT32_MAX ) {
+    maximum = UINT32_MAX;
+  }
+
+  Clock_driver_tickless_maximum = (uint32_t) maximum;
+#endif
+}
+
+void *Clock_driver_tickless_idle_body( uintptr_t ignored )
+{
+  (void) ignored;
+
+  while ( true ) {
+    Per_CPU_Control       *cpu_self;
+    rtems_interrupt_level  level;
+
+    /*
+     * The skipped ticks are processed by the idle thread like a clock
+     * interrupt would do it, so thread dispatching must be disabled until
+     * they are accounted for.
+     */
+    cpu_self = _Thread_Dispatch_disable();
+    rtems_interrupt_local_disable( level );
+
+    if ( Clock_driver_tickless_maximum > 1 ) {
+      ISR_lock_Context lock_context;
+      uint64_t         ticks;
+
+      _Watchdog_Per_CPU_acquire_critical( cpu_self, &lock_context );
+      ticks = _Watchdog_Ticks_until_next_expiry( cpu_self );
+      _Watchdog_Per_CPU_release_critical( cpu_self, &lock_context );
+
+      if ( ticks > Clock_driver_tickless_maximum ) {
+        ticks = Clock_driver_tickless_maximum;
+      }
+
+      if ( ticks > 1 && Clock_driver_support_stop_tick( (uint32_t) ticks ) ) {
+        Clock_driver_tickless_pending = (uint32_t) ticks;
+      }
+    }
+
+    Clock_driver_support_idle_wait();
+
+    /*
+     * Account for the elapsed ticks before the pending interrupt is serviced.
+     * In case it is not the clock interrupt, it may use the tick based
+     * services.  The watchdogs which expired in the meantime are processed
+     * here with interrupts disabled.
+     */
+    Clock_driver_tickless_restart();
+
+    rtems_interrupt_local_enable( level );
+    _Thread_Dispatch_enable( cpu_self );
+  }
+
+  return NULL;
+}
+#endif
+
+#ifdef Clock_driver_support_set_event
+/*
+ * The clock driver support of the high resolution event device provides the
+ * following functions:
+ *
+ * void Clock_driver_support_set_event(uint64_t expire): Programs the one-shot
+ * event device of the current processor, so that the next event interrupt
+ * occurs at the specified uptime in nanoseconds.  An event in the past shall
+ * occur as soon as possible.  A previously programmed event is replaced.
+ *
+ * void Clock_driver_support_install_event_isr(isr): Installs the event
+ * interrupt handler for all processors.
+ *
+ * void Clock_driver_support_at_event(void): Acknowledges the event interrupt.
+ * This function is optional.
+ */
+
+#ifndef Clock_driver_support_install_event_isr
+#error "High resolution events require Clock_driver_support_install_event_isr()"
+#endif
+
+/**
+ * @brief Do nothing by default.
+ */
+#ifndef Clock_driver_support_at_event
+  #define Clock_driver_support_at_event()
+#endif
+
+static void Clock_driver_set_event( uint64_t expire )
+{
+  Clock_driver_support_set_event( expire );
+}
+
+/**
+ * @brief This is the event interrupt handler of the high resolution event
+ * device.
+ *
+ * @param arg The interrupt handler argument.
+ */
+void Clock_event_isr( void *arg );
+void Clock_event_isr( void *arg )
+{
+  (void) arg;
+
+  Clock_driver_support_at_event();
+  _Watchdog_High_resolution_tick( _Per_CPU_Get() );
+}
+#endif
+
 #ifdef Clock_driver_support_shutdown_hardware
 #error "Clock_driver_support_shutdown_hardware() is no longer supported"
 #endif
@@ -189,7 +398,11 @@ rtems_isr Clock_isr(
       /*
        *  The driver is one ISR per clock tick.
        */
-      Clock_driver_timecounter_tick();
+      #if CLOCK_DRIVER_USE_TICKLESS_IDLE
+        Clock_driver_tickless_tick();
+      #else
+        Clock_driver_timecounter_tick();
+      #endif
     #endif
   #endif
 }
@@ -208,6 +421,10 @@ void _Clock_Initialize( void )
    */
   Clock_driver_support_install_isr( Clock_isr );
 
+  #ifdef Clock_driver_support_set_event
+    Clock_driver_support_install_event_isr( Clock_event_isr );
+  #endif
+
   #ifdef RTEMS_SMP
     Clock_driver_support_set_interrupt_affinity(
       _SMP_Get_online_processors()
@@ -225,4 +442,16 @@ void _Clock_Initialize( void )
   #if CLOCK_DRIVER_ISRS_PER_TICK
     Clock_driver_isrs = CLOCK_DRIVER_ISRS_PER_TICK_VALUE;
   #endif
+
+  #if CLOCK_DRIVER_USE_TICKLESS_IDLE
+    Clock_driver_tickless_initialize();
+  #endif
+
+  /*
+   *  The event device is programmed with respect to the uptime, so the
+   *  timecounter must be installed before the first event is set.
+   */
+  #ifdef Clock_driver_support_set_event
+    _Watchdog_High_resolution_install( Clock_driver_set_event );
+  #endif
 }
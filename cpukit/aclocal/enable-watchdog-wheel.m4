@@ -0,0 +1,9 @@
+AC_DEFUN([RTEMS_ENABLE_WATCHDOG_WHEEL],
+  [AC_ARG_ENABLE(watchdog-wheel,
+    [AS_HELP_STRING([--enable-watchdog-wheel],[use a timing wheel for the ticks based watchdogs (default=no)])],
+    [case "${enableval}" in 
+      yes) RTEMS_HAS_WATCHDOG_WHEEL=yes ;;
+      no) RTEMS_HAS_WATCHDOG_WHEEL=no ;;
+      *) AC_MSG_ERROR(bad value ${enableval} for enable watchdog-wheel option) ;;
+    esac],
+    [RTEMS_HAS_WATCHDOG_WHEEL=no])])
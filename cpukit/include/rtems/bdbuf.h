@@ -160,6 +160,13 @@ extern "C" {
  * most-resent read-ahead transfer.  The read-ahead works per disk, but all
  * transfers are issued by the read-ahead task.
  *
+ * The read-ahead window adapts to the observed sequential stream.  A new
+ * stream starts with a small window.  Each time the reader arrives at the
+ * trigger of the most recent read-ahead transfer without a miss, the window
+ * doubles up to the maximum read-ahead blocks count.  A read miss of a block
+ * inside the most recent read-ahead window indicates that the read-ahead
+ * blocks were removed from the cache before use and halves the window.
+ *
  * The cache has the following lists of buffers:
  *  - LRU: Accessed or transfered buffers released in least recently used
  *  order.  Empty buffers will be placed to the front.
@@ -174,6 +181,24 @@ extern "C" {
  * issue with this design.  The reallocation of a group may forced recently
  * accessed buffers out of the cache when they should not.  The design should be
  * change to have groups on a LRU list if they have no buffers in use.
+ *
+ * The cache may be split into partitions, see
+ * CONFIGURE_BDBUF_CACHE_PARTITIONS.  Each partition owns an equal share of the
+ * groups and has its own lock, AVL tree, lists and waiters.  A block is
+ * assigned to a partition through a hash of its device and media block
+ * number.  Runs of consecutive media blocks map to the same partition, so that
+ * multiple block transfers are possible.  Operations on blocks of different
+ * partitions do not contend for a lock and may proceed in parallel on SMP
+ * configurations.  Since a block can only use buffers of its partition, a
+ * partition may run out of buffers while other partitions have free buffers.
+ *
+ * The buffers of a partition are looked up by their device and block number
+ * through an AVL tree.  Optionally, an open addressing hash table with linear
+ * probing may be used instead, see CONFIGURE_BDBUF_HASH_INDEX.  The hash table
+ * has at least twice the number of slots than the partition has buffers.  A
+ * lookup has a constant expected time and usually touches one cache line, in
+ * contrast to the logarithmic pointer chasing of the AVL tree.  This pays off
+ * for caches with many buffers.
  */
 /**@{**/
 
@@ -383,6 +408,11 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority;     /**< Priority of the read-ahead
                                                 * task. */
+  uint32_t            partitions;              /**< Number of cache
+                                                * partitions. */
+  bool                hash_index;              /**< Use a hash table
+                                                * instead of an AVL tree to
+                                                * look up buffers. */
 } rtems_bdbuf_config;
 
 /**
@@ -455,6 +485,12 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT (4096)
 
+/**
+ * Default number of cache partitions.  There is one partition protected by
+ * one lock.
+ */
+#define RTEMS_BDBUF_CACHE_PARTITIONS_DEFAULT (1)
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
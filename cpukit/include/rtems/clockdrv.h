@@ -48,6 +48,25 @@ extern volatile uint32_t Clock_driver_ticks;
  */
 void _Clock_Initialize( void );
 
+/**
+ * @brief Idle thread body for the tickless idle mode of the clock driver.
+ *
+ * While the processor is idle, the clock interrupt is suppressed until the
+ * next tick which has to process an expired watchdog.  The skipped ticks are
+ * accounted for by the next clock interrupt or by the idle thread before an
+ * other interrupt is serviced.
+ * This idle body is available if the clock driver is built with
+ * CLOCK_DRIVER_USE_TICKLESS_IDLE enabled.  It may be used through the
+ * BSP_IDLE_TASK_BODY or CONFIGURE_IDLE_TASK_BODY configuration options.  In
+ * configurations with more than one processor, it waits for interrupts without
+ * suppressing the clock interrupt.
+ *
+ * @param ignored The idle thread argument is not used.
+ *
+ * @return This function does not return.
+ */
+void *Clock_driver_tickless_idle_body( uintptr_t ignored );
+
 /** @} */
 
 #ifdef __cplusplus
@@ -115,6 +115,21 @@
     RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT
 #endif
 
+#ifndef CONFIGURE_BDBUF_CACHE_PARTITIONS
+  #define CONFIGURE_BDBUF_CACHE_PARTITIONS \
+    RTEMS_BDBUF_CACHE_PARTITIONS_DEFAULT
+#endif
+
+#if CONFIGURE_BDBUF_CACHE_PARTITIONS < 1
+  #error "CONFIGURE_BDBUF_CACHE_PARTITIONS must be at least one"
+#endif
+
+#ifdef CONFIGURE_BDBUF_HASH_INDEX
+  #define _CONFIGURE_BDBUF_HASH_INDEX true
+#else
+  #define _CONFIGURE_BDBUF_HASH_INDEX false
+#endif
+
 #define _CONFIGURE_LIBBLOCK_TASKS \
   ( 1 + CONFIGURE_SWAPOUT_WORKER_TASKS \
     + ( CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS != 0 ) )
@@ -141,7 +156,9 @@ const rtems_bdbuf_config rtems_bdbuf_configuration = {
   CONFIGURE_BDBUF_CACHE_MEMORY_SIZE,
   CONFIGURE_BDBUF_BUFFER_MIN_SIZE,
   CONFIGURE_BDBUF_BUFFER_MAX_SIZE,
-  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
+  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY,
+  CONFIGURE_BDBUF_CACHE_PARTITIONS,
+  _CONFIGURE_BDBUF_HASH_INDEX
 };
 
 #ifdef __cplusplus
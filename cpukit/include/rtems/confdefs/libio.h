@@ -245,8 +245,13 @@ static const rtems_filesystem_operations_table IMFS_root_ops = {
 };
 
 static const IMFS_mknod_controls IMFS_root_mknod_controls = {
-  #ifdef CONFIGURE_IMFS_DISABLE_READDIR
+  #if defined(CONFIGURE_IMFS_DISABLE_READDIR) && \
+    defined(CONFIGURE_IMFS_ENABLE_DIRECTORY_HASH)
+    &IMFS_mknod_control_dir_minimal_hashed,
+  #elif defined(CONFIGURE_IMFS_DISABLE_READDIR)
     &IMFS_mknod_control_dir_minimal,
+  #elif defined(CONFIGURE_IMFS_ENABLE_DIRECTORY_HASH)
+    &IMFS_mknod_control_dir_hashed,
   #else
     &IMFS_mknod_control_dir_default,
   #endif
@@ -255,8 +260,10 @@ static const IMFS_mknod_controls IMFS_root_mknod_controls = {
   #else
     &IMFS_mknod_control_device,
   #endif
-  #ifdef CONFIGURE_IMFS_DISABLE_MKNOD_FILE
+  #if defined(CONFIGURE_IMFS_DISABLE_MKNOD_FILE)
     &IMFS_mknod_control_enosys,
+  #elif defined(CONFIGURE_IMFS_ENABLE_EXTENT_FILES)
+    &IMFS_mknod_control_extfile,
   #else
     &IMFS_mknod_control_memfile,
   #endif
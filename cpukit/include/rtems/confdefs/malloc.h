@@ -45,10 +45,17 @@
 #include <rtems/confdefs/bsp.h>
 
 #if defined(CONFIGURE_MALLOC_BSP_SUPPORTS_SBRK) \
-  || defined(CONFIGURE_MALLOC_DIRTY)
+  || defined(CONFIGURE_MALLOC_DIRTY) \
+  || defined(CONFIGURE_MALLOC_SEGREGATED_FIT) \
+  || defined(CONFIGURE_MALLOC_PER_CPU_CACHE_DEPTH)
 #include <rtems/malloc.h>
 #endif
 
+#if defined(CONFIGURE_MALLOC_SEGREGATED_FIT) \
+  || defined(CONFIGURE_MALLOC_PER_CPU_CACHE_DEPTH)
+#include <rtems/sysinit.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -63,6 +70,28 @@ rtems_malloc_dirtier_t rtems_malloc_dirty_helper =
   rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_SEGREGATED_FIT
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Enable_segregated_fit,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_LAST
+);
+#endif
+
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE_DEPTH
+  #if CONFIGURE_MALLOC_PER_CPU_CACHE_DEPTH < 1
+    #error "CONFIGURE_MALLOC_PER_CPU_CACHE_DEPTH must be at least one"
+  #endif
+
+  const uint32_t _Malloc_Cache_depth = CONFIGURE_MALLOC_PER_CPU_CACHE_DEPTH;
+
+  RTEMS_SYSINIT_ITEM(
+    _Malloc_Cache_initialize,
+    RTEMS_SYSINIT_MALLOC,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
+#endif
+
 #ifdef __cplusplus
 }
 #endif
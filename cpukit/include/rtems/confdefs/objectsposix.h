@@ -122,11 +122,17 @@ extern "C" {
     CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES
   );
 
+  /* Each POSIX message queue allocates its pending message buckets */
   #define _CONFIGURE_MEMORY_FOR_POSIX_MESSAGE_QUEUES \
-    _Configure_Memory_for_named_objects( \
-       CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES, \
-       sizeof( POSIX_Message_queue_Control ) \
-     )
+    ( _Configure_Memory_for_named_objects( \
+        CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES, \
+        sizeof( POSIX_Message_queue_Control ) \
+      ) \
+      + rtems_resource_maximum_per_allocation( \
+        CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES \
+      ) * _Configure_From_workspace( \
+        sizeof( CORE_message_queue_Pending_buckets ) \
+      ) )
 #else
   #define _CONFIGURE_MEMORY_FOR_POSIX_MESSAGE_QUEUES 0
 #endif
@@ -59,11 +59,16 @@
 extern "C" {
 #endif
 
-/* Ensure that _CONFIGURE_MAXIMUM_PROCESSORS > 1 only in SMP configurations */
-#if defined(CONFIGURE_MAXIMUM_PROCESSORS) && defined(RTEMS_SMP)
-  #define _CONFIGURE_MAXIMUM_PROCESSORS CONFIGURE_MAXIMUM_PROCESSORS
-#else
-  #define _CONFIGURE_MAXIMUM_PROCESSORS 1
+/*
+ * Ensure that _CONFIGURE_MAXIMUM_PROCESSORS > 1 only in SMP configurations.
+ * It may be already defined by <rtems/scheduler.h>.
+ */
+#ifndef _CONFIGURE_MAXIMUM_PROCESSORS
+  #if defined(CONFIGURE_MAXIMUM_PROCESSORS) && defined(RTEMS_SMP)
+    #define _CONFIGURE_MAXIMUM_PROCESSORS CONFIGURE_MAXIMUM_PROCESSORS
+  #else
+    #define _CONFIGURE_MAXIMUM_PROCESSORS 1
+  #endif
 #endif
 
 #ifdef RTEMS_SMP
@@ -74,6 +79,10 @@ extern "C" {
     _Per_CPU_Information[ _CONFIGURE_MAXIMUM_PROCESSORS ];
 #endif
 
+#ifdef RTEMS_WATCHDOG_WHEEL
+  Watchdog_Wheel _Watchdog_Wheels[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+#endif
+
 /* Interrupt stack configuration */
 
 #ifndef CONFIGURE_INTERRUPT_STACK_SIZE
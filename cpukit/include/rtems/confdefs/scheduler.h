@@ -50,6 +50,7 @@
   && !defined(CONFIGURE_SCHEDULER_PRIORITY) \
   && !defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP) \
   && !defined(CONFIGURE_SCHEDULER_PRIORITY_SMP) \
+  && !defined(CONFIGURE_SCHEDULER_PRIORITY_STEALING_SMP) \
   && !defined(CONFIGURE_SCHEDULER_SIMPLE) \
   && !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) \
   && !defined(CONFIGURE_SCHEDULER_STRONG_APA) \
@@ -119,6 +120,26 @@ extern "C" {
   #endif
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_PRIORITY_STEALING_SMP
+  #ifndef CONFIGURE_SCHEDULER_NAME
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'M', 'P', 'W', ' ' )
+  #endif
+
+  #ifndef CONFIGURE_SCHEDULER_TABLE_ENTRIES
+    #define CONFIGURE_SCHEDULER \
+      RTEMS_SCHEDULER_PRIORITY_STEALING_SMP( \
+        dflt, \
+        CONFIGURE_MAXIMUM_PRIORITY + 1 \
+      )
+
+    #define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+      RTEMS_SCHEDULER_TABLE_PRIORITY_STEALING_SMP( \
+        dflt, \
+        CONFIGURE_SCHEDULER_NAME \
+      )
+  #endif
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
   #ifndef CONFIGURE_SCHEDULER_NAME
     #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'M', 'P', 'A', ' ' )
@@ -109,6 +109,9 @@ typedef union {
   #ifdef CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
     Scheduler_priority_affinity_SMP_Node Priority_affinity_SMP;
   #endif
+  #ifdef CONFIGURE_SCHEDULER_PRIORITY_STEALING_SMP
+    Scheduler_priority_stealing_SMP_Node Priority_stealing_SMP;
+  #endif
   #ifdef CONFIGURE_SCHEDULER_STRONG_APA
     Scheduler_strong_APA_Node Strong_APA;
   #endif
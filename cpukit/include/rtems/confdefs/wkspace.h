@@ -51,6 +51,7 @@
 #include <rtems/score/coremsg.h>
 #include <rtems/score/context.h>
 #include <rtems/score/memory.h>
+#include <rtems/score/objectimpl.h>
 #include <rtems/score/stack.h>
 #include <rtems/sysinit.h>
 
@@ -155,6 +156,24 @@ const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
   #error "CONFIGURE_TASK_STACK_ALLOCATOR and CONFIGURE_TASK_STACK_DEALLOCATOR must be both defined or both undefined"
 #endif
 
+#ifdef CONFIGURE_ENABLE_OBJECT_NAME_HASH
+  /*
+   * The object name hash indices are allocated from the workspace.  Their
+   * size is not included in the workspace size estimate.
+   */
+  #if !defined(CONFIGURE_UNIFIED_WORK_AREAS) \
+    && !defined(CONFIGURE_EXECUTIVE_RAM_SIZE) \
+    && !defined(CONFIGURE_MEMORY_OVERHEAD)
+    #error "CONFIGURE_ENABLE_OBJECT_NAME_HASH requires one of CONFIGURE_UNIFIED_WORK_AREAS, CONFIGURE_EXECUTIVE_RAM_SIZE, and CONFIGURE_MEMORY_OVERHEAD"
+  #endif
+
+  RTEMS_SYSINIT_ITEM(
+    _Objects_Name_hash_Initialize,
+    RTEMS_SYSINIT_OBJECT_NAME_HASH,
+    RTEMS_SYSINIT_ORDER_MIDDLE
+  );
+#endif
+
 #ifdef CONFIGURE_DIRTY_MEMORY
   RTEMS_SYSINIT_ITEM(
     _Memory_Dirty_free_areas,
@@ -82,6 +82,29 @@ typedef struct {
    * be arbitrary.
    */
   rtems_blkdev_bnum next;
+
+  /**
+   * @brief Begin of the current read-ahead window.
+   *
+   * This is the first block of the most recent read-ahead request.
+   */
+  rtems_blkdev_bnum begin;
+
+  /**
+   * @brief End of the current read-ahead window.
+   *
+   * This is the block after the last block of the most recent read-ahead
+   * request.  The window is empty if the begin and end values are equal.
+   */
+  rtems_blkdev_bnum end;
+
+  /**
+   * @brief Current read-ahead window size in blocks.
+   *
+   * It adapts to the observed sequential stream between one and the maximum
+   * read-ahead blocks count.
+   */
+  uint32_t window;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -144,6 +167,29 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Count of blocks requested by read-ahead transfers.
+   */
+  uint32_t read_ahead_blocks;
+
+  /**
+   * @brief Read-ahead hit count.
+   *
+   * A read-ahead hit occurs in the rtems_bdbuf_read() function in case of a
+   * read hit of a block in the current read-ahead window.
+   */
+  uint32_t read_ahead_hits;
+
+  /**
+   * @brief Read-ahead miss count.
+   *
+   * A read-ahead miss occurs in the rtems_bdbuf_read() function in case of a
+   * read miss of a block in the current read-ahead window.  The block was
+   * removed from the cache before use.  Each read-ahead miss halves the
+   * read-ahead window.
+   */
+  uint32_t read_ahead_misses;
 } rtems_blkdev_stats;
 
 /**
@@ -287,6 +287,24 @@ typedef struct {
    * rtems_dosfs_create_utf8_converter().
    */
   rtems_dosfs_convert_control *converter;
+
+  /**
+   * @brief Enables the free cluster bitmap for the new file system instance.
+   *
+   * If true, then the file system keeps an in-memory bitmap of the free data
+   * clusters.  With the bitmap, cluster allocations and statvfs() do not need
+   * to read the File Allocation Table (FAT) to find free clusters.
+   *
+   * The bitmap needs one bit for each data cluster of the volume, for example
+   * 1MiB of memory for a volume with 8M clusters.  It is built by one scan of
+   * the complete FAT on the first cluster allocation or statvfs() call after
+   * the mount.  The file system instance is locked during the scan, so all
+   * other operations on the file system instance stall until the scan is
+   * done.
+   *
+   * If false, then the cluster allocations read the FAT.
+   */
+  bool free_cluster_map;
 } rtems_dosfs_mount_options;
 
 /**
@@ -141,6 +141,21 @@ IMFS_jnode_t *IMFS_node_initialize_directory(
   void *arg
 );
 
+/**
+ * @brief Initializes a directory node with a name hash index.
+ *
+ * @param[in] node The IMFS node.
+ * @param[in] arg The user provided argument pointer.  It is not used.
+ *
+ * @retval node Returns always the node passed as parameter.
+ *
+ * @see IMFS_mknod_control_dir_hashed.
+ */
+IMFS_jnode_t *IMFS_node_initialize_directory_hashed(
+  IMFS_jnode_t *node,
+  void *arg
+);
+
 /**
  * @brief Returns the node and sets the generic node context.
  *
@@ -214,6 +229,15 @@ void IMFS_node_destroy_default( IMFS_jnode_t *node );
  */
 void IMFS_do_nothing_destroy( IMFS_jnode_t *node );
 
+/**
+ * @brief Frees the name hash index of a directory and the node.
+ *
+ * @param[in] node The IMFS node.
+ *
+ * @see IMFS_mknod_control_dir_hashed.
+ */
+void IMFS_node_destroy_directory_hashed( IMFS_jnode_t *node );
+
 /**
  * @brief IMFS node control.
  */
@@ -265,10 +289,42 @@ struct IMFS_jnode_tt {
   const IMFS_node_control *control;
 };
 
+/**
+ * @brief Name hash index of a directory.
+ *
+ * The index is an open addressing hash table of the directory entries.  It is
+ * used to find an entry by name.  The chain of directory entries defines the
+ * order of the entries for readdir().
+ */
+typedef struct {
+  /**
+   * @brief The hash table, may be NULL.
+   *
+   * In case the table is NULL, the directory entries are searched linearly.
+   */
+  IMFS_jnode_t **table;
+
+  /**
+   * @brief The hash table size minus one.  The size is a power of two.
+   */
+  size_t mask;
+
+  /**
+   * @brief The count of directory entries.
+   */
+  size_t count;
+
+  /**
+   * @brief Indicates if the index is maintained for this directory.
+   */
+  bool enabled;
+} IMFS_directory_index;
+
 typedef struct {
   IMFS_jnode_t                          Node;
   rtems_chain_control                   Entries;
   rtems_filesystem_mount_table_entry_t *mt_fs;
+  IMFS_directory_index                  Index;
 } IMFS_directory_t;
 
 typedef struct {
@@ -290,6 +346,7 @@ typedef struct {
 typedef struct {
   IMFS_jnode_t Node;
   size_t       size;             /* size of file in bytes */
+  unsigned int map_count;        /* count of direct mappings */
 } IMFS_filebase_t;
 
 typedef struct {
@@ -304,6 +361,30 @@ typedef struct {
   block_p         direct;           /* pointer to file image */
 } IMFS_linearfile_t;
 
+/**
+ * @brief Contiguous memory area of an IMFS extent file.
+ */
+typedef struct {
+  size_t         offset;            /* file offset of the first byte */
+  size_t         size;              /* size of the extent in bytes */
+  unsigned char *data;              /* extent memory */
+} IMFS_extent_t;
+
+/**
+ * @brief IMFS file which stores its data in variably sized extents.
+ *
+ * The extents cover the file offsets from zero up to the capacity without
+ * gaps.  They are sorted by the file offset.
+ */
+typedef struct {
+  IMFS_filebase_t File;
+  IMFS_extent_t  *extents;          /* array of extents */
+  size_t          extent_count;     /* count of used extents */
+  size_t          extent_capacity;  /* count of allocated extent slots */
+  size_t          capacity;         /* sum of the extent sizes in bytes */
+  size_t          last;             /* index of the most recently used extent */
+} IMFS_extfile_t;
+
 /* Support copy on write for linear files */
 typedef union {
   IMFS_jnode_t      Node;
@@ -354,6 +435,29 @@ static inline IMFS_memfile_t *IMFS_iop_to_memfile( const rtems_libio_t *iop )
   return (IMFS_memfile_t *) iop->pathinfo.node_access;
 }
 
+static inline IMFS_extfile_t *IMFS_iop_to_extfile( const rtems_libio_t *iop )
+{
+  return (IMFS_extfile_t *) iop->pathinfo.node_access;
+}
+
+/**
+ * @brief Accounts for a direct mapping of the file data.
+ *
+ * The file descriptor is dedicated to the mapping, see mmap().  While the
+ * mapping exists, the file data must not be freed.  The mapping ends with the
+ * close of the file descriptor through IMFS_file_close().
+ */
+static inline void IMFS_file_map( IMFS_filebase_t *file, rtems_libio_t *iop )
+{
+  ++file->map_count;
+  iop->data0 = 1;
+}
+
+static inline bool IMFS_file_is_mapped( const IMFS_filebase_t *file )
+{
+  return file->map_count != 0;
+}
+
 static inline time_t _IMFS_get_time( void )
 {
   struct bintime now;
@@ -413,8 +517,11 @@ typedef struct {
 
 extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
+extern const IMFS_mknod_control IMFS_mknod_control_dir_hashed;
+extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal_hashed;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_extfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -529,6 +636,13 @@ extern int IMFS_stat_file(
   struct stat *buf
 );
 
+/**
+ * @brief Closes a file of the IMFS and ends a direct mapping of the file data.
+ *
+ * @see IMFS_file_map().
+ */
+extern int IMFS_file_close( rtems_libio_t *iop );
+
 /**
  * @brief IMFS evaluation node support.
  */
@@ -1037,6 +1151,22 @@ static inline void IMFS_Set_handlers( rtems_filesystem_location_info_t *loc )
   loc->handlers = node->control->handlers;
 }
 
+void IMFS_directory_index_insert(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+);
+
+void IMFS_directory_index_remove(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+);
+
+IMFS_jnode_t *IMFS_directory_index_search(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+);
+
 static inline void IMFS_add_to_directory(
   IMFS_jnode_t *dir_node,
   IMFS_jnode_t *entry_node
@@ -1046,11 +1176,22 @@ static inline void IMFS_add_to_directory(
 
   entry_node->Parent = dir_node;
   rtems_chain_append_unprotected( &dir->Entries, &entry_node->Node );
+
+  if ( dir->Index.enabled ) {
+    IMFS_directory_index_insert( dir, entry_node );
+  }
 }
 
 static inline void IMFS_remove_from_directory( IMFS_jnode_t *node )
 {
+  IMFS_directory_t *dir = (IMFS_directory_t *) node->Parent;
+
   IMFS_assert( node->Parent != NULL );
+
+  if ( dir->Index.enabled ) {
+    IMFS_directory_index_remove( dir, node );
+  }
+
   node->Parent = NULL;
   rtems_chain_extract_unprotected( &node->Node );
 }
@@ -16,6 +16,7 @@
 #define RTEMS_JFFS2_H
 
 #include <rtems/fs.h>
+#include <stdbool.h>
 #include <sys/param.h>
 #include <sys/ioccom.h>
 #include <zlib.h>
@@ -243,6 +244,107 @@ typedef void (*rtems_jffs2_trigger_garbage_collection)(
   rtems_jffs2_flash_control *self
 );
 
+/**
+ * @brief Flash bad block check operation.
+ *
+ * This operation is only used for flash devices with an out-of-band (OOB)
+ * area, see rtems_jffs2_flash_control::oob_size.
+ *
+ * @param[in, out] self The flash control.
+ * @param[in] offset The offset of the block from the flash begin in bytes.
+ * @param[out] bad Is set to true if the block is marked bad, otherwise it is
+ * set to false.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EIO An error occurred.  Please note that the value is negative.
+ * @retval other All other values are reserved and must not be used.
+ */
+typedef int (*rtems_jffs2_flash_block_is_bad)(
+  rtems_jffs2_flash_control *self,
+  uint32_t offset,
+  bool *bad
+);
+
+/**
+ * @brief Flash bad block mark operation.
+ *
+ * This operation is only used for flash devices with an out-of-band (OOB)
+ * area, see rtems_jffs2_flash_control::oob_size.
+ *
+ * @param[in, out] self The flash control.
+ * @param[in] offset The offset of the block from the flash begin in bytes.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EIO An error occurred.  Please note that the value is negative.
+ * @retval other All other values are reserved and must not be used.
+ */
+typedef int (*rtems_jffs2_flash_block_mark_bad)(
+  rtems_jffs2_flash_control *self,
+  uint32_t offset
+);
+
+/**
+ * @brief Flash out-of-band (OOB) area read operation.
+ *
+ * This operation must read from the part of the OOB area of one page which
+ * is available to the file system, e.g. not used by the ECC or the bad block
+ * marker of the flash device.
+ *
+ * @param[in, out] self The flash control.
+ * @param[in] offset The offset of the page from the flash begin in bytes.
+ * @param[out] buffer The buffer receiving the OOB data.
+ * @param[in] size_of_buffer The size of the buffer in bytes.  It is less
+ * than or equal to rtems_jffs2_flash_control::oob_size.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EIO An error occurred.  Please note that the value is negative.
+ * @retval other All other values are reserved and must not be used.
+ */
+typedef int (*rtems_jffs2_flash_oob_read)(
+  rtems_jffs2_flash_control *self,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+);
+
+/**
+ * @brief Flash out-of-band (OOB) area write operation.
+ *
+ * This operation must write to the part of the OOB area of one page which
+ * is available to the file system.
+ *
+ * @param[in, out] self The flash control.
+ * @param[in] offset The offset of the page from the flash begin in bytes.
+ * @param[in] buffer The buffer containing the OOB data to write.
+ * @param[in] size_of_buffer The size of the buffer in bytes.  It is less
+ * than or equal to rtems_jffs2_flash_control::oob_size.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EIO An error occurred.  Please note that the value is negative.
+ * @retval other All other values are reserved and must not be used.
+ */
+typedef int (*rtems_jffs2_flash_oob_write)(
+  rtems_jffs2_flash_control *self,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+);
+
+/**
+ * @brief Trigger write buffer flush operation.
+ *
+ * An optional flush thread may now flush the write buffer using the
+ * RTEMS_JFFS2_FLUSH_WRITE_BUFFER IO control, preferably after some delay to
+ * give the file system a chance to fill up the write buffer.
+ *
+ * The flush must not run in the executing context.
+ *
+ * @param[in] self The flash control.
+ */
+typedef void (*rtems_jffs2_trigger_write_buffer_flush)(
+  rtems_jffs2_flash_control *self
+);
+
 /**
  * @brief JFFS2 flash device control.
  */
@@ -298,6 +400,71 @@ struct rtems_jffs2_flash_control {
    * RTEMS_JFFS2_ON_DEMAND_GARBAGE_COLLECTION IO control to carry out the work.
    */
   rtems_jffs2_trigger_garbage_collection trigger_garbage_collection;
+
+  /**
+   * @brief The size in bytes of the minimum write unit (page) of the flash
+   * device.
+   *
+   * In case this value is zero, then the flash device may be written in
+   * arbitrary chunks, e.g. a NOR flash device.  Otherwise, all writes are
+   * collected in a write buffer of this size and issued in units of whole
+   * pages, e.g. for a NAND flash device.  The block size must be an integral
+   * multiple of the write size.  Please note that nodes can no longer be
+   * marked obsolete in place if write buffering is enabled, so the write size
+   * of a particular file system image must not change.
+   */
+  uint32_t write_size;
+
+  /**
+   * @brief The size in bytes of the out-of-band (OOB) area of a page which is
+   * available to the file system.
+   *
+   * In case this value is zero, then the clean markers are written in-band.
+   * Otherwise, the clean markers are written to the OOB area of the first
+   * page of each block and bad blocks are detected and marked with the
+   * corresponding operations.  A non-zero value requires a non-zero write
+   * size and the OOB read and write operations.
+   */
+  uint32_t oob_size;
+
+  /**
+   * @brief Flash bad block check operation.
+   *
+   * This operation is optional and the pointer may be @c NULL.
+   */
+  rtems_jffs2_flash_block_is_bad block_is_bad;
+
+  /**
+   * @brief Flash bad block mark operation.
+   *
+   * This operation is optional and the pointer may be @c NULL.
+   */
+  rtems_jffs2_flash_block_mark_bad block_mark_bad;
+
+  /**
+   * @brief Flash out-of-band (OOB) area read operation.
+   *
+   * This operation is mandatory if the OOB size is non-zero.
+   */
+  rtems_jffs2_flash_oob_read oob_read;
+
+  /**
+   * @brief Flash out-of-band (OOB) area write operation.
+   *
+   * This operation is mandatory if the OOB size is non-zero.
+   */
+  rtems_jffs2_flash_oob_write oob_write;
+
+  /**
+   * @brief Trigger write buffer flush operation.
+   *
+   * This operation is optional and may be NULL.  This operation should wake
+   * up a thread which uses the RTEMS_JFFS2_FLUSH_WRITE_BUFFER IO control to
+   * write out the write buffer.  It is called each time a write leaves data
+   * in the write buffer.  Without such a thread, the write buffer is written
+   * out if it is full, on fsync() and during unmount.
+   */
+  rtems_jffs2_trigger_write_buffer_flush trigger_write_buffer_flush;
 };
 
 typedef struct rtems_jffs2_compressor_control rtems_jffs2_compressor_control;
@@ -459,6 +626,21 @@ typedef struct {
    * The compressor is optional and this pointer may be @c NULL.
    */
   rtems_jffs2_compressor_control *compressor_control;
+
+  /**
+   * @brief Enables the erase block summary support.
+   *
+   * In case this option is enabled, then a summary node is written to the end
+   * of each erase block once it is full.  The summary node describes all
+   * nodes of the erase block.  During mount only the summary node of an erase
+   * block is read and processed, instead of the entire erase block.  Erase
+   * blocks without a valid summary node are scanned completely.  This
+   * reduces the mount time at the expense of some flash space for the
+   * summary nodes.
+   *
+   * File systems written with and without this option enabled are compatible.
+   */
+  bool enable_summary;
 } rtems_jffs2_mount_data;
 
 /**
@@ -595,6 +777,18 @@ typedef struct {
  */
 #define RTEMS_JFFS2_FORCE_GARBAGE_COLLECTION _IO('F', 3)
 
+/**
+ * @brief IO control to write out the write buffer of a JFFS2 filesystem
+ * instance.
+ *
+ * The write buffer is preferably filled up by garbage collection passes.  It
+ * is padded in case the garbage collection is not able to make progress.
+ *
+ * This operation is intended to be used by an optional flush thread.  See
+ * rtems_jffs2_flash_control::trigger_write_buffer_flush.
+ */
+#define RTEMS_JFFS2_FLUSH_WRITE_BUFFER _IO('F', 4)
+
 /** @} */
 
 #ifdef __cplusplus
@@ -989,6 +989,11 @@ typedef int (*rtems_filesystem_kqfilter_t)(
  * @retval 0 Successful operation.
  * @retval error An error occurred.  This is usually EINVAL.
  *
+ * For read-only mappings of regular files, this handler is called with a file
+ * descriptor dedicated to the mapping.  It is not opened through the open
+ * handler.  The munmap() closes it through the close handler.  A file system
+ * may use it to pin the mapped file data until the mapping is removed.
+ *
  * @see rtems_filesystem_default_mmap().
  */
 typedef int (*rtems_filesystem_mmap_t)(
@@ -48,6 +48,37 @@ void RTEMS_Malloc_Initialize(
   Heap_Initialization_or_extend_handler  extend
 );
 
+/**
+ * @brief Enables the segregated free list index of the C program heap.
+ *
+ * This function is intended to be called during system initialization, see
+ * the CONFIGURE_MALLOC_SEGREGATED_FIT application configuration option.  In
+ * case not enough memory is available for the index, the C program heap uses
+ * the first fit method.
+ *
+ * @see _Heap_Free_index_enable().
+ */
+void _Malloc_Enable_segregated_fit( void );
+
+/**
+ * @brief Initializes the per-processor caches of the C program heap.
+ *
+ * This function is intended to be called during system initialization, see
+ * the CONFIGURE_MALLOC_PER_CPU_CACHE_DEPTH application configuration option.
+ * In case not enough memory is available for the caches, the C program heap
+ * is used without them.
+ */
+void _Malloc_Cache_initialize( void );
+
+/**
+ * @brief The maximum count of objects per size class in a per-processor cache
+ * of the C program heap.
+ *
+ * This constant is defined by the application configuration via
+ * <rtems/confdefs.h>.
+ */
+extern const uint32_t _Malloc_Cache_depth;
+
 extern ptrdiff_t RTEMS_Malloc_Sbrk_amount;
 
 static inline void rtems_heap_set_sbrk_amount( ptrdiff_t sbrk_amount )
@@ -35,6 +35,7 @@ typedef struct mmap_mappings_s {
   size_t             len;   /**< The length of memory mapped */
   int                flags; /**< The mapping flags */
   POSIX_Shm_Control *shm;   /**< The shared memory object or NULL */
+  rtems_libio_t     *iop;   /**< The file descriptor of a direct mapping */
 } mmap_mapping;
 
 extern rtems_chain_control mmap_mappings;
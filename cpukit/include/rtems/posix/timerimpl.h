@@ -111,6 +111,31 @@ RTEMS_INLINE_ROUTINE Per_CPU_Control *_POSIX_Timer_Acquire_critical(
   return cpu;
 }
 
+/**
+ * @brief Returns the watchdog header of the timer.
+ *
+ * Timers of the monotonic clock use the nanoseconds based watchdog header,
+ * so that they may expire between clock ticks in case a high resolution
+ * event device is available.  All other timers use the ticks based watchdog
+ * header.
+ *
+ * @param ptimer The timer.
+ * @param cpu The processor of the timer.
+ *
+ * @return The watchdog header of the timer.
+ */
+RTEMS_INLINE_ROUTINE Watchdog_Header *_POSIX_Timer_Get_header(
+  const POSIX_Timer_Control *ptimer,
+  Per_CPU_Control           *cpu
+)
+{
+  if ( ptimer->clock_id == CLOCK_MONOTONIC ) {
+    return &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  }
+
+  return &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+}
+
 RTEMS_INLINE_ROUTINE void _POSIX_Timer_Release(
   Per_CPU_Control  *cpu,
   ISR_lock_Context *lock_context
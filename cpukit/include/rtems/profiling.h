@@ -23,6 +23,7 @@
 #ifndef _RTEMS_PROFILING_H
 #define _RTEMS_PROFILING_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <rtems/print.h>
@@ -51,7 +52,9 @@ extern "C" {
  * Profiling information includes critical timing values such as the maximum
  * time of disabled thread dispatching which is a measure for the thread
  * dispatch latency.  On SMP configurations statistics of all SMP locks in the
- * system are available.
+ * system are available.  Contention statistics of the thread queues used by
+ * objects such as mutexes, semaphores and message queues are available in all
+ * configurations, see rtems_profiling_report_contention_xml().
  *
  * Profiling information can be retrieved via rtems_profiling_iterate() and
  * reported as an XML dump via rtems_profiling_report_xml().  These functions
@@ -77,7 +80,14 @@ typedef enum {
    *
    * @see rtems_profiling_smp_lock.
    */
-  RTEMS_PROFILING_SMP_LOCK
+  RTEMS_PROFILING_SMP_LOCK,
+
+  /**
+   * @brief Type of thread queue profiling data.
+   *
+   * @see rtems_profiling_thread_queue.
+   */
+  RTEMS_PROFILING_THREAD_QUEUE
 } rtems_profiling_type;
 
 /**
@@ -265,6 +275,59 @@ typedef struct {
   uint64_t contention_counts[RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS];
 } rtems_profiling_smp_lock;
 
+/**
+ * @brief Thread queue profiling data.
+ *
+ * Thread queues are used by objects such as mutexes, semaphores, message
+ * queues and barriers to block threads.  The wait time is the time elapsed
+ * between the start of a blocking operation and the time the thread continues
+ * execution after the blocking operation.
+ */
+typedef struct {
+  /**
+   * @brief The profiling data header.
+   */
+  rtems_profiling_header header;
+
+  /**
+   * @brief The identifier of the object containing the thread queue or zero
+   * if the thread queue is not embedded in an object with identifier.
+   */
+  uint32_t id;
+
+  /**
+   * @brief The object or thread queue name.
+   */
+  const char *name;
+
+  /**
+   * @brief The identifier of the thread queue owner at the time of the
+   * maximum wait time or zero if there was no owner.
+   */
+  uint32_t max_wait_owner;
+
+  /**
+   * @brief The count of blocking operations.
+   *
+   * This value may overflow.
+   */
+  uint64_t block_count;
+
+  /**
+   * @brief The maximum wait time in nanoseconds.
+   */
+  uint64_t max_wait_time;
+
+  /**
+   * @brief Total wait time in nanoseconds.
+   *
+   * The average wait time is the total wait time divided by the block count.
+   *
+   * This value may overflow.
+   */
+  uint64_t total_wait_time;
+} rtems_profiling_thread_queue;
+
 /**
  * @brief Collection of profiling data.
  */
@@ -283,6 +346,11 @@ typedef union {
    * @brief SMP lock profiling data if indicated by the header.
    */
   rtems_profiling_smp_lock smp_lock;
+
+  /**
+   * @brief Thread queue profiling data if indicated by the header.
+   */
+  rtems_profiling_thread_queue thread_queue;
 } rtems_profiling_data;
 
 /**
@@ -326,6 +394,28 @@ int rtems_profiling_report_xml(
   const char *indentation
 );
 
+/**
+ * @brief Reports the most contended thread queues as XML.
+ *
+ * The thread queues are ranked by their total wait time in descending order.
+ *
+ * @param[in] name The name of the contention report.
+ * @param[in] printer The RTEMS printer to send the output too.
+ * @param[in] indentation_level The current indentation level.
+ * @param[in] indentation The string used for indentation.
+ * @param[in] max_count The maximum count of reported thread queues.  A value
+ *   of zero reports all thread queues.
+ *
+ * @returns As specified by printf().
+ */
+int rtems_profiling_report_contention_xml(
+  const char *name,
+  const rtems_printer *printer,
+  uint32_t indentation_level,
+  const char *indentation,
+  size_t max_count
+);
+
 /** @} */
 
 #ifdef __cplusplus
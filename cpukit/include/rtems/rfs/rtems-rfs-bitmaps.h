@@ -285,6 +285,24 @@ int rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
                                 bool*                     allocate,
                                 rtems_rfs_bitmap_bit*     bit);
 
+/**
+ * Set the clear bits directly following a bit. This extends an allocation to
+ * a run of contiguous bits. The extension stops at the first set bit or the
+ * end of the map.
+ *
+ * @param[in] control is the map control.
+ * @param[in] bit is the last bit of the run allocated so far.
+ * @param[in] count is the maximum number of bits to set.
+ * @param[out] extended will contain the number of bits set.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_bitmap_map_extend (rtems_rfs_bitmap_control* control,
+                                 rtems_rfs_bitmap_bit      bit,
+                                 size_t                    count,
+                                 size_t*                   extended);
+
 /**
  * Create a search bit map from the actual bit map.
  *
@@ -128,6 +128,26 @@ typedef struct rtems_rfs_block_map_s
    */
   rtems_rfs_block_no last_data_block;
 
+  /**
+   * The first reserved block. Reserved blocks are allocated in the block
+   * bitmaps but are not part of the map yet. Growing the map takes the blocks
+   * from the reservation first so the blocks of the map stay contiguous when
+   * other maps grow at the same time. The reservation is released when the
+   * map is closed.
+   */
+  rtems_rfs_block_no reserved;
+
+  /**
+   * The number of reserved blocks.
+   */
+  size_t reserved_count;
+
+  /**
+   * The minimum number of blocks reserved when the map grows and the
+   * reservation is empty. If 0 blocks are only reserved on request.
+   */
+  size_t reserve_window;
+
   /**
    * The block map.
    */
@@ -165,6 +185,12 @@ typedef struct rtems_rfs_block_map_s
  */
 #define rtems_rfs_block_map_size_offset(_m) ((_m)->size.offset)
 
+/**
+ * Set the minimum number of blocks reserved when the map grows.
+ */
+#define rtems_rfs_block_map_set_reserve_window(_m, _w) \
+  ((_m)->reserve_window = (_w))
+
 /**
  * Are we at the last block in the map ?
  */
@@ -314,6 +340,23 @@ int rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                               size_t                 blocks,
                               rtems_rfs_block_no*    new_block);
 
+/**
+ * Reserve contiguous blocks for the following growth of the map. Nothing is
+ * done if the map already holds a reservation. The number of blocks reserved
+ * is at least the reserve window of the map but may be less than requested if
+ * the free blocks following the first block found are not enough.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] map is a pointer to the open map.
+ * @param[in] blocks is the number of blocks the map is going to grow by.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_block_map_reserve (rtems_rfs_file_system* fs,
+                                 rtems_rfs_block_map*   map,
+                                 size_t                 blocks);
+
 /**
  * Grow the block map by the specified number of blocks.
  *
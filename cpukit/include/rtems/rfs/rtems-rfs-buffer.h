@@ -85,6 +85,29 @@ int rtems_rfs_buffer_deviceio_release (rtems_rfs_buffer* handle,
                                        bool              modified);
 #endif
 
+/**
+ * An entry of the hash table of the buffers held by the file system. The
+ * buffers attached to handles and the buffers on the release lists are in the
+ * table so a request finds a held buffer without scanning the lists.
+ */
+typedef struct _rtems_rfs_buffer_hash_entry
+{
+  /**
+   * The block number of the buffer.
+   */
+  rtems_rfs_buffer_block block;
+
+  /**
+   * The buffer or NULL if the entry is free.
+   */
+  rtems_rfs_buffer* buffer;
+
+  /**
+   * The buffer is on the release modified list.
+   */
+  bool modified;
+} rtems_rfs_buffer_hash_entry;
+
 /**
  * RFS Buffer handle.
  */
@@ -271,7 +294,8 @@ int rtems_rfs_buffer_sync (rtems_rfs_file_system* fs);
 int rtems_rfs_buffer_setblksize (rtems_rfs_file_system* fs, uint32_t size);
 
 /**
- * Release any chained buffers.
+ * Release any chained buffers. The modified buffers are released in block
+ * order so the cache can write contiguous blocks with a single transfer.
  *
  * @param[in] fs is the file system data.
  *
@@ -0,0 +1,217 @@
+/**
+ * @file
+ *
+ * @brief RTEMS File System Directory Index
+ *
+ * @ingroup rtems_rfs
+ *
+ * RTEMS File System Directory Index
+ *
+ * The directory index maps the hash of a directory entry name to the blocks of
+ * the directory holding entries with this hash. A look up in a large directory
+ * then only needs to read the blocks which may contain the name rather than
+ * all blocks of the directory. The index is held in memory and built from the
+ * directory blocks the first time a directory is searched, so the format of
+ * the directory on disk does not change.
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#if !defined (_RTEMS_RFS_DIR_INDEX_H_)
+#define _RTEMS_RFS_DIR_INDEX_H_
+
+#include <rtems/chain.h>
+
+#include <rtems/rfs/rtems-rfs-block.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+#include <rtems/rfs/rtems-rfs-inode.h>
+
+/**
+ * Directories with less blocks than this are searched block by block and are
+ * not indexed.
+ */
+#define RTEMS_RFS_DIR_INDEX_MIN_BLOCKS (4)
+
+/**
+ * The maximum number of directory indexes held by a file system. The least
+ * recently used index is released if another directory needs an index.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAX_DIRS (8)
+
+/**
+ * The end of an index chain and the start value of a search cursor.
+ */
+#define RTEMS_RFS_DIR_INDEX_END (UINT32_MAX)
+
+/**
+ * An entry of the index. There is one entry for each directory entry.
+ */
+typedef struct _rtems_rfs_dir_index_entry
+{
+  /**
+   * The hash of the directory entry name.
+   */
+  uint32_t hash;
+
+  /**
+   * The block in the directory map holding the directory entry.
+   */
+  rtems_rfs_block_no bno;
+
+  /**
+   * The next entry in the hash bucket or RTEMS_RFS_DIR_INDEX_END.
+   */
+  uint32_t next;
+} rtems_rfs_dir_index_entry;
+
+/**
+ * The index of a directory.
+ */
+typedef struct _rtems_rfs_dir_index
+{
+  /**
+   * The node on the file system list of directory indexes.
+   */
+  rtems_chain_node link;
+
+  /**
+   * The ino of the directory.
+   */
+  rtems_rfs_ino ino;
+
+  /**
+   * The hash buckets. Each bucket is the first entry of a chain or
+   * RTEMS_RFS_DIR_INDEX_END.
+   */
+  uint32_t* buckets;
+
+  /**
+   * The number of buckets minus one. The number of buckets is a power of two.
+   */
+  uint32_t bucket_mask;
+
+  /**
+   * The table of entries.
+   */
+  rtems_rfs_dir_index_entry* entries;
+
+  /**
+   * The number of entries in use.
+   */
+  uint32_t count;
+
+  /**
+   * The number of entries allocated.
+   */
+  uint32_t size;
+} rtems_rfs_dir_index;
+
+/**
+ * Get the index of a directory. The index is built if the directory has no
+ * index yet. The most recently used index is moved to the front of the list
+ * of indexes.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] dir is a pointer to the directory inode.
+ * @param[in] map is the open block map of the directory.
+ * @param[out] index will be set to the index or NULL if the directory is not
+ *              indexed. Directories are not indexed if the index is disabled,
+ *              the directory is small or there is not enough memory.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_dir_index_get (rtems_rfs_file_system*  fs,
+                             rtems_rfs_inode_handle* dir,
+                             rtems_rfs_block_map*    map,
+                             rtems_rfs_dir_index**   index);
+
+/**
+ * Return the next block which may hold an entry with the hash.
+ *
+ * @param[in] index is the directory index.
+ * @param[in] hash is the hash of the name.
+ * @param[in,out] cursor is the search position. Set it to
+ *                 RTEMS_RFS_DIR_INDEX_END to start a search.
+ * @param[out] bno will be set to the block in the directory map.
+ *
+ * @retval true A block was found.
+ * @retval false There are no more blocks.
+ */
+bool rtems_rfs_dir_index_next (const rtems_rfs_dir_index* index,
+                               uint32_t                   hash,
+                               uint32_t*                  cursor,
+                               rtems_rfs_block_no*        bno);
+
+/**
+ * Record a new directory entry in the index of the directory. Nothing is done
+ * if the directory has no index. If there is not enough memory the index of
+ * the directory is released.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] dir is the ino of the directory.
+ * @param[in] hash is the hash of the entry name.
+ * @param[in] bno is the block in the directory map holding the entry.
+ */
+void rtems_rfs_dir_index_add (rtems_rfs_file_system* fs,
+                              rtems_rfs_ino          dir,
+                              uint32_t               hash,
+                              rtems_rfs_block_no     bno);
+
+/**
+ * Remove a deleted directory entry from the index of the directory. Nothing
+ * is done if the directory has no index.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] dir is the ino of the directory.
+ * @param[in] hash is the hash of the entry name.
+ * @param[in] bno is the block in the directory map which held the entry.
+ */
+void rtems_rfs_dir_index_remove (rtems_rfs_file_system* fs,
+                                 rtems_rfs_ino          dir,
+                                 uint32_t               hash,
+                                 rtems_rfs_block_no     bno);
+
+/**
+ * Release the index of a directory. This must be done when the directory is
+ * deleted.
+ *
+ * @param[in] fs is the file system data.
+ * @param[in] dir is the ino of the directory.
+ */
+void rtems_rfs_dir_index_release (rtems_rfs_file_system* fs,
+                                  rtems_rfs_ino          dir);
+
+/**
+ * Release all directory indexes of the file system.
+ *
+ * @param[in] fs is the file system data.
+ */
+void rtems_rfs_dir_index_close (rtems_rfs_file_system* fs);
+
+#endif
@@ -49,6 +49,15 @@
  */
 #define RTEMS_RFS_VERSION_MASK INT32_C(0x00000000)
 
+/**
+ * RFS compatible feature flags. These are held in the version number bits
+ * outside the version number mask so implementations not knowing a feature
+ * ignore it.
+ */
+#define RTEMS_RFS_FEATURE_DIR_INDEX (1 << 0) /**< Index large directories by
+                                              * the entry name hash. The index
+                                              * is held in memory. */
+
 /**
  * The root inode number. Do not use 0 as this has special meaning in some
  * Unix operating systems.
@@ -84,6 +93,11 @@
  */
 #define RTEMS_RFS_FS_MAX_HELD_BUFFERS (5)
 
+/**
+ * The default number of contiguous blocks reserved for a file when it grows.
+ */
+#define RTEMS_RFS_FS_RESERVE_BLOCKS (8)
+
 /**
  * Absolute position. Make a 64bit value.
  */
@@ -109,6 +123,11 @@ typedef int64_t rtems_rfs_pos_rel;
 #define RTEMS_RFS_FS_READ_ONLY         (1 << 3) /**< Make the mount
                                                  * read-only. Currently not
                                                  * supported. */
+#define RTEMS_RFS_FS_DIR_INDEX         (1 << 4) /**< Index large directories
+                                                 * to speed up look ups. The
+                                                 * default is off unless the
+                                                 * file system was formatted
+                                                 * with the feature. */
 /**
  * RFS File System data.
  */
@@ -215,6 +234,13 @@ struct _rtems_rfs_file_system
    */
   uint32_t max_held_buffers;
 
+  /**
+   * Number of contiguous blocks reserved for a file when it grows. Files
+   * written at the same time then do not interleave their blocks. If 0 blocks
+   * are allocated one at a time.
+   */
+  uint32_t reserve_blocks;
+
   /**
    * List of buffers attached to buffer handles. Allows sharing.
    */
@@ -247,12 +273,38 @@ struct _rtems_rfs_file_system
    */
   uint32_t release_modified_count;
 
+  /**
+   * Hash table of the buffers held on the buffers, release and release
+   * modified lists. The table is allocated when the first buffer is held.
+   */
+  rtems_rfs_buffer_hash_entry* buffer_hash;
+
+  /**
+   * Number of entries of the buffer hash table. It is a power of 2.
+   */
+  uint32_t buffer_hash_size;
+
+  /**
+   * Number of entries in use in the buffer hash table.
+   */
+  uint32_t buffer_hash_count;
+
   /**
    * List of open shared file node data. The shared node data such as the inode
    * and block map allows a single file to be open more than once.
    */
   rtems_chain_control file_shares;
 
+  /**
+   * List of directory indexes. The most recently used index is first.
+   */
+  rtems_chain_control dir_indexes;
+
+  /**
+   * Number of directory indexes on the directory indexes list.
+   */
+  uint32_t dir_index_count;
+
   /**
    * Pointer to user data supplied when opening.
    */
@@ -279,6 +331,13 @@ struct _rtems_rfs_file_system
  */
 #define rtems_rfs_fs_no_local_cache(_f) ((_f)->flags & RTEMS_RFS_FS_NO_LOCAL_CACHE)
 
+/**
+ * Are large directories indexed ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_dir_index(_f) ((_f)->flags & RTEMS_RFS_FS_DIR_INDEX)
+
 /**
  * The disk device number.
  *
@@ -139,6 +139,26 @@ int rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
                                   bool                   inode,
                                   rtems_rfs_bitmap_bit*  result);
 
+/**
+ * @brief Allocate a run of contiguous blocks.
+ *
+ * The first block is allocated like a single block. The allocation is then
+ * extended with the free blocks directly following it in the same group so
+ * less than the requested number of blocks may be allocated.
+ *
+ * @param fs The file system data.
+ * @param goal The goal to seed the bitmap search.
+ * @param count The number of blocks wanted.
+ * @param result The first block allocated.
+ * @param allocated The number of contiguous blocks allocated.
+ * @retval int The error number (errno). No error if 0.
+ */
+int rtems_rfs_group_bitmap_alloc_blocks (rtems_rfs_file_system* fs,
+                                         rtems_rfs_bitmap_bit   goal,
+                                         size_t                 count,
+                                         rtems_rfs_bitmap_bit*  result,
+                                         size_t*                allocated);
+
 /**
  * @brief Free the group allocated bit.
  *
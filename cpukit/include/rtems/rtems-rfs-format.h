@@ -65,6 +65,12 @@ typedef struct _rtems_rfs_format_config
    */
   bool initialise_inodes;
 
+  /**
+   * Index large directories. The feature is recorded in the superblock and
+   * does not change the format of the directories.
+   */
+  bool dir_index;
+
   /**
    * Is the format verbose.
    */
@@ -18,6 +18,7 @@
 #define _RTEMS_RTEMS_EVENTDATA_H
 
 #include <rtems/rtems/event.h>
+#include <rtems/score/atomic.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,7 +31,17 @@ extern "C" {
  */
 
 typedef struct {
+#if defined(RTEMS_SMP)
+  /**
+   * @brief The pending events.
+   *
+   * In SMP configurations, events may be posted without the thread wait lock,
+   * see _Event_Surrender().  Use _Event_Get_pending() to get the value.
+   */
+  Atomic_Uint     pending_events;
+#else
   rtems_event_set pending_events;
+#endif
 } Event_Control;
 
 /** @} */
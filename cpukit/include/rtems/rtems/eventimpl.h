@@ -74,7 +74,79 @@ void _Event_Timeout(
 
 RTEMS_INLINE_ROUTINE void _Event_Initialize( Event_Control *event )
 {
+#if defined(RTEMS_SMP)
+  _Atomic_Init_uint( &event->pending_events, EVENT_SETS_NONE_PENDING );
+#else
   event->pending_events = EVENT_SETS_NONE_PENDING;
+#endif
+}
+
+/**
+ * @brief Returns the pending events of the event control.
+ *
+ * @param event The event control.
+ *
+ * @return The pending events.
+ */
+RTEMS_INLINE_ROUTINE rtems_event_set _Event_Get_pending(
+  const Event_Control *event
+)
+{
+#if defined(RTEMS_SMP)
+  return _Atomic_Load_uint( &event->pending_events, ATOMIC_ORDER_RELAXED );
+#else
+  return event->pending_events;
+#endif
+}
+
+/**
+ * @brief Posts the events to the pending events of the event control.
+ *
+ * In SMP configurations, this function may be called without the thread
+ * wait lock.
+ *
+ * @param event The event control.
+ * @param the_new_events The events to post.
+ */
+RTEMS_INLINE_ROUTINE void _Event_Post_pending(
+  Event_Control   *event,
+  rtems_event_set  the_new_events
+)
+{
+#if defined(RTEMS_SMP)
+  _Atomic_Fetch_or_uint(
+    &event->pending_events,
+    the_new_events,
+    ATOMIC_ORDER_RELEASE
+  );
+#else
+  event->pending_events |= the_new_events;
+#endif
+}
+
+/**
+ * @brief Clears the events from the pending events of the event control.
+ *
+ * The thread wait lock shall be acquired.  In SMP configurations, the events
+ * are cleared atomically, since other events may be posted concurrently.
+ *
+ * @param event The event control.
+ * @param the_mask The events to clear.
+ */
+RTEMS_INLINE_ROUTINE void _Event_Clear_pending(
+  Event_Control   *event,
+  rtems_event_set  the_mask
+)
+{
+#if defined(RTEMS_SMP)
+  _Atomic_Fetch_and_uint(
+    &event->pending_events,
+    ~the_mask,
+    ATOMIC_ORDER_ACQUIRE
+  );
+#else
+  event->pending_events &= ~the_mask;
+#endif
 }
 
 /**
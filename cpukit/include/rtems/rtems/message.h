@@ -207,6 +207,113 @@ rtems_status_code rtems_message_queue_receive(
   rtems_interval  timeout
 );
 
+/**
+ * @brief Reserves a message buffer of the message queue.
+ *
+ * This directive is the first part of a zero-copy send.  The message content
+ * is written directly to the reserved buffer and sent with
+ * rtems_message_queue_commit().  A reserved buffer which is not committed
+ * must be given back with rtems_message_queue_release().  A reserved buffer
+ * counts as a pending message with respect to the message queue limit.
+ *
+ * @param id The message queue ID.
+ * @param[out] buffer The reserved buffer for the message content.  It is
+ *   large enough to store maximum size messages of this message queue.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer pointer is @c NULL.
+ * @retval RTEMS_TOO_MANY No message buffer is available.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote message
+ *   queues.
+ */
+rtems_status_code rtems_message_queue_reserve(
+  rtems_id   id,
+  void     **buffer
+);
+
+/**
+ * @brief Sends a message which was written to a reserved buffer.
+ *
+ * This directive has the same behavior as rtems_message_queue_send() except
+ * that the message content is not copied if no task is waiting or the
+ * waiting task receives with rtems_message_queue_receive_borrow().  The
+ * buffer must be obtained by rtems_message_queue_reserve().  After a
+ * successful commit, the buffer must no longer be used by the caller.
+ *
+ * @param id The message queue ID.
+ * @param buffer The reserved buffer with the message content.
+ * @param size The size of the message.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer is not a message buffer of the
+ *   message queue.
+ * @retval RTEMS_INVALID_SIZE The message size is larger than the maximum
+ *   message size of the message queue.  The buffer is still reserved.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote message
+ *   queues.
+ */
+rtems_status_code rtems_message_queue_commit(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+
+/**
+ * @brief Receives a message from the message queue without a copy.
+ *
+ * This directive has the same blocking and timeout behavior as
+ * rtems_message_queue_receive().  Instead of a copy of the message content,
+ * the message buffer itself is lent to the calling task.  The content may
+ * be read and modified in place.  The buffer must be given back with
+ * rtems_message_queue_release() or sent again with
+ * rtems_message_queue_commit().  A borrowed buffer counts as a pending
+ * message with respect to the message queue limit.
+ *
+ * @param id The message queue ID.
+ * @param[out] buffer The borrowed buffer with the message content.
+ * @param[out] size The size of the message.
+ * @param option_set The option set, e.g. RTEMS_NO_WAIT or RTEMS_WAIT.
+ * @param timeout The number of ticks to wait if the RTEMS_WAIT is set.  Use
+ *   RTEMS_NO_TIMEOUT to wait indefinitely.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer pointer or the message size
+ *   pointer is @c NULL.
+ * @retval RTEMS_UNSATISFIED No message is pending and RTEMS_NO_WAIT is set.
+ * @retval RTEMS_TIMEOUT A timeout occurred and no message was received.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote message
+ *   queues.
+ */
+rtems_status_code rtems_message_queue_receive_borrow(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+
+/**
+ * @brief Gives back a reserved or borrowed message buffer.
+ *
+ * @param id The message queue ID.
+ * @param buffer The buffer obtained by rtems_message_queue_reserve() or
+ *   rtems_message_queue_receive_borrow().
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ID Invalid message queue ID.
+ * @retval RTEMS_INVALID_ADDRESS The buffer is not a message buffer of the
+ *   message queue.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT Not supported for remote message
+ *   queues.
+ */
+rtems_status_code rtems_message_queue_release(
+  rtems_id  id,
+  void     *buffer
+);
+
 /**
  *  @brief rtems_message_queue_flush
  *
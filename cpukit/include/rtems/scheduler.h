@@ -26,6 +26,19 @@
 #define SCHEDULER_CONTEXT_NAME( name ) \
   _Configuration_Scheduler_ ## name
 
+/*
+ * This file may be included before <rtems/confdefs.h>, so provide the
+ * processor maximum of the application configuration here as well, see
+ * <rtems/confdefs/percpu.h>.
+ */
+#ifndef _CONFIGURE_MAXIMUM_PROCESSORS
+  #if defined(CONFIGURE_MAXIMUM_PROCESSORS) && defined(RTEMS_SMP)
+    #define _CONFIGURE_MAXIMUM_PROCESSORS CONFIGURE_MAXIMUM_PROCESSORS
+  #else
+    #define _CONFIGURE_MAXIMUM_PROCESSORS 1
+  #endif
+#endif
+
 #if defined(RTEMS_SMP)
   #define SCHEDULER_CONTROL_IS_NON_PREEMPT_MODE_SUPPORTED( value ) \
     , value
@@ -248,16 +261,52 @@
     RTEMS_SCHEDULER_TABLE_PRIORITY_SMP( name, obj_name )
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_PRIORITY_STEALING_SMP
+  #include <rtems/score/schedulerprioritystealingsmp.h>
+
+  #define SCHEDULER_PRIORITY_STEALING_SMP_CONTEXT_NAME( name ) \
+    SCHEDULER_CONTEXT_NAME( priority_stealing_SMP_ ## name )
+
+  /*
+   * The ready queues must follow the ready chains, see
+   * _Scheduler_priority_stealing_SMP_Initialize().
+   */
+  #define RTEMS_SCHEDULER_PRIORITY_STEALING_SMP( name, prio_count ) \
+    static struct { \
+      Scheduler_priority_stealing_SMP_Context Base; \
+      Chain_Control \
+        Ready[ _CONFIGURE_MAXIMUM_PROCESSORS ][ ( prio_count ) ]; \
+      Scheduler_priority_stealing_SMP_Queue \
+        Queues[ _CONFIGURE_MAXIMUM_PROCESSORS ]; \
+    } SCHEDULER_PRIORITY_STEALING_SMP_CONTEXT_NAME( name )
+
+  #define RTEMS_SCHEDULER_TABLE_PRIORITY_STEALING_SMP( name, obj_name ) \
+    { \
+      &SCHEDULER_PRIORITY_STEALING_SMP_CONTEXT_NAME( name ).Base.Base.Base, \
+      SCHEDULER_PRIORITY_STEALING_SMP_ENTRY_POINTS, \
+      RTEMS_ARRAY_SIZE( \
+        SCHEDULER_PRIORITY_STEALING_SMP_CONTEXT_NAME( name ).Ready[ 0 ] \
+      ) - 1, \
+      ( obj_name ) \
+      SCHEDULER_CONTROL_IS_NON_PREEMPT_MODE_SUPPORTED( false ) \
+    }
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_STRONG_APA
   #include <rtems/score/schedulerstrongapa.h>
 
   #define SCHEDULER_STRONG_APA_CONTEXT_NAME( name ) \
     SCHEDULER_CONTEXT_NAME( strong_APA_ ## name )
 
+  /*
+   * The processor search states must follow the ready chains, see
+   * _Scheduler_strong_APA_Initialize().
+   */
   #define RTEMS_SCHEDULER_STRONG_APA( name, prio_count ) \
     static struct { \
       Scheduler_strong_APA_Context Base; \
       Chain_Control                Ready[ ( prio_count ) ]; \
+      Scheduler_strong_APA_CPU     CPU[ _CONFIGURE_MAXIMUM_PROCESSORS ]; \
     } SCHEDULER_STRONG_APA_CONTEXT_NAME( name )
 
   #define RTEMS_SCHEDULER_TABLE_STRONG_APA( name, obj_name ) \
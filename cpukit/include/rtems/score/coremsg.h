@@ -23,6 +23,7 @@
 
 #include <rtems/score/chain.h>
 #include <rtems/score/isrlock.h>
+#include <rtems/score/prioritybitmap.h>
 #include <rtems/score/threadq.h>
 #include <rtems/score/watchdog.h>
 
@@ -50,6 +51,32 @@ extern "C" {
  */
 #define RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  /**
+   *  @brief The count of pending message buckets.
+   *
+   *  There is one bucket for urgent messages, one bucket for each of the
+   *  POSIX message priorities 0 up to and including MQ_PRIO_MAX and one
+   *  bucket for normal messages.
+   */
+  #define CORE_MESSAGE_QUEUE_PENDING_BUCKETS 35
+
+  /**
+   *  @brief The pending message buckets of a message queue with prioritized
+   *  messages.
+   */
+  typedef struct {
+    /** This bit map indicates the non-empty pending message buckets.
+     */
+    Priority_bit_map_Control Bit_map;
+    /** These chains are the sets of pending messages of each priority
+     *  bucket.  The messages of one bucket are in FIFO order, except for
+     *  urgent messages which are in LIFO order.
+     */
+    Chain_Control            Buckets[ CORE_MESSAGE_QUEUE_PENDING_BUCKETS ];
+  } CORE_message_queue_Pending_buckets;
+#endif
+
 #if defined(RTEMS_POSIX_API)
   /**
    *  This macro is defined when an API is enabled that requires that the
@@ -155,10 +182,18 @@ struct CORE_message_queue_Control {
    *  sent via this queue.
    */
   size_t                             maximum_message_size;
-  /** This chain is the set of pending messages.  It may be ordered by
-   *  message priority or in FIFO order.
+  /** This chain is the set of pending messages if the messages are not
+   *  prioritized.  It may be in FIFO or LIFO order.
    */
   Chain_Control                      Pending_messages;
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    /** These are the pending message buckets if the messages are
+     *  prioritized, otherwise it is NULL.  The buckets are allocated only
+     *  for prioritized messages to keep the size of message queues which do
+     *  not need them small.
+     */
+    CORE_message_queue_Pending_buckets *Pending_buckets;
+  #endif
   /** This is the address of the memory allocated for message buffers.
    *  It is allocated are part of message queue initialization and freed
    *  as part of destroying it.
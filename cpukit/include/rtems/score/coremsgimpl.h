@@ -24,6 +24,7 @@
 #include <rtems/score/coremsg.h>
 #include <rtems/score/status.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/prioritybitmapimpl.h>
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/threadqimpl.h>
 
@@ -84,6 +85,9 @@ typedef int CORE_message_queue_Submit_types;
  *        that will be allowed to pend at any given time.
  * @param maximum_message_size The size of the largest message that
  *        may be sent to this message queue instance.
+ * @param prioritized If true, then the pending messages are ordered by the
+ *        message priority, otherwise only normal and urgent messages may be
+ *        submitted to this message queue instance.
  *
  * @retval true The message queue can be initialized.
  * @retval false Memory for the pending messages cannot be allocated.
@@ -92,7 +96,8 @@ bool _CORE_message_queue_Initialize(
   CORE_message_queue_Control     *the_message_queue,
   CORE_message_queue_Disciplines  discipline,
   uint32_t                        maximum_pending_messages,
-  size_t                          maximum_message_size
+  size_t                          maximum_message_size,
+  bool                            prioritized
 );
 
 /**
@@ -281,6 +286,109 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 );
 
+/**
+ * @brief Inserts a message with content into the pending messages.
+ *
+ * The message content and size must be already set.
+ *
+ * @param[in, out] the_message_queue The message queue to insert a message in.
+ * @param[in, out] the_message The message to insert in the message queue.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ */
+void _CORE_message_queue_Insert_pending_message(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  CORE_message_queue_Submit_types    submit_type
+);
+
+/**
+ * @brief Commits a message which was filled in place.
+ *
+ * The zero-copy operations _CORE_message_queue_Commit(),
+ * _CORE_message_queue_Borrow() and _CORE_message_queue_Return_message() must
+ * not be used for message queues with blocking senders.
+ *
+ * The message must be obtained by _CORE_message_queue_Allocate_message_buffer()
+ * and its content must be written directly to the message buffer.  If a
+ * thread waits to borrow a message, then the message is handed over to this
+ * thread without a copy.  If a thread waits to receive a message into its own
+ * buffer, then the content is copied and the message is freed.  Otherwise, the
+ * message is inserted into the pending messages without a copy.
+ *
+ * @param[in, out] the_message_queue The message queue to commit the message to.
+ * @param[in, out] the_message The message to commit.
+ * @param size The size of the message content in bytes.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully committed.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size was too big.  The
+ *   message is still owned by the caller.
+ */
+Status_Control _CORE_message_queue_Commit(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+);
+
+/**
+ * @brief Borrows a message from the message queue.
+ *
+ * This is the zero-copy variant of _CORE_message_queue_Seize().  The message
+ * is removed from the pending messages, however, it is not returned to the
+ * inactive messages.  The caller reads the content in place and must return
+ * the message with _CORE_message_queue_Return_message().
+ *
+ * A waiting thread indicates that it borrows a message through a NULL
+ * pointer in Wait.return_argument_second.mutable_object.  The sender stores
+ * the handed over message there.
+ *
+ * @param[in, out] the_message_queue The message queue to borrow a message from.
+ * @param executing The executing thread.
+ * @param[out] the_message_p The borrowed message.
+ * @param[out] size_p The size of the borrowed message content.
+ * @param wait Indicates whether the calling thread is willing to block if
+ *   the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully borrowed.
+ * @retval STATUS_UNSATISFIED The message queue is empty and wait is false.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Borrow(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  CORE_message_queue_Buffer_control **the_message_p,
+  size_t                             *size_p,
+  bool                                wait,
+  Thread_queue_Context               *queue_context
+);
+
+/**
+ * @brief Returns a message to the message queue.
+ *
+ * The message is either a reserved message which was not committed or a
+ * borrowed message.  If a thread waits to send a message, then its message
+ * is inserted into the returned message buffer, otherwise the message is
+ * freed.
+ *
+ * @param[in, out] the_message_queue The message queue of the message.
+ * @param[in, out] the_message The message to return.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ */
+void _CORE_message_queue_Return_message(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  Thread_queue_Context              *queue_context
+);
+
 /**
  * @brief Sends a message to the message queue.
  *
@@ -434,6 +542,44 @@ _CORE_message_queue_Allocate_message_buffer (
      _Chain_Get_unprotected( &the_message_queue->Inactive_messages );
 }
 
+/**
+ * @brief Gets the message buffer control of a message content area.
+ *
+ * @param the_message_queue The message queue to operate upon.
+ * @param buffer The begin of the content area of a message.
+ *
+ * @retval pointer The message buffer control of the content area.
+ * @retval NULL The buffer is not the content area of a message buffer of this
+ *   message queue.
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Get_message_buffer(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  uintptr_t align_mask;
+  uintptr_t buffer_size;
+  uintptr_t begin;
+  uintptr_t offset;
+
+  align_mask = sizeof( uintptr_t ) - 1;
+  buffer_size = ( ( the_message_queue->maximum_message_size + align_mask )
+    & ~align_mask ) + sizeof( CORE_message_queue_Buffer_control );
+  begin = (uintptr_t) the_message_queue->message_buffers;
+  offset = (uintptr_t) buffer - begin
+    - offsetof( CORE_message_queue_Buffer_control, Contents.buffer );
+
+  if (
+    offset % buffer_size != 0
+      || offset / buffer_size >= the_message_queue->maximum_pending_messages
+  ) {
+    return NULL;
+  }
+
+  return (CORE_message_queue_Buffer_control *) ( begin + offset );
+}
+
 /**
  * @brief Frees a message buffer to inactive message buffer chain.
  *
@@ -475,11 +621,51 @@ RTEMS_INLINE_ROUTINE int _CORE_message_queue_Get_message_priority (
   #endif
 }
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+/**
+ * @brief Gets the pending message bucket index of a submit type.
+ *
+ * Urgent messages use the first bucket and normal messages the last bucket.
+ * The POSIX message priorities MQ_PRIO_MAX down to 0 use the buckets in
+ * between.
+ * Other priorities are clamped to this range.
+ *
+ * @param submit_type The submit type of a message.
+ *
+ * @return The pending message bucket index.
+ */
+RTEMS_INLINE_ROUTINE unsigned int _CORE_message_queue_Get_bucket_index(
+  CORE_message_queue_Submit_types submit_type
+)
+{
+  if ( submit_type == CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
+    return 0;
+  }
+
+  if ( submit_type == CORE_MESSAGE_QUEUE_SEND_REQUEST ) {
+    return CORE_MESSAGE_QUEUE_PENDING_BUCKETS - 1;
+  }
+
+  if ( submit_type > 0 ) {
+    return CORE_MESSAGE_QUEUE_PENDING_BUCKETS - 2;
+  }
+
+  if ( submit_type < 3 - CORE_MESSAGE_QUEUE_PENDING_BUCKETS ) {
+    return 1;
+  }
+
+  return (unsigned int)
+    ( submit_type + CORE_MESSAGE_QUEUE_PENDING_BUCKETS - 2 );
+}
+#endif
+
 /**
  * @brief Gets first message of message queue and removes it.
  *
  * This function removes the first message from the_message_queue
- * and returns a pointer to it.
+ * and returns a pointer to it.  For prioritized messages, the first
+ * message is taken from the highest priority non-empty bucket which is
+ * determined through the pending bit map in constant time.
  *
  * @param[in, out] the_message_queue The message queue to get the first message from.
  *
@@ -491,6 +677,37 @@ RTEMS_INLINE_ROUTINE
   CORE_message_queue_Control *the_message_queue
 )
 {
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    CORE_message_queue_Pending_buckets *pending_buckets;
+    Priority_bit_map_Information        bit_map_info;
+    unsigned int                        index;
+    Chain_Control                      *bucket;
+    Chain_Node                         *the_node;
+
+    pending_buckets = the_message_queue->Pending_buckets;
+
+    if ( pending_buckets != NULL ) {
+      if ( _Priority_bit_map_Is_empty( &pending_buckets->Bit_map ) ) {
+        return NULL;
+      }
+
+      index = _Priority_bit_map_Get_highest( &pending_buckets->Bit_map );
+      bucket = &pending_buckets->Buckets[ index ];
+      the_node = _Chain_Get_first_unprotected( bucket );
+
+      if ( _Chain_Is_empty( bucket ) ) {
+        _Priority_bit_map_Initialize_information(
+          &pending_buckets->Bit_map,
+          &bit_map_info,
+          index
+        );
+        _Priority_bit_map_Remove( &pending_buckets->Bit_map, &bit_map_info );
+      }
+
+      return (CORE_message_queue_Buffer_control *) the_node;
+    }
+  #endif
+
   return (CORE_message_queue_Buffer_control *)
     _Chain_Get_unprotected( &the_message_queue->Pending_messages );
 }
@@ -587,15 +804,40 @@ RTEMS_INLINE_ROUTINE Thread_Control *_CORE_message_queue_Dequeue_receiver(
     return NULL;
   }
 
+  if ( the_thread->Wait.return_argument_second.mutable_object == NULL ) {
+    CORE_message_queue_Buffer_control *the_message;
+
+    /*
+     *  The thread waits to borrow a message, see
+     *  _CORE_message_queue_Borrow().  Hand over a message buffer.
+     */
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message == NULL ) {
+      return NULL;
+    }
+
+    the_message->Contents.size = size;
+    #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+      the_message->priority = submit_type;
+    #endif
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_message->Contents.buffer,
+      size
+    );
+    the_thread->Wait.return_argument_second.mutable_object = the_message;
+  } else {
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+  }
+
    *(size_t *) the_thread->Wait.return_argument = size;
    the_thread->Wait.count = (uint32_t) submit_type;
 
-  _CORE_message_queue_Copy_buffer(
-    buffer,
-    the_thread->Wait.return_argument_second.mutable_object,
-    size
-  );
-
   _Thread_queue_Extract_critical(
     &the_message_queue->Wait_queue.Queue,
     the_message_queue->operations,
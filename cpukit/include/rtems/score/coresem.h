@@ -23,6 +23,7 @@
 #ifndef _RTEMS_SCORE_CORESEM_H
 #define _RTEMS_SCORE_CORESEM_H
 
+#include <rtems/score/atomic.h>
 #include <rtems/score/threadq.h>
 
 #ifdef __cplusplus
@@ -51,8 +52,17 @@ typedef struct {
    */
   Thread_queue_Control        Wait_queue;
 
-  /** This element contains the current count of this semaphore. */
+  /**
+   * This element contains the current count of this semaphore.
+   *
+   * In SMP configurations, units may be surrendered without the thread queue
+   * lock, see _CORE_semaphore_Surrender().
+   */
+#if defined(RTEMS_SMP)
+  Atomic_Uint                 count;
+#else
   uint32_t                    count;
+#endif
 }   CORE_semaphore_Control;
 
 /** @} */
@@ -112,6 +112,109 @@ RTEMS_INLINE_ROUTINE void _CORE_semaphore_Destroy(
   _Thread_queue_Destroy( &the_semaphore->Wait_queue );
 }
 
+/**
+ * @brief Adds a unit to the count of the semaphore if the maximum count is
+ * not reached.
+ *
+ * In SMP configurations, this function may run concurrently with
+ * _CORE_semaphore_Try_surrender_lock_free().
+ *
+ * @param[in, out] the_semaphore The semaphore.
+ * @param maximum_count The maximum number of units in the semaphore.
+ *
+ * @retval STATUS_SUCCESSFUL The unit was added to the count.
+ * @retval STATUS_MAXIMUM_COUNT_EXCEEDED The maximum number of units was exceeded.
+ */
+RTEMS_INLINE_ROUTINE Status_Control _CORE_semaphore_Increment(
+  CORE_semaphore_Control *the_semaphore,
+  uint32_t                maximum_count
+)
+{
+#if defined(RTEMS_SMP)
+  unsigned int count;
+
+  count = _Atomic_Load_uint( &the_semaphore->count, ATOMIC_ORDER_RELAXED );
+
+  do {
+    if ( count >= maximum_count ) {
+      return STATUS_MAXIMUM_COUNT_EXCEEDED;
+    }
+  } while (
+    !_Atomic_Compare_exchange_uint(
+      &the_semaphore->count,
+      &count,
+      count + 1,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  return STATUS_SUCCESSFUL;
+#else
+  if ( the_semaphore->count < maximum_count ) {
+    the_semaphore->count += 1;
+    return STATUS_SUCCESSFUL;
+  }
+
+  return STATUS_MAXIMUM_COUNT_EXCEEDED;
+#endif
+}
+
+#if defined(RTEMS_SMP)
+/**
+ * @brief Tries to surrender a unit to the semaphore without the thread queue
+ * lock.
+ *
+ * Threads wait for a unit only while the count is zero and the count changes
+ * from zero only while the thread queue lock is acquired.  A positive count
+ * thus shows that no thread waits and the unit can be added atomically
+ * without the lock.  This avoids lock contention if, for example, interrupt
+ * service routines on several processors release the semaphore of a busy
+ * worker thread.
+ *
+ * @param[in, out] the_semaphore The semaphore.
+ * @param maximum_count The maximum number of units in the semaphore.
+ * @param[out] status The status of the surrender operation in case it was
+ *   done.
+ *
+ * @retval true The surrender operation was done.
+ * @retval false The count is zero, so the surrender operation must use the
+ *   thread queue.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_semaphore_Try_surrender_lock_free(
+  CORE_semaphore_Control *the_semaphore,
+  uint32_t                maximum_count,
+  Status_Control         *status
+)
+{
+  unsigned int count;
+
+  count = _Atomic_Load_uint( &the_semaphore->count, ATOMIC_ORDER_RELAXED );
+
+  do {
+    if ( count == 0 ) {
+      return false;
+    }
+
+    if ( count >= maximum_count ) {
+      *status = STATUS_MAXIMUM_COUNT_EXCEEDED;
+      return true;
+    }
+  } while (
+    !_Atomic_Compare_exchange_uint(
+      &the_semaphore->count,
+      &count,
+      count + 1,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  *status = STATUS_SUCCESSFUL;
+  return true;
+}
+#endif
+
 /**
  * @brief Surrenders a unit to the semaphore.
  *
@@ -138,6 +241,19 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_semaphore_Surrender(
   Thread_Control *the_thread;
   Status_Control  status;
 
+#if defined(RTEMS_SMP)
+  if (
+    _CORE_semaphore_Try_surrender_lock_free(
+      the_semaphore,
+      maximum_count,
+      &status
+    )
+  ) {
+    _ISR_lock_ISR_enable( &queue_context->Lock_context.Lock_context );
+    return status;
+  }
+#endif
+
   status = STATUS_SUCCESSFUL;
 
   _CORE_semaphore_Acquire_critical( the_semaphore, queue_context );
@@ -154,11 +270,7 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_semaphore_Surrender(
       queue_context
     );
   } else {
-    if ( the_semaphore->count < maximum_count )
-      the_semaphore->count += 1;
-    else
-      status = STATUS_MAXIMUM_COUNT_EXCEEDED;
-
+    status = _CORE_semaphore_Increment( the_semaphore, maximum_count );
     _CORE_semaphore_Release( the_semaphore, queue_context );
   }
 
@@ -176,7 +288,11 @@ RTEMS_INLINE_ROUTINE uint32_t  _CORE_semaphore_Get_count(
   const CORE_semaphore_Control *the_semaphore
 )
 {
+#if defined(RTEMS_SMP)
+  return _Atomic_Load_uint( &the_semaphore->count, ATOMIC_ORDER_RELAXED );
+#else
   return the_semaphore->count;
+#endif
 }
 
 /**
@@ -210,8 +326,17 @@ RTEMS_INLINE_ROUTINE Status_Control _CORE_semaphore_Seize(
   _Assert( _ISR_Get_level() != 0 );
 
   _CORE_semaphore_Acquire_critical( the_semaphore, queue_context );
-  if ( the_semaphore->count != 0 ) {
+  if ( _CORE_semaphore_Get_count( the_semaphore ) != 0 ) {
+    /*
+     * Only the owner of the thread queue lock decrements the count.  In SMP
+     * configurations, concurrent increments without the lock are possible,
+     * see _CORE_semaphore_Try_surrender_lock_free().
+     */
+#if defined(RTEMS_SMP)
+    _Atomic_Fetch_sub_uint( &the_semaphore->count, 1, ATOMIC_ORDER_ACQUIRE );
+#else
     the_semaphore->count -= 1;
+#endif
     _CORE_semaphore_Release( the_semaphore, queue_context );
     return STATUS_SUCCESSFUL;
   }
@@ -21,6 +21,8 @@
 #include <rtems/score/cpu.h>
 #include <rtems/score/heapinfo.h>
 
+#include <limits.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -42,6 +44,11 @@ extern "C" {
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
  *
+ * Optionally, a segregated free list index may be enabled for a heap, see
+ * @ref Heap_Free_index.  In this case the allocation uses a good fit method
+ * with a constant time search for requests without alignment and boundary
+ * constraints.
+ *
  * The alignment routines could be made faster should we require only powers of
  * two to be supported for page size, alignment and boundary arguments.  The
  * minimum alignment requirement for pages is currently CPU_ALIGNMENT and this
@@ -312,11 +319,90 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief Binary logarithm of the second level size class count of the free
+ * list index.
+ *
+ * @see Heap_Free_index.
+ */
+#define HEAP_FREE_INDEX_SL_SHIFT 3
+
+/**
+ * @brief Count of second level size classes per first level size class of the
+ * free list index.
+ */
+#define HEAP_FREE_INDEX_SL_COUNT ( 1U << HEAP_FREE_INDEX_SL_SHIFT )
+
+/**
+ * @brief Binary logarithm of the block size limit for the small size classes
+ * of the free list index.
+ *
+ * Blocks smaller than this limit are mapped to the first level size class
+ * zero and distributed linearly across its second level size classes.
+ */
+#define HEAP_FREE_INDEX_FL_SHIFT 6
+
+/**
+ * @brief Count of first level size classes of the free list index.
+ */
+#define HEAP_FREE_INDEX_FL_COUNT \
+  ( CHAR_BIT * sizeof( uintptr_t ) - HEAP_FREE_INDEX_FL_SHIFT + 1 )
+
+/**
+ * @brief Count of size classes of the free list index.
+ */
+#define HEAP_FREE_INDEX_CLASS_COUNT \
+  ( HEAP_FREE_INDEX_FL_COUNT * HEAP_FREE_INDEX_SL_COUNT )
+
+/**
+ * @brief Segregated free list index of a heap.
+ *
+ * The index uses a two-level segregated fit size class mapping.  The first
+ * level size class is the binary logarithm of the block size.  The second
+ * level size class linearly subdivides the first level size class.
+ *
+ * If a heap has an index, then the free list is kept ordered by size class.
+ * Within a size class the order is last in, first out.  For each size class
+ * the index contains the first free block of this size class in the free list
+ * and a two-level bitmap of the non-empty size classes.  This enables O(1)
+ * insert, extract and good fit search operations while the free list remains
+ * a plain doubly linked list for _Heap_Walk(), _Heap_Get_information() and
+ * the other heap services.
+ *
+ * The index resides in an allocated block of the heap, see
+ * _Heap_Free_index_enable().
+ */
+typedef struct {
+  /**
+   * @brief Bitmap of first level size classes with at least one non-empty
+   * second level size class.
+   */
+  uintptr_t fl_bitmap;
+
+  /**
+   * @brief Bitmaps of the non-empty second level size classes.
+   */
+  uint32_t sl_bitmap[ HEAP_FREE_INDEX_FL_COUNT ];
+
+  /**
+   * @brief The first free block of each size class or NULL if the size class
+   * is empty.
+   */
+  Heap_Block *first[ HEAP_FREE_INDEX_CLASS_COUNT ];
+} Heap_Free_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
 struct Heap_Control {
   Heap_Block free_list;
+
+  /**
+   * @brief The segregated free list index or NULL if the heap uses the plain
+   * first fit free list.
+   */
+  Heap_Free_index *free_index;
+
   uintptr_t page_size;
   uintptr_t min_block_size;
   uintptr_t area_begin;
@@ -376,6 +376,61 @@ Heap_Block *_Heap_Block_allocate(
   uintptr_t alloc_size
 );
 
+/**
+ * @brief Enables the segregated free list index of the heap.
+ *
+ * The index is allocated from the heap itself.  All free blocks present in the
+ * free list are sorted into the index.  Afterwards, the free list is kept
+ * ordered by size class and the allocation uses a good fit strategy with O(1)
+ * search time for requests without an alignment or boundary constraint.  The
+ * index stays enabled until the heap is initialized again.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ *
+ * @retval true The index is enabled.
+ * @retval false Not enough memory is available to allocate the index.
+ */
+bool _Heap_Free_index_enable( Heap_Control *heap );
+
+/**
+ * @brief Inserts the free block into the free list according to its size
+ * class.
+ *
+ * The heap must have an index.  The block size must be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The free block to insert.
+ */
+void _Heap_Free_index_insert( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Extracts the free block from the free list and updates the index.
+ *
+ * The heap must have an index.  The block size must be the size the block had
+ * when it was inserted.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The free block to extract.
+ */
+void _Heap_Free_index_extract( Heap_Control *heap, Heap_Block *block );
+
+/**
+ * @brief Returns the first free block of the first non-empty size class which
+ * is greater than or equal to the specified size class.
+ *
+ * The heap must have an index.
+ *
+ * @param heap The heap to operate upon.
+ * @param size_class The size class to start the search.
+ *
+ * @return The first free block of the first non-empty size class starting
+ *   with @a size_class, otherwise the free list tail.
+ */
+Heap_Block *_Heap_Free_index_find(
+  Heap_Control *heap,
+  unsigned int  size_class
+);
+
 #ifndef HEAP_PROTECTION
   #define _Heap_Protection_block_initialize( heap, block ) ((void) 0)
   #define _Heap_Protection_block_check( heap, block ) ((void) 0)
@@ -812,6 +867,131 @@ RTEMS_INLINE_ROUTINE uintptr_t _Heap_Min( uintptr_t a, uintptr_t b )
   return a < b ? a : b;
 }
 
+/**
+ * @brief Returns the size class of the free list index for the block size.
+ *
+ * @param block_size The block size.
+ *
+ * @return The size class of the block size.
+ */
+RTEMS_INLINE_ROUTINE unsigned int _Heap_Free_index_class(
+  uintptr_t block_size
+)
+{
+  unsigned int fl;
+  unsigned int sl;
+
+  if ( block_size < ( (uintptr_t) 1 << HEAP_FREE_INDEX_FL_SHIFT ) ) {
+    fl = 0;
+    sl = (unsigned int) ( block_size
+      >> ( HEAP_FREE_INDEX_FL_SHIFT - HEAP_FREE_INDEX_SL_SHIFT ) );
+  } else {
+    unsigned int msb;
+
+    msb = (unsigned int) ( CHAR_BIT * sizeof( unsigned long ) - 1 )
+      - (unsigned int) __builtin_clzl( (unsigned long) block_size );
+    fl = msb - HEAP_FREE_INDEX_FL_SHIFT + 1;
+    sl = (unsigned int) ( block_size >> ( msb - HEAP_FREE_INDEX_SL_SHIFT ) )
+      & ( HEAP_FREE_INDEX_SL_COUNT - 1 );
+  }
+
+  return fl * HEAP_FREE_INDEX_SL_COUNT + sl;
+}
+
+/**
+ * @brief Inserts a free block into the free list.
+ *
+ * If the heap has an index, then the block is inserted according to its size
+ * class and the anchor is ignored, otherwise it is inserted after the anchor.
+ * The block size must be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param anchor The block that is already in the free list.
+ * @param block The block to insert.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_list_insert(
+  Heap_Control *heap,
+  Heap_Block *anchor,
+  Heap_Block *block
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_insert_after( anchor, block );
+  } else {
+    _Heap_Free_index_insert( heap, block );
+  }
+}
+
+/**
+ * @brief Extracts a free block from the free list.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The block to extract.
+ *
+ * @see _Heap_Free_index_extract().
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_list_extract(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_remove( block );
+  } else {
+    _Heap_Free_index_extract( heap, block );
+  }
+}
+
+/**
+ * @brief Substitutes a free block in the free list by another free block.
+ *
+ * Without an index the new block takes the position of the old block.  With
+ * an index the new block is inserted according to its size class.  The size
+ * of the new block must be valid.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param old_block The block in the free list to substitute.
+ * @param new_block The block that should substitute @a old_block.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_list_substitute(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block
+)
+{
+  if ( heap->free_index == NULL ) {
+    _Heap_Free_list_replace( old_block, new_block );
+  } else {
+    _Heap_Free_index_extract( heap, old_block );
+    _Heap_Free_index_insert( heap, new_block );
+  }
+}
+
+/**
+ * @brief Sets the size of a free block which is in the free list.
+ *
+ * The flag @c HEAP_PREV_BLOCK_USED is set in the block.  In case the heap has
+ * an index, the block is moved to its new size class.
+ *
+ * @param[in, out] heap The heap to operate upon.
+ * @param block The free block.
+ * @param size The new block size.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_list_set_block_size(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t size
+)
+{
+  if ( heap->free_index == NULL ) {
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+  } else {
+    _Heap_Free_index_extract( heap, block );
+    block->size_and_flag = size | HEAP_PREV_BLOCK_USED;
+    _Heap_Free_index_insert( heap, block );
+  }
+}
+
 #ifdef RTEMS_DEBUG
   #define RTEMS_HEAP_DEBUG
 #endif
@@ -45,6 +45,39 @@ typedef struct {
   Objects_Name   name;
 } Objects_Control;
 
+/**
+ * @brief The object name hash index.
+ *
+ * The index maps object names to local table indices.  It is optional and
+ * only present if <rtems/confdefs.h> enables it via
+ * CONFIGURE_ENABLE_OBJECT_NAME_HASH, see _Objects_Name_hash_Initialize().
+ *
+ * The index and the next links use the local table index plus one, so that
+ * zero marks the end of a bucket.  The objects of a bucket are sorted by
+ * their local table index.  Thus a lookup returns the same object as a
+ * linear search through the local table.
+ *
+ * The buckets and next links are protected by the allocator lock.
+ */
+typedef struct {
+  /**
+   * @brief This is the count of buckets.
+   */
+  Objects_Maximum bucket_count;
+
+  /**
+   * @brief This is the table of next links indexed by local table index.
+   *
+   * It has one entry per local table entry.
+   */
+  Objects_Maximum *next;
+
+  /**
+   * @brief This is the table of buckets.
+   */
+  Objects_Maximum buckets[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Objects_Name_hash;
+
 /**
  *  This enumerated type is used in the class field of the object ID
  *  for RTEMS internal object classes.
@@ -281,6 +314,16 @@ struct Objects_Information {
    */
   Objects_Control *initial_objects;
 
+  /**
+   * @brief This points to the optional object name hash index.
+   *
+   * This member is statically initialized to NULL.  It is set by
+   * _Objects_Name_hash_Initialize() in case the name hash index is enabled
+   * and replaced by _Objects_Extend_information() together with the local
+   * table.
+   */
+  Objects_Name_hash *name_hash;
+
 #if defined(RTEMS_MULTIPROCESSING)
   /**
    * @brief This method is used by _Thread_queue_Extract_with_proxy().
@@ -402,6 +445,7 @@ Objects_Information name##_Information = { \
   CHAIN_INITIALIZER_EMPTY( name##_Information.Inactive ), \
   NULL, \
   NULL, \
+  NULL, \
   NULL \
   OBJECTS_INFORMATION_MP( name##_Information, NULL ) \
 }
@@ -442,7 +486,8 @@ Objects_Information name##_Information = { \
   CHAIN_INITIALIZER_EMPTY( name##_Information.Inactive ), \
   NULL, \
   NULL, \
-  &name##_Objects[ 0 ].Object \
+  &name##_Objects[ 0 ].Object, \
+  NULL \
   OBJECTS_INFORMATION_MP( name##_Information, ex ) \
 }
 
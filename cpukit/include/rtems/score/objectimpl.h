@@ -134,6 +134,144 @@ void _Objects_Shrink_information(
  */
 void _Objects_Initialize_information( Objects_Information *information );
 
+/**
+ * @brief Creates an object name hash index for the local table.
+ *
+ * The objects of the local table are added to the new index.
+ *
+ * @param information The object information.
+ * @param local_table The local table of the object information.
+ * @param maximum The count of local table entries.  Must be positive.
+ *
+ * @retval pointer The new object name hash index allocated from the
+ *   workspace.
+ * @retval NULL Not enough memory is available.
+ */
+Objects_Name_hash *_Objects_Name_hash_Create(
+  const Objects_Information *information,
+  Objects_Control          **local_table,
+  Objects_Maximum            maximum
+);
+
+/**
+ * @brief Initializes the object name hash index of all object classes which
+ * provide a lookup by name.
+ *
+ * This is the system initialization handler used by <rtems/confdefs.h> in
+ * case CONFIGURE_ENABLE_OBJECT_NAME_HASH is defined.  The Classic API object
+ * classes and the POSIX API object classes with string names get an index.
+ * In case there is not enough memory for the index of an object class, then
+ * the lookups use the linear search of the local table.
+ */
+void _Objects_Name_hash_Initialize( void );
+
+/**
+ * @brief Inserts the object into the object name hash index.
+ *
+ * Do not call this function directly, use _Objects_Name_hash_Insert()
+ * instead.
+ *
+ * @param information The object information.  It must have a name hash
+ *   index.
+ * @param the_object The object to insert.
+ */
+void _Objects_Name_hash_Do_insert(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+);
+
+/**
+ * @brief Extracts the object from the object name hash index.
+ *
+ * Do not call this function directly, use _Objects_Name_hash_Extract()
+ * instead.
+ *
+ * @param information The object information.  It must have a name hash
+ *   index.
+ * @param the_object The object to extract.
+ */
+void _Objects_Name_hash_Do_extract(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+);
+
+/**
+ * @brief Inserts the object into the object name hash index if present.
+ *
+ * The object name must be set.  Objects without a name are not indexed.  The
+ * caller must own the allocator lock or the system must be in the
+ * initialization phase.
+ *
+ * @param information The object information.
+ * @param the_object The object to insert.
+ */
+RTEMS_INLINE_ROUTINE void _Objects_Name_hash_Insert(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+)
+{
+  if ( information->name_hash != NULL ) {
+    _Objects_Name_hash_Do_insert( information, the_object );
+  }
+}
+
+/**
+ * @brief Extracts the object from the object name hash index if present.
+ *
+ * This function must be called before the object name changes.  It does
+ * nothing if the object is not indexed.
+ *
+ * @param information The object information.
+ * @param the_object The object to extract.
+ */
+RTEMS_INLINE_ROUTINE void _Objects_Name_hash_Extract(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+)
+{
+  if ( information->name_hash != NULL ) {
+    _Objects_Name_hash_Do_extract( information, the_object );
+  }
+}
+
+/**
+ * @brief Looks up the identifier of an object with a 32-bit integer name in
+ * the object name hash index.
+ *
+ * The caller must own the allocator lock.
+ *
+ * @param information The object information.  It must have a name hash
+ *   index.
+ * @param name The object name.
+ * @param[out] id The identifier of the object with the lowest index and this
+ *   name.
+ *
+ * @retval true An object with this name exists.
+ * @retval false Otherwise.
+ */
+bool _Objects_Name_hash_Find_u32(
+  const Objects_Information *information,
+  uint32_t                   name,
+  Objects_Id                *id
+);
+
+/**
+ * @brief Looks up an object with a string name in the object name hash index.
+ *
+ * The caller must own the allocator lock.
+ *
+ * @param information The object information.  It must have a name hash
+ *   index.
+ * @param name The object name.
+ *
+ * @retval pointer The object with the lowest index and this name.
+ * @retval NULL No object exists for this name.
+ */
+Objects_Control *_Objects_Name_hash_Find_string(
+  const Objects_Information *information,
+  const char                *name
+);
+
 /**
  * @brief Returns highest numeric value of a valid API for the specified API.
  *
@@ -485,6 +623,7 @@ RTEMS_INLINE_ROUTINE void _Objects_Namespace_remove_u32(
 )
 {
   _Assert( !_Objects_Has_string_name( information ) );
+  _Objects_Name_hash_Extract( information, the_object );
   the_object->name.name_u32 = 0;
 }
 
@@ -760,6 +899,8 @@ RTEMS_INLINE_ROUTINE void _Objects_Open(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  _Objects_Name_hash_Insert( information, the_object );
 }
 
 /**
@@ -786,6 +927,8 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_u32(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  _Objects_Name_hash_Insert( information, the_object );
 }
 
 /**
@@ -812,6 +955,8 @@ RTEMS_INLINE_ROUTINE void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  _Objects_Name_hash_Insert( information, the_object );
 }
 
 /**
@@ -0,0 +1,371 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerPriorityStealingSMP
+ *
+ * @brief Work Stealing Priority SMP Scheduler API
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERPRIORITYSTEALINGSMP_H
+#define _RTEMS_SCORE_SCHEDULERPRIORITYSTEALINGSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulerpriority.h>
+#include <rtems/score/schedulersmp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreSchedulerPriorityStealingSMP Work Stealing Priority SMP Scheduler
+ *
+ * @ingroup RTEMSScoreSchedulerSMP
+ *
+ * @brief Work Stealing Priority SMP Scheduler
+ *
+ * This is a variant of the deterministic priority SMP scheduler with one ready
+ * queue per processor.  Each ready queue uses one ready chain per priority and
+ * its own priority bit map.  A ready node is enqueued on the ready queue of the
+ * processor it executed on last, provided its affinity set contains this
+ * processor, so that threads tend to stay on their processor.
+ *
+ * Whenever a processor selects a new node, for example because the executing
+ * thread blocks, yields, has an exhausted timeslice, or the processor would
+ * otherwise become idle, it looks at its own ready queue first and then tries
+ * to steal a node from the ready queues of the other processors.  A node of
+ * another ready queue with a higher priority and an affinity to the processor
+ * is always stolen, so no processor executes a node of lower priority than an
+ * eligible ready node.  For nodes of equal priority the local node is
+ * preferred unless the remote node was enqueued more than
+ * #SCHEDULER_PRIORITY_STEALING_SMP_GENERATION_WINDOW enqueue operations
+ * earlier.  This bounds the FIFO order inversion among nodes of equal
+ * priority which is traded for processor locality.
+ *
+ * The scheduled chain uses linear insert operations and has at most processor
+ * count entries.  Since the processor and priority count are constants all
+ * scheduler operations complete in a bounded execution time.
+ *
+ * The per processor ready queues are a locality heuristic.  They do not
+ * reduce the lock contention, since all operations of a scheduler instance
+ * are serialized by the scheduler instance lock and the selection of the
+ * highest ready node looks at the ready queues of all processors.  To reduce
+ * the lock contention, split the processors into several scheduler instances
+ * (clusters).
+ *
+ * The thread preempt mode will be ignored.
+ *
+ * @{
+ */
+
+/**
+ * @brief The count of enqueue operations a ready node of another processor
+ * must be older than the local ready node of equal priority to get stolen.
+ */
+#define SCHEDULER_PRIORITY_STEALING_SMP_GENERATION_WINDOW 8
+
+/**
+ * @brief Per processor ready queue of Work Stealing Priority SMP schedulers.
+ */
+typedef struct {
+  /**
+   * @brief The priority bit map of this ready queue.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief The ready chains of this ready queue, one for each priority.
+   */
+  Chain_Control *Ready;
+} Scheduler_priority_stealing_SMP_Queue;
+
+/**
+ * @brief Scheduler context specialization for Work Stealing Priority SMP
+ * schedulers.
+ */
+typedef struct {
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief Current generation for LIFO (index 0) and FIFO (index 1) ordering.
+   */
+  int64_t generations[ 2 ];
+
+  /**
+   * @brief The per processor ready queues.
+   *
+   * The array has an entry for each configured processor.  It follows the
+   * ready chains in the scheduler context defined by
+   * RTEMS_SCHEDULER_PRIORITY_STEALING_SMP().
+   */
+  Scheduler_priority_stealing_SMP_Queue *Queues;
+
+  /**
+   * @brief The ready chains of all ready queues.
+   *
+   * The ready chains of the ready queue of processor index i start at index
+   * i * (maximum priority + 1).
+   */
+  Chain_Control Ready[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_priority_stealing_SMP_Context;
+
+/**
+ * @brief Scheduler node specialization for Work Stealing Priority SMP
+ * schedulers.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief The associated ready chain of this node.
+   */
+  Scheduler_priority_Ready_queue Ready_queue;
+
+  /**
+   * @brief Generation number to ensure FIFO/LIFO order for threads of the same
+   * priority across different ready queues.
+   */
+  int64_t generation;
+
+  /**
+   * @brief The index of the processor of the ready queue of this node.
+   */
+  uint32_t ready_queue_index;
+
+  /**
+   * @brief The processor affinity of this node.
+   */
+  Processor_mask Affinity;
+} Scheduler_priority_stealing_SMP_Node;
+
+/**
+ * @brief Entry points for the Work Stealing Priority SMP Scheduler.
+ */
+#define SCHEDULER_PRIORITY_STEALING_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_priority_stealing_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_priority_stealing_SMP_Yield, \
+    _Scheduler_priority_stealing_SMP_Block, \
+    _Scheduler_priority_stealing_SMP_Unblock, \
+    _Scheduler_priority_stealing_SMP_Update_priority, \
+    _Scheduler_default_Map_priority, \
+    _Scheduler_default_Unmap_priority, \
+    _Scheduler_priority_stealing_SMP_Ask_for_help, \
+    _Scheduler_priority_stealing_SMP_Reconsider_help_request, \
+    _Scheduler_priority_stealing_SMP_Withdraw_node, \
+    _Scheduler_default_Pin_or_unpin, \
+    _Scheduler_default_Pin_or_unpin, \
+    _Scheduler_priority_stealing_SMP_Add_processor, \
+    _Scheduler_priority_stealing_SMP_Remove_processor, \
+    _Scheduler_priority_stealing_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_default_Cancel_job, \
+    _Scheduler_default_Tick, \
+    _Scheduler_SMP_Start_idle, \
+    _Scheduler_priority_stealing_SMP_Set_affinity \
+  }
+
+/**
+ * @brief Initializes the scheduler.
+ *
+ * @param scheduler The scheduler to initialize.
+ */
+void _Scheduler_priority_stealing_SMP_Initialize(
+  const Scheduler_Control *scheduler
+);
+
+/**
+ * @brief Initializes the node with the given priority.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[out] node The node to initialize.
+ * @param the_thread The thread of the scheduler node.
+ * @param priority The priority for the initialization.
+ */
+void _Scheduler_priority_stealing_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+/**
+ * @brief Blocks the thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread to block.
+ * @param[in, out] node The @a thread's scheduler node.
+ */
+void _Scheduler_priority_stealing_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Unblocks the thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread to unblock.
+ * @param[in, out] node The @a thread's scheduler node.
+ */
+void _Scheduler_priority_stealing_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Updates the priority of the node.
+ *
+ * @param scheduler The scheduler instance.
+ * @param the_thread The thread for the operation.
+ * @param node The thread's scheduler node.
+ */
+void _Scheduler_priority_stealing_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Asks for help operation.
+ *
+ * @param scheduler The scheduler instance to ask for help.
+ * @param the_thread The thread needing help.
+ * @param node The scheduler node.
+ *
+ * @retval true Ask for help was successful.
+ * @retval false Ask for help was not successful.
+ */
+bool _Scheduler_priority_stealing_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Reconsiders help operation.
+ *
+ * @param scheduler The scheduler instance to reconsider the help
+ *   request.
+ * @param the_thread The thread reconsidering a help request.
+ * @param node The scheduler node.
+ */
+void _Scheduler_priority_stealing_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Withdraws node operation.
+ *
+ * @param scheduler The scheduler instance to withdraw the node.
+ * @param the_thread The thread using the node.
+ * @param node The scheduler node to withdraw.
+ * @param next_state The next thread scheduler state in case the node is
+ *   scheduled.
+ */
+void _Scheduler_priority_stealing_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+);
+
+/**
+ * @brief Adds @a idle to @a scheduler.
+ *
+ * @param[in, out] scheduler The scheduler instance to add the processor to.
+ * @param idle The idle thread control.
+ */
+void _Scheduler_priority_stealing_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+);
+
+/**
+ * @brief Removes an idle thread from the given cpu.
+ *
+ * @param scheduler The scheduler instance.
+ * @param cpu The cpu control to remove from @a scheduler.
+ *
+ * @return The idle thread of the processor.
+ */
+Thread_Control *_Scheduler_priority_stealing_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Performs the yield of a thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread that performed the yield operation.
+ * @param node The scheduler node of @a the_thread.
+ */
+void _Scheduler_priority_stealing_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Sets the processor affinity of the node.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] thread The thread of the node.
+ * @param[in, out] node The node to set the affinity of.
+ * @param affinity The new processor affinity.
+ *
+ * @retval true The affinity was set.
+ * @retval false The affinity contains no processor owned by the scheduler
+ *   instance.
+ */
+bool _Scheduler_priority_stealing_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node,
+  const Processor_mask    *affinity
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERPRIORITYSTEALINGSMP_H */
@@ -38,25 +38,75 @@ extern "C" {
  *
  * @brief Strong APA Scheduler
  *
- * This is an implementation of the global fixed priority scheduler (G-FP).  It
- * uses one ready chain per priority to ensure constant time insert operations.
- * The scheduled chain uses linear insert operations and has at most processor
- * count entries.  Since the processor and priority count are constants all
- * scheduler operations complete in a bounded execution time.
+ * This is an implementation of the strong arbitrary processor affinity (APA)
+ * fixed priority scheduler.  A ready node is never left waiting while a
+ * processor in the reach of its affinity set executes a node of lower
+ * priority.  The reach of an affinity set contains the processors of the set
+ * and recursively all processors the nodes scheduled on already reached
+ * processors could be shifted to according to their own affinity sets.  The
+ * scheduler uses one ready chain per priority to ensure constant time insert
+ * operations.  The search for the lowest scheduled and the highest ready node
+ * is a breadth-first search through the processors of the scheduler instance.
+ * It visits each processor at most once, so all scheduler operations complete
+ * in a bounded execution time which depends on the processor count.  Once a
+ * node is selected, the scheduled nodes along the found path are shifted
+ * to the next processor of the path.
  *
  * The the_thread preempt mode will be ignored.
  *
  * @{
  */
 
+/**
+ * @brief Per processor search state of Strong APA schedulers.
+ */
+typedef struct {
+  /**
+   * @brief The node scheduled on this processor at the begin of the last
+   * search, or NULL if the processor is not owned by the scheduler instance.
+   */
+  Scheduler_Node *scheduled;
+
+  /**
+   * @brief The processor of the node which moves to this processor if the
+   * path of the last search is taken.
+   *
+   * In case this is NULL, then the node selected by the last search is
+   * allocated to this processor.
+   */
+  struct Per_CPU_Control *source;
+
+  /**
+   * @brief The processor to which the node scheduled on this processor can
+   * move in the search tree of the highest ready node.
+   */
+  struct Per_CPU_Control *target;
+
+  /**
+   * @brief The processor index stored in this slot of the breadth-first
+   * search queue.
+   */
+  uint32_t queue;
+} Scheduler_strong_APA_CPU;
+
 /**
  * @brief Scheduler context specialization for Strong APA
  * schedulers.
  */
 typedef struct {
-  Scheduler_SMP_Context    Base;
-  Priority_bit_map_Control Bit_map;
-  Chain_Control            Ready[ RTEMS_ZERO_LENGTH_ARRAY ];
+  Scheduler_SMP_Context     Base;
+
+  /**
+   * @brief The per processor search states.
+   *
+   * The array has an entry for each configured processor.  It follows the
+   * ready chains in the scheduler context defined by
+   * RTEMS_SCHEDULER_STRONG_APA().
+   */
+  Scheduler_strong_APA_CPU *CPU;
+
+  Priority_bit_map_Control  Bit_map;
+  Chain_Control             Ready[ RTEMS_ZERO_LENGTH_ARRAY ];
 } Scheduler_strong_APA_Context;
 
 /**
@@ -73,6 +123,11 @@ typedef struct {
    * @brief The associated ready queue of this node.
    */
   Scheduler_priority_Ready_queue Ready_queue;
+
+  /**
+   * @brief The processor affinity of this node.
+   */
+  Processor_mask Affinity;
 } Scheduler_strong_APA_Node;
 
 /**
@@ -100,8 +155,8 @@ typedef struct {
     _Scheduler_default_Release_job, \
     _Scheduler_default_Cancel_job, \
     _Scheduler_default_Tick, \
-    _Scheduler_SMP_Start_idle \
-    SCHEDULER_OPERATION_DEFAULT_GET_SET_AFFINITY \
+    _Scheduler_SMP_Start_idle, \
+    _Scheduler_strong_APA_Set_affinity \
   }
 
 /**
@@ -246,6 +301,25 @@ void _Scheduler_strong_APA_Yield(
   Scheduler_Node          *node
 );
 
+/**
+ * @brief Sets the processor affinity of the node.
+ *
+ * @param scheduler The scheduler control instance.
+ * @param[in, out] thread The thread of the node.
+ * @param[in, out] node The node to set the affinity of.
+ * @param affinity The new processor affinity.
+ *
+ * @retval true The affinity was set.
+ * @retval false The affinity contains no processor owned by the scheduler
+ *   instance.
+ */
+bool _Scheduler_strong_APA_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node,
+  const Processor_mask    *affinity
+);
+
 /** @} */
 
 #ifdef __cplusplus
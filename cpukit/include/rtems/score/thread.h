@@ -1039,6 +1039,7 @@ Thread_Information name##_Information = { \
     CHAIN_INITIALIZER_EMPTY( name##_Information.Objects.Inactive ), \
     NULL, \
     NULL, \
+    NULL, \
     NULL \
     OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ), \
   }, { \
@@ -1076,7 +1077,8 @@ Thread_Information name##_Information = { \
     CHAIN_INITIALIZER_EMPTY( name##_Information.Objects.Inactive ), \
     NULL, \
     NULL, \
-    &name##_Objects[ 0 ].Control.Object \
+    &name##_Objects[ 0 ].Control.Object, \
+    NULL \
     OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ) \
   }, { \
     &name##_Heads[ 0 ] \
@@ -583,6 +583,57 @@ typedef struct {
   Thread_queue_Queue Queue;
 } Thread_queue_Control;
 
+#if defined(RTEMS_PROFILING)
+/**
+ * @brief Thread queue contention statistics.
+ *
+ * The statistics are kept in a table outside of the thread queues since the
+ * thread queue layout is fixed by Newlib <sys/lock.h>.  A thread queue is
+ * identified by its address and the identifier of the enclosing object.
+ *
+ * @see _Thread_queue_Stats_get().
+ */
+typedef struct {
+  /**
+   * @brief The thread queue associated with this entry or NULL if the entry is
+   * unused.
+   */
+  const Thread_queue_Queue *queue;
+
+  /**
+   * @brief The identifier of the object containing the thread queue or zero
+   * if the thread queue is not embedded in an object with identifier.
+   */
+  Objects_Id id;
+
+  /**
+   * @brief The thread queue name in case the identifier is zero.
+   */
+  const char *name;
+
+  /**
+   * @brief The identifier of the thread queue owner at the time of the
+   * maximum wait time or zero if there was no owner.
+   */
+  Objects_Id max_wait_owner;
+
+  /**
+   * @brief Count of blocking operations on this thread queue.
+   */
+  uint64_t block_count;
+
+  /**
+   * @brief The maximum wait time in nanoseconds.
+   */
+  uint64_t max_wait_time;
+
+  /**
+   * @brief The total wait time in nanoseconds.
+   */
+  uint64_t total_wait_time;
+} Thread_queue_Stats;
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
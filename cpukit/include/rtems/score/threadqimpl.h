@@ -1495,6 +1495,87 @@ void _Thread_queue_Object_initialize(
   Thread_queue_Control *the_thread_queue
 );
 
+#if defined(RTEMS_PROFILING)
+/**
+ * @brief The count of thread queue contention statistics entries.
+ *
+ * Blocking operations on thread queues which do not fit into the table are
+ * not recorded.
+ */
+#define THREAD_QUEUE_STATS_COUNT 64
+
+/**
+ * @brief A thread queue contention sample of a blocking operation.
+ *
+ * The sample contains a copy of all information necessary to record the
+ * statistics, since the thread queue may be deleted while the thread waits.
+ */
+typedef struct {
+  /**
+   * @brief The thread queue or NULL if this sample should not be recorded.
+   */
+  const Thread_queue_Queue *queue;
+
+  /**
+   * @brief The identifier of the object containing the thread queue.
+   */
+  Objects_Id id;
+
+  /**
+   * @brief The thread queue name.
+   */
+  const char *name;
+
+  /**
+   * @brief The identifier of the thread queue owner.
+   */
+  Objects_Id owner;
+
+  /**
+   * @brief The uptime in nanoseconds at the start of the blocking operation.
+   */
+  uint64_t begin;
+} Thread_queue_Stats_sample;
+
+/**
+ * @brief Starts a thread queue contention sample.
+ *
+ * The thread queue lock must be owned by the caller.
+ *
+ * @param[out] sample The sample to start.
+ * @param queue The thread queue.
+ * @param the_thread The thread about to block on the thread queue.  Proxies
+ *   are not recorded.
+ */
+void _Thread_queue_Stats_begin(
+  Thread_queue_Stats_sample *sample,
+  const Thread_queue_Queue  *queue,
+  const Thread_Control      *the_thread
+);
+
+/**
+ * @brief Ends a thread queue contention sample and records it in the
+ * statistics table.
+ *
+ * The thread queue of the sample is not accessed.
+ *
+ * @param sample The sample started by _Thread_queue_Stats_begin().
+ */
+void _Thread_queue_Stats_end( const Thread_queue_Stats_sample *sample );
+
+/**
+ * @brief Gets a snapshot of a thread queue contention statistics entry.
+ *
+ * @param index The entry index, this value shall be less than
+ *   THREAD_QUEUE_STATS_COUNT.
+ * @param[out] snapshot The snapshot of the entry.
+ *
+ * @retval true The entry is in use.
+ * @retval false Otherwise.
+ */
+bool _Thread_queue_Stats_get( size_t index, Thread_queue_Stats *snapshot );
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
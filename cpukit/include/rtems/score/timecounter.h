@@ -186,6 +186,16 @@ void _Timecounter_Install( struct timecounter *tc );
  */
 void _Timecounter_Tick( void );
 
+/**
+ * @brief Performs a timecounter tick which accounts for ticks skipped by a
+ * tickless idle processor.
+ *
+ * See _Watchdog_Tick_catch_up().
+ *
+ * @param ticks The count of skipped ticks, must be positive.
+ */
+void _Timecounter_Tick_catch_up( uint32_t ticks );
+
 /**
  * @brief Lock to protect the timecounter mechanic.
  */
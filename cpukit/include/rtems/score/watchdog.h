@@ -65,6 +65,56 @@ typedef void Watchdog_Service_routine;
 typedef Watchdog_Service_routine
   ( *Watchdog_Service_routine_entry )( Watchdog_Control * );
 
+#if defined(RTEMS_WATCHDOG_WHEEL)
+/**
+ * @brief The count of index bits used by one level of the timing wheel.
+ */
+#define WATCHDOG_WHEEL_SLOT_BITS 6
+
+/**
+ * @brief The count of slots of one level of the timing wheel.
+ */
+#define WATCHDOG_WHEEL_SLOT_COUNT ( 1 << WATCHDOG_WHEEL_SLOT_BITS )
+
+/**
+ * @brief The count of levels of the timing wheel.
+ *
+ * Watchdogs which expire more than
+ * 2**( WATCHDOG_WHEEL_SLOT_BITS * WATCHDOG_WHEEL_LEVEL_COUNT ) ticks in the
+ * future are kept on an overflow chain.
+ */
+#define WATCHDOG_WHEEL_LEVEL_COUNT 4
+
+/**
+ * @brief Hierarchical timing wheel for watchdogs with a tick resolution.
+ *
+ * A watchdog is placed on the lowest level which can represent the distance
+ * of its expiration time to the next tick to process.  The slot index at a
+ * level is given by the corresponding bits of the expiration time.  Slots of
+ * the higher levels are cascaded to the lower levels when the bits of the
+ * lower levels wrap around.  This yields constant time insert and remove
+ * operations.
+ *
+ * @see _Watchdog_Handler_initialization().
+ */
+typedef struct {
+  /**
+   * @brief The slots of each level.
+   */
+  Chain_Control Slots[ WATCHDOG_WHEEL_LEVEL_COUNT ][ WATCHDOG_WHEEL_SLOT_COUNT ];
+
+  /**
+   * @brief Watchdogs which expire beyond the range of the highest level.
+   */
+  Chain_Control Overflow;
+
+  /**
+   * @brief The next tick to process.
+   */
+  uint64_t next;
+} Watchdog_Wheel;
+#endif
+
 /**
  * @brief The watchdog header to manage scheduled watchdogs.
  */
@@ -79,6 +129,13 @@ typedef struct {
    * case no watchdog is scheduled.
    */
   RBTree_Node *first;
+
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  /**
+   * @brief The timing wheel used instead of the red-black tree or NULL.
+   */
+  Watchdog_Wheel *wheel;
+#endif
 } Watchdog_Header;
 
 /**
@@ -55,6 +55,11 @@ typedef enum {
    */
   WATCHDOG_SCHEDULED_RED,
 
+  /**
+   * @brief The watchdog is scheduled and on a slot of a timing wheel.
+   */
+  WATCHDOG_SCHEDULED_WHEEL,
+
   /**
    * @brief The watchdog is inactive.
    */
@@ -103,6 +108,9 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  header->wheel = NULL;
+#endif
 }
 
 /**
@@ -139,6 +147,88 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Header_destroy(
  */
 void _Watchdog_Tick( struct Per_CPU_Control *cpu );
 
+/**
+ * @brief Performs watchdog ticks which were skipped by a tickless idle
+ * processor.
+ *
+ * All watchdogs which expired during the skipped ticks are processed.  In
+ * contrast to _Watchdog_Tick() no scheduler tick is performed, since the
+ * skipped ticks elapsed while the processor was idle.
+ *
+ * @param cpu The processor for this watchdog tick.
+ * @param ticks The count of skipped ticks, must be positive.
+ */
+void _Watchdog_Tick_catch_up( struct Per_CPU_Control *cpu, uint32_t ticks );
+
+/**
+ * @brief Returns the count of ticks until the next tick which has to process
+ * an expired watchdog of the processor.
+ *
+ * This function is used by tickless idle clock drivers to determine how many
+ * ticks may be skipped.  The result may be less than the actual count, but is
+ * never greater.  The watchdog lock of the processor shall be acquired.
+ *
+ * @param cpu The processor to check.
+ *
+ * @retval WATCHDOG_MAXIMUM_TICKS No watchdog is scheduled.
+ * @retval other The count of ticks, at least one.
+ */
+uint64_t _Watchdog_Ticks_until_next_expiry(
+  const struct Per_CPU_Control *cpu
+);
+
+/**
+ * @brief Handler to program the high resolution event device of the current
+ * processor.
+ *
+ * @param expire The uptime in nanoseconds at which the device shall generate
+ *   an event.  The value may be in the past.
+ */
+typedef void ( *Watchdog_High_resolution_arm )( uint64_t expire );
+
+/**
+ * @brief The handler to program the high resolution event device.
+ *
+ * In case this handler is NULL, then the watchdogs of the monotonic clock
+ * header are processed only by the clock tick.
+ */
+extern Watchdog_High_resolution_arm _Watchdog_High_resolution_arm_handler;
+
+/**
+ * @brief Installs the handler to program the high resolution event device.
+ *
+ * Once installed, the earliest watchdog of the monotonic clock header of a
+ * processor determines the next event of the device of this processor.  The
+ * clock driver shall call _Watchdog_High_resolution_tick() in the event
+ * interrupt handler.
+ *
+ * @param arm The handler to program the high resolution event device.
+ */
+void _Watchdog_High_resolution_install( Watchdog_High_resolution_arm arm );
+
+/**
+ * @brief Programs the high resolution event device for the earliest watchdog
+ * of the monotonic clock header of the processor.
+ *
+ * Nothing is done if the processor is not the current processor.  In this
+ * case, the watchdog is processed by the next clock tick or event of the
+ * processor.  The watchdog lock of the processor shall be acquired.
+ *
+ * @param cpu The processor of the monotonic clock header.
+ */
+void _Watchdog_High_resolution_update( struct Per_CPU_Control *cpu );
+
+/**
+ * @brief Processes the expired watchdogs of the monotonic clock header with
+ * respect to the precise uptime.
+ *
+ * This function shall be called by the event interrupt handler of the high
+ * resolution event device.
+ *
+ * @param cpu The current processor.
+ */
+void _Watchdog_High_resolution_tick( struct Per_CPU_Control *cpu );
+
 /**
  * @brief Gets the state of the watchdog.
  *
@@ -271,6 +361,90 @@ void _Watchdog_Do_tickle(
     _Watchdog_Do_tickle( header, first, now, lock_context )
 #endif
 
+#if defined(RTEMS_WATCHDOG_WHEEL)
+/**
+ * @brief Initializes the watchdog header to use the timing wheel.
+ *
+ * @param[out] header The header to initialize.
+ * @param[out] wheel The timing wheel for the header.
+ * @param now The current time of the header.
+ */
+void _Watchdog_Wheel_initialize(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+);
+
+/**
+ * @brief Inserts the watchdog into the timing wheel of the header.
+ *
+ * The watchdog must be inactive.
+ *
+ * @param[in, out] header The watchdog header with a timing wheel.
+ * @param[in, out] the_watchdog The watchdog to insert.
+ * @param expire The expiration time for the watchdog.
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Header  *header,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+);
+
+/**
+ * @brief Returns a lower bound of the earliest expiration time of the
+ * watchdogs in the timing wheel of the header.
+ *
+ * @param header The watchdog header with a timing wheel.
+ *
+ * @retval WATCHDOG_MAXIMUM_TICKS The timing wheel is empty.
+ * @retval other The lower bound of the earliest expiration time.
+ */
+uint64_t _Watchdog_Wheel_First_expire( const Watchdog_Header *header );
+
+/**
+ * @brief Advances the timing wheel of the header up to the current time and
+ * calls the routine of each expired watchdog.
+ *
+ * @param header The watchdog header with a timing wheel.
+ * @param now The current time.
+ * @param lock The lock that is released before calling the routine and then
+ *      acquired after the call.
+ * @param lock_context The lock context for the release before calling the
+ *      routine and for the acquire after.
+ */
+void _Watchdog_Do_tickle_wheel(
+  Watchdog_Header  *header,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Tickle_wheel( header, now, lock, lock_context ) \
+    _Watchdog_Do_tickle_wheel( header, now, lock, lock_context )
+#else
+  #define _Watchdog_Tickle_wheel( header, now, lock, lock_context ) \
+    _Watchdog_Do_tickle_wheel( header, now, lock_context )
+#endif
+
+/**
+ * @brief The timing wheels of the configured processors.
+ *
+ * This array is defined by the application configuration.
+ */
+extern Watchdog_Wheel _Watchdog_Wheels[];
+
+/**
+ * @brief Sets up the timing wheels of the ticks based watchdog headers of the
+ * configured processors.
+ */
+void _Watchdog_Handler_initialization( void );
+#else
+#define _Watchdog_Handler_initialization() do { } while ( 0 )
+#endif
+
 /**
  * @brief Inserts a watchdog into the set of scheduled watchdogs according to
  * the specified expiration time.
@@ -552,6 +726,23 @@ RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Ticks_from_sbintime( int64_t sbt )
   return ticks;
 }
 
+/**
+ * @brief Converts the ticks in the nanoseconds watchdog format to
+ * nanoseconds.
+ *
+ * @param ticks The ticks to convert to nanoseconds.
+ *
+ * @return @a ticks converted to nanoseconds.
+ */
+RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Nanoseconds_from_ticks(
+  uint64_t ticks
+)
+{
+  return ( ticks >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS )
+    * WATCHDOG_NANOSECONDS_PER_SECOND
+    + ( ticks & ( ( UINT64_C( 1 ) << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1 ) );
+}
+
 /**
  * @brief Acquires the per cpu watchdog lock in a critical section.
  *
@@ -580,6 +771,32 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Per_CPU_release_critical(
   _ISR_lock_Release( &cpu->Watchdog.Lock, lock_context );
 }
 
+/**
+ * @brief Programs the high resolution event device if the watchdog just
+ * inserted into the monotonic clock header of the processor is the new
+ * earliest watchdog.
+ *
+ * The watchdog lock of the processor shall be acquired.
+ *
+ * @param cpu The processor of the watchdog header.
+ * @param header The watchdog header of the inserted watchdog.
+ * @param the_watchdog The inserted watchdog.
+ */
+RTEMS_INLINE_ROUTINE void _Watchdog_High_resolution_inserted(
+  Per_CPU_Control        *cpu,
+  const Watchdog_Header  *header,
+  const Watchdog_Control *the_watchdog
+)
+{
+  if (
+    _Watchdog_High_resolution_arm_handler != NULL
+      && header->first == &the_watchdog->Node.RBTree
+      && header == &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+  ) {
+    _Watchdog_High_resolution_update( cpu );
+  }
+}
+
 /**
  * @brief Sets the watchdog's cpu to the given instance and sets its expiration
  *      time to the watchdog expiration time of the cpu plus the ticks.
@@ -635,6 +852,7 @@ RTEMS_INLINE_ROUTINE uint64_t _Watchdog_Per_CPU_insert(
 
   _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
   _Watchdog_Insert( header, the_watchdog, expire );
+  _Watchdog_High_resolution_inserted( cpu, header, the_watchdog );
   _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
   return expire;
 }
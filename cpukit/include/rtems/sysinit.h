@@ -66,6 +66,7 @@ extern "C" {
 #define RTEMS_SYSINIT_POSIX_SHM                  001a00
 #define RTEMS_SYSINIT_POSIX_KEYS                 001b00
 #define RTEMS_SYSINIT_POSIX_CLEANUP              001c00
+#define RTEMS_SYSINIT_OBJECT_NAME_HASH           001c80
 #define RTEMS_SYSINIT_IDLE_THREADS               001d00
 #define RTEMS_SYSINIT_LIBIO                      001e00
 #define RTEMS_SYSINIT_USER_ENVIRONMENT           001e80
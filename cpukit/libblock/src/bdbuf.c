@@ -87,6 +87,46 @@ typedef struct rtems_bdbuf_waiters {
   rtems_condition_variable cond_var;
 } rtems_bdbuf_waiters;
 
+/**
+ * A partition of the BD buffer cache. It owns a range of groups and the BDs of
+ * these groups. The BDs of a partition are only used for the blocks which map
+ * to this partition.
+ */
+typedef struct rtems_bdbuf_hash_slot
+{
+  const rtems_disk_device* dd;           /**< The device of the buffer. */
+  rtems_blkdev_bnum        block;        /**< The block of the buffer. */
+  rtems_bdbuf_buffer*      bd;           /**< The buffer, NULL if the slot is
+                                          * empty. */
+} rtems_bdbuf_hash_slot;
+
+typedef struct rtems_bdbuf_partition
+{
+  rtems_mutex         lock;              /**< The partition lock. It locks all
+                                          * partition data, BD and lists. */
+  char                name[16];          /**< The partition lock name. */
+  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
+                                          * root. */
+  rtems_bdbuf_hash_slot* hash;           /**< Buffer descriptor lookup hash
+                                          * table if the hash index is
+                                          * configured, otherwise NULL. */
+  size_t              hash_mask;         /**< The hash table size minus one. */
+  int                 hash_shift;        /**< The shift to get a hash table
+                                          * index from a hash value. */
+  rtems_chain_control lru;               /**< Least recently used list */
+  rtems_chain_control modified;          /**< Modified buffers list */
+  rtems_chain_control sync;              /**< Buffers to sync list */
+
+  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
+                                          * ACCESS_CACHED, ACCESS_MODIFIED or
+                                          * ACCESS_EMPTY
+                                          * state. */
+  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
+                                          * state. */
+  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
+                                          * available. */
+} rtems_bdbuf_partition;
+
 /**
  * The BD buffer cache.
  */
@@ -108,8 +148,11 @@ typedef struct rtems_bdbuf_cache
                                           * buffer size that fit in a group. */
   uint32_t            flags;             /**< Configuration flags. */
 
-  rtems_mutex         lock;              /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+  rtems_mutex         lock;              /**< The cache lock. It locks the
+                                          * sync state and the swapout
+                                          * workers. A partition lock may be
+                                          * held while the cache lock is
+                                          * obtained, but not vice versa. */
   rtems_mutex         sync_lock;         /**< Sync calls block writes. */
   bool                sync_active;       /**< True if a sync is active. */
   rtems_id            sync_requester;    /**< The sync requester. */
@@ -117,20 +160,11 @@ typedef struct rtems_bdbuf_cache
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
-  rtems_chain_control lru;               /**< Least recently used list */
-  rtems_chain_control modified;          /**< Modified buffers list */
-  rtems_chain_control sync;              /**< Buffers to sync list */
-
-  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
-                                          * ACCESS_CACHED, ACCESS_MODIFIED or
-                                          * ACCESS_EMPTY
-                                          * state. */
-  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
-                                          * state. */
-  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
-                                          * available. */
+  rtems_bdbuf_partition* partitions;     /**< The partitions. */
+  size_t              partition_count;   /**< The number of partitions. */
+  size_t              groups_per_partition; /**< The number of groups of each
+                                             * partition. The last partition
+                                             * gets the remaining groups. */
 
   rtems_bdbuf_swapout_transfer *swapout_transfer;
   rtems_bdbuf_swapout_worker *swapout_workers;
@@ -138,6 +172,9 @@ typedef struct rtems_bdbuf_cache
   size_t              group_count;       /**< The number of groups. */
   rtems_bdbuf_group*  groups;            /**< The groups. */
   rtems_id            read_ahead_task;   /**< Read-ahead task */
+  rtems_mutex         read_ahead_lock;   /**< Locks the read-ahead chain and
+                                          * the read-ahead state of the
+                                          * devices. */
   rtems_chain_control read_ahead_chain;  /**< Read-ahead request chain */
   bool                read_ahead_enabled; /**< Read-ahead enabled */
   rtems_status_code   init_status;       /**< The initialization status */
@@ -177,6 +214,11 @@ typedef enum {
 #define RTEMS_BDBUF_SWAPOUT_SYNC   RTEMS_EVENT_2
 #define RTEMS_BDBUF_READ_AHEAD_WAKE_UP RTEMS_EVENT_1
 
+/**
+ * The read-ahead window size in blocks of a new sequential stream.
+ */
+#define RTEMS_BDBUF_READ_AHEAD_WINDOW_INITIAL 4
+
 static rtems_task rtems_bdbuf_swapout_task(rtems_task_argument arg);
 
 static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
@@ -187,14 +229,16 @@ static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
 static rtems_bdbuf_cache bdbuf_cache = {
   .lock = RTEMS_MUTEX_INITIALIZER(NULL),
   .sync_lock = RTEMS_MUTEX_INITIALIZER(NULL),
-  .access_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
-  .transfer_waiters = {
-    .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL)
-  },
-  .buffer_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
+  .read_ahead_lock = RTEMS_MUTEX_INITIALIZER(NULL),
   .once = PTHREAD_ONCE_INIT
 };
 
+/**
+ * Locks the statistics of the disk devices.  The statistics are updated while
+ * different partitions are locked.
+ */
+RTEMS_INTERRUPT_LOCK_DEFINE (static, bdbuf_stats_lock, "bdbuf stats")
+
 #if RTEMS_BDBUF_TRACE
 /**
  * If true output the trace message.
@@ -228,21 +272,24 @@ rtems_bdbuf_show_usage (void)
 {
   uint32_t group;
   uint32_t total = 0;
-  uint32_t val;
+  uint32_t lru = 0;
+  uint32_t mod = 0;
+  uint32_t sync = 0;
+  size_t   p;
 
   for (group = 0; group < bdbuf_cache.group_count; group++)
     total += bdbuf_cache.groups[group].users;
   printf ("bdbuf:group users=%lu", total);
-  val = rtems_bdbuf_list_count (&bdbuf_cache.lru);
-  printf (", lru=%lu", val);
-  total = val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.modified);
-  printf (", mod=%lu", val);
-  total += val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.sync);
-  printf (", sync=%lu", val);
-  total += val;
-  printf (", total=%lu\n", total);
+  for (p = 0; p < bdbuf_cache.partition_count; p++)
+  {
+    lru += rtems_bdbuf_list_count (&bdbuf_cache.partitions[p].lru);
+    mod += rtems_bdbuf_list_count (&bdbuf_cache.partitions[p].modified);
+    sync += rtems_bdbuf_list_count (&bdbuf_cache.partitions[p].sync);
+  }
+  printf (", lru=%lu", lru);
+  printf (", mod=%lu", mod);
+  printf (", sync=%lu", sync);
+  printf (", total=%lu\n", lru + mod + sync);
 }
 
 /**
@@ -782,6 +829,189 @@ rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
   return 0;
 }
 
+/**
+ * Gets the hash table index of the specified dd/block.
+ *
+ * The Fibonacci hashing spreads consecutive blocks over the table.
+ *
+ * @param part The partition.
+ * @param dd disk device key
+ * @param block block key
+ * @return The hash table index.
+ */
+static size_t
+rtems_bdbuf_hash_index (const rtems_bdbuf_partition *part,
+                        const rtems_disk_device     *dd,
+                        rtems_blkdev_bnum            block)
+{
+  uint32_t hash;
+
+  hash = (uint32_t) ((uintptr_t) dd >> 4) * UINT32_C (0x85ebca6b);
+  hash ^= (uint32_t) block;
+  hash *= UINT32_C (0x9e3779b1);
+
+  return hash >> part->hash_shift;
+}
+
+/**
+ * Searches for the buffer with specified dd/block in the hash table.
+ *
+ * @param part The partition.
+ * @param dd disk device search key
+ * @param block block search key
+ * @retval NULL buffer with the specified dd/block is not found
+ * @return pointer to the buffer with specified dd/block
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_hash_search (const rtems_bdbuf_partition *part,
+                         const rtems_disk_device     *dd,
+                         rtems_blkdev_bnum            block)
+{
+  const rtems_bdbuf_hash_slot *hash = part->hash;
+  size_t                       i = rtems_bdbuf_hash_index (part, dd, block);
+
+  while (hash[i].bd != NULL)
+  {
+    if (hash[i].dd == dd && hash[i].block == block)
+      return hash[i].bd;
+
+    i = (i + 1) & part->hash_mask;
+  }
+
+  return NULL;
+}
+
+/**
+ * Inserts the specified buffer to the hash table.
+ *
+ * The hash table has more slots than the partition has buffers, so there is
+ * always an empty slot.
+ *
+ * @param part The partition.
+ * @param bd Pointer to the buffer to add.
+ * @retval 0 The buffer added successfully
+ * @retval -1 The buffer is already in the hash table
+ */
+static int
+rtems_bdbuf_hash_insert (rtems_bdbuf_partition *part,
+                         rtems_bdbuf_buffer    *bd)
+{
+  rtems_bdbuf_hash_slot *hash = part->hash;
+  size_t                 i = rtems_bdbuf_hash_index (part, bd->dd, bd->block);
+
+  while (hash[i].bd != NULL)
+  {
+    if (hash[i].dd == bd->dd && hash[i].block == bd->block)
+      return -1;
+
+    i = (i + 1) & part->hash_mask;
+  }
+
+  hash[i].dd = bd->dd;
+  hash[i].block = bd->block;
+  hash[i].bd = bd;
+
+  return 0;
+}
+
+/**
+ * Removes the specified buffer from the hash table.
+ *
+ * Instead of marking the slot as deleted, the following slots of the probe
+ * sequence are shifted backward.  This keeps the probe sequences short.
+ *
+ * @param part The partition.
+ * @param bd Pointer to the buffer to remove.
+ * @retval 0 The buffer removed successfully
+ * @retval -1 The buffer is not in the hash table
+ */
+static int
+rtems_bdbuf_hash_remove (rtems_bdbuf_partition    *part,
+                         const rtems_bdbuf_buffer *bd)
+{
+  rtems_bdbuf_hash_slot *hash = part->hash;
+  size_t                 mask = part->hash_mask;
+  size_t                 i = rtems_bdbuf_hash_index (part, bd->dd, bd->block);
+  size_t                 j;
+
+  while (hash[i].bd != bd)
+  {
+    if (hash[i].bd == NULL)
+      return -1;
+
+    i = (i + 1) & mask;
+  }
+
+  j = i;
+
+  while (true)
+  {
+    size_t k;
+
+    j = (j + 1) & mask;
+
+    if (hash[j].bd == NULL)
+      break;
+
+    k = rtems_bdbuf_hash_index (part, hash[j].dd, hash[j].block);
+
+    /*
+     * Move the entry of slot j to slot i, if its home slot k is not cyclically
+     * in (i, j].
+     */
+    if (((j - k) & mask) >= ((j - i) & mask))
+    {
+      hash[i] = hash[j];
+      i = j;
+    }
+  }
+
+  hash[i].bd = NULL;
+
+  return 0;
+}
+
+/**
+ * Searches for the buffer with specified dd/block in the index of the
+ * partition.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_index_search (rtems_bdbuf_partition   *part,
+                          const rtems_disk_device *dd,
+                          rtems_blkdev_bnum        block)
+{
+  if (part->hash != NULL)
+    return rtems_bdbuf_hash_search (part, dd, block);
+
+  return rtems_bdbuf_avl_search (&part->tree, dd, block);
+}
+
+/**
+ * Inserts the buffer to the index of the partition.
+ */
+static int
+rtems_bdbuf_index_insert (rtems_bdbuf_partition *part,
+                          rtems_bdbuf_buffer    *bd)
+{
+  if (part->hash != NULL)
+    return rtems_bdbuf_hash_insert (part, bd);
+
+  return rtems_bdbuf_avl_insert (&part->tree, bd);
+}
+
+/**
+ * Removes the buffer from the index of the partition.
+ */
+static int
+rtems_bdbuf_index_remove (rtems_bdbuf_partition *part,
+                          rtems_bdbuf_buffer    *bd)
+{
+  if (part->hash != NULL)
+    return rtems_bdbuf_hash_remove (part, bd);
+
+  return rtems_bdbuf_avl_remove (&part->tree, bd);
+}
+
 static void
 rtems_bdbuf_set_state (rtems_bdbuf_buffer *bd, rtems_bdbuf_buf_state state)
 {
@@ -842,6 +1072,75 @@ rtems_bdbuf_unlock_cache (void)
   rtems_bdbuf_unlock (&bdbuf_cache.lock);
 }
 
+/**
+ * Lock the partition.
+ *
+ * @param part The partition to lock.
+ */
+static void
+rtems_bdbuf_lock_partition (rtems_bdbuf_partition *part)
+{
+  rtems_bdbuf_lock (&part->lock);
+}
+
+/**
+ * Unlock the partition.
+ *
+ * @param part The partition to unlock.
+ */
+static void
+rtems_bdbuf_unlock_partition (rtems_bdbuf_partition *part)
+{
+  rtems_bdbuf_unlock (&part->lock);
+}
+
+/**
+ * Lock all partitions. The partitions are locked in ascending order. This is
+ * the only place where a task owns more than one partition lock.
+ */
+static void
+rtems_bdbuf_lock_all_partitions (void)
+{
+  size_t p;
+
+  for (p = 0; p < bdbuf_cache.partition_count; ++p)
+    rtems_bdbuf_lock_partition (&bdbuf_cache.partitions[p]);
+}
+
+/**
+ * Unlock all partitions.
+ */
+static void
+rtems_bdbuf_unlock_all_partitions (void)
+{
+  size_t p = bdbuf_cache.partition_count;
+
+  while (p > 0)
+  {
+    --p;
+    rtems_bdbuf_unlock_partition (&bdbuf_cache.partitions[p]);
+  }
+}
+
+/**
+ * Lock the read-ahead chain and state. The read-ahead lock may be obtained
+ * while a partition is locked but not the other way round.
+ */
+static void
+rtems_bdbuf_lock_read_ahead (void)
+{
+  rtems_bdbuf_lock (&bdbuf_cache.read_ahead_lock);
+}
+
+/**
+ * Unlock the read-ahead chain and state.
+ */
+static void
+rtems_bdbuf_unlock_read_ahead (void)
+{
+  rtems_bdbuf_unlock (&bdbuf_cache.read_ahead_lock);
+}
+
 /**
  * Lock the cache's sync. A single task can nest calls.
  */
@@ -860,6 +1159,95 @@ rtems_bdbuf_unlock_sync (void)
   rtems_bdbuf_unlock (&bdbuf_cache.sync_lock);
 }
 
+/**
+ * The number of consecutive media blocks mapped to the same partition. Multiple
+ * block transfers cannot cross the boundary of such a run of blocks.
+ */
+#define RTEMS_BDBUF_PARTITION_RUN_SHIFT 6
+
+/**
+ * Get the partition of a block.
+ *
+ * @param dd The disk device of the block.
+ * @param media_block The media block number of the block.
+ * @return The partition of the block.
+ */
+static rtems_bdbuf_partition *
+rtems_bdbuf_partition_of_block (const rtems_disk_device *dd,
+                                rtems_blkdev_bnum        media_block)
+{
+  uint32_t hash;
+
+  if (bdbuf_cache.partition_count == 1)
+    return &bdbuf_cache.partitions[0];
+
+  hash = (uint32_t) ((uintptr_t) dd >> 4)
+    ^ (uint32_t) (media_block >> RTEMS_BDBUF_PARTITION_RUN_SHIFT);
+  hash *= UINT32_C (0x9e3779b1);
+
+  return &bdbuf_cache.partitions[(hash >> 16) % bdbuf_cache.partition_count];
+}
+
+/**
+ * Get the partition which owns the BD.
+ *
+ * @param bd The BD.
+ * @return The partition of the group of the BD.
+ */
+static rtems_bdbuf_partition *
+rtems_bdbuf_partition_of_bd (const rtems_bdbuf_buffer *bd)
+{
+  size_t p = (size_t) (bd->group - bdbuf_cache.groups)
+    / bdbuf_cache.groups_per_partition;
+
+  if (p >= bdbuf_cache.partition_count)
+    p = bdbuf_cache.partition_count - 1;
+
+  return &bdbuf_cache.partitions[p];
+}
+
+/**
+ * Get the number of blocks starting at the media block up to the end of the
+ * run of media blocks mapped to the same partition.
+ *
+ * @param dd The disk device of the block.
+ * @param media_block The media block number of the block.
+ * @return The number of blocks which fit into a multiple block transfer.
+ */
+static uint32_t
+rtems_bdbuf_partition_run_blocks (const rtems_disk_device *dd,
+                                  rtems_blkdev_bnum        media_block)
+{
+  rtems_blkdev_bnum run_end;
+
+  if (bdbuf_cache.partition_count == 1)
+    return UINT32_MAX;
+
+  run_end = ((media_block >> RTEMS_BDBUF_PARTITION_RUN_SHIFT) + 1)
+    << RTEMS_BDBUF_PARTITION_RUN_SHIFT;
+
+  return (run_end - media_block + dd->media_blocks_per_block - 1)
+    / dd->media_blocks_per_block;
+}
+
+/**
+ * Lock the device statistics.
+ */
+static void
+rtems_bdbuf_lock_stats (rtems_interrupt_lock_context *lock_context)
+{
+  rtems_interrupt_lock_acquire (&bdbuf_stats_lock, lock_context);
+}
+
+/**
+ * Unlock the device statistics.
+ */
+static void
+rtems_bdbuf_unlock_stats (rtems_interrupt_lock_context *lock_context)
+{
+  rtems_interrupt_lock_release (&bdbuf_stats_lock, lock_context);
+}
+
 static void
 rtems_bdbuf_group_obtain (rtems_bdbuf_buffer *bd)
 {
@@ -878,34 +1266,37 @@ rtems_bdbuf_group_release (rtems_bdbuf_buffer *bd)
  * be woken and this would require storage and we do not know the number of
  * tasks that could be waiting.
  *
- * While we have the cache locked we can try and claim the semaphore and
- * therefore know when we release the lock to the cache we will block until the
- * semaphore is released. This may even happen before we get to block.
+ * While we have the partition locked we can try and claim the semaphore and
+ * therefore know when we release the lock to the partition we will block until
+ * the semaphore is released. This may even happen before we get to block.
  *
  * A counter is used to save the release call when no one is waiting.
  *
- * The function assumes the cache is locked on entry and it will be locked on
- * exit.
+ * The function assumes the partition is locked on entry and it will be locked
+ * on exit.
  */
 static void
-rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_anonymous_wait (rtems_bdbuf_partition *part,
+                            rtems_bdbuf_waiters   *waiters)
 {
   /*
    * Indicate we are waiting.
    */
   ++waiters->count;
 
-  rtems_condition_variable_wait (&waiters->cond_var, &bdbuf_cache.lock);
+  rtems_condition_variable_wait (&waiters->cond_var, &part->lock);
 
   --waiters->count;
 }
 
 static void
-rtems_bdbuf_wait (rtems_bdbuf_buffer *bd, rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_wait (rtems_bdbuf_partition *part,
+                  rtems_bdbuf_buffer    *bd,
+                  rtems_bdbuf_waiters   *waiters)
 {
   rtems_bdbuf_group_obtain (bd);
   ++bd->waiters;
-  rtems_bdbuf_anonymous_wait (waiters);
+  rtems_bdbuf_anonymous_wait (part, waiters);
   --bd->waiters;
   rtems_bdbuf_group_release (bd);
 }
@@ -933,27 +1324,29 @@ rtems_bdbuf_wake_swapper (void)
 }
 
 static bool
-rtems_bdbuf_has_buffer_waiters (void)
+rtems_bdbuf_has_buffer_waiters (const rtems_bdbuf_partition *part)
 {
-  return bdbuf_cache.buffer_waiters.count;
+  return part->buffer_waiters.count;
 }
 
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_tree (rtems_bdbuf_partition *part,
+                              rtems_bdbuf_buffer    *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_index_remove (part, bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_partition *part,
+                                           rtems_bdbuf_buffer    *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_tree (part, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
@@ -963,10 +1356,11 @@ rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_partition *part,
+                                           rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
-  rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_prepend_unprotected (&part->lru, &bd->link);
 }
 
 static void
@@ -976,30 +1370,54 @@ rtems_bdbuf_make_empty (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_partition *part,
+                                             rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
-  rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_append_unprotected (&part->lru, &bd->link);
 }
 
 static void
-rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer (rtems_bdbuf_partition *part,
+                            rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_make_empty (bd);
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
-    rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+    rtems_bdbuf_remove_from_tree (part, bd);
+    rtems_bdbuf_make_free_and_add_to_lru_list (part, bd);
   }
 }
 
+/**
+ * Check if a sync is active for the device. The sync state is owned by the
+ * cache lock. The caller may own a partition lock.
+ *
+ * @param dd The disk device.
+ *
+ * @retval true A sync is active for the device.
+ * @retval false Otherwise.
+ */
+static bool
+rtems_bdbuf_is_sync_active_for_device (const rtems_disk_device *dd)
+{
+  bool active;
+
+  rtems_bdbuf_lock_cache ();
+  active = bdbuf_cache.sync_active && bdbuf_cache.sync_device == dd;
+  rtems_bdbuf_unlock_cache ();
+
+  return active;
+}
+
 static void
-rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_partition *part,
+                                               rtems_bdbuf_buffer    *bd)
 {
-  if (bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd)
+  if (rtems_bdbuf_is_sync_active_for_device (bd->dd))
   {
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_partition (part);
 
     /*
      * Wait for the sync lock.
@@ -1007,7 +1425,7 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     rtems_bdbuf_lock_sync ();
 
     rtems_bdbuf_unlock_sync ();
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_partition (part);
   }
 
   /*
@@ -1026,24 +1444,25 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     bd->hold_timer = bdbuf_config.swap_block_hold;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_MODIFIED);
-  rtems_chain_append_unprotected (&bdbuf_cache.modified, &bd->link);
+  rtems_chain_append_unprotected (&part->modified, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
-  else if (rtems_bdbuf_has_buffer_waiters ())
+    rtems_bdbuf_wake (&part->access_waiters);
+  else if (rtems_bdbuf_has_buffer_waiters (part))
     rtems_bdbuf_wake_swapper ();
 }
 
 static void
-rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_partition *part,
+                                          rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_group_release (bd);
-  rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
+  rtems_bdbuf_make_cached_and_add_to_lru_list (part, bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&part->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&part->buffer_waiters);
 }
 
 /**
@@ -1071,28 +1490,32 @@ rtems_bdbuf_bds_per_group (size_t size)
 }
 
 static void
-rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_partition *part,
+                                         rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_group_release (bd);
-  rtems_bdbuf_discard_buffer (bd);
+  rtems_bdbuf_discard_buffer (part, bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&part->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&part->buffer_waiters);
 }
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
  * from the ALV tree and any lists then the new BD's are prepended to the ready
- * list of the cache.
+ * list of the partition.
  *
+ * @param part The partition of the group.
  * @param group The group to reallocate.
  * @param new_bds_per_group The new count of BDs per group.
  * @return A buffer of this group.
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
+rtems_bdbuf_group_realloc (rtems_bdbuf_partition *part,
+                           rtems_bdbuf_group     *group,
+                           size_t                 new_bds_per_group)
 {
   rtems_bdbuf_buffer* bd;
   size_t              b;
@@ -1108,7 +1531,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_tree_and_lru_list (part, bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1116,18 +1539,19 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 1, bd = group->bdbuf + bufs_per_bd;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+    rtems_bdbuf_make_free_and_add_to_lru_list (part, bd);
 
   if (b > 1)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&part->buffer_waiters);
 
   return group->bdbuf;
 }
 
 static void
-rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
-                                rtems_disk_device  *dd,
-                                rtems_blkdev_bnum   block)
+rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_partition *part,
+                                rtems_bdbuf_buffer    *bd,
+                                rtems_disk_device     *dd,
+                                rtems_blkdev_bnum      block)
 {
   bd->dd        = dd ;
   bd->block     = block;
@@ -1135,19 +1559,20 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
   bd->avl.right = NULL;
   bd->waiters   = 0;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_index_insert (part, bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_from_lru_list (rtems_bdbuf_partition *part,
+                                      rtems_disk_device     *dd,
+                                      rtems_blkdev_bnum      block)
 {
-  rtems_chain_node *node = rtems_chain_first (&bdbuf_cache.lru);
+  rtems_chain_node *node = rtems_chain_first (&part->lru);
 
-  while (!rtems_chain_is_tail (&bdbuf_cache.lru, node))
+  while (!rtems_chain_is_tail (&part->lru, node))
   {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
@@ -1165,17 +1590,18 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_remove_from_tree_and_lru_list (part, bd);
 
         empty_bd = bd;
       }
       else if (bd->group->users == 0)
-        empty_bd = rtems_bdbuf_group_realloc (bd->group, dd->bds_per_group);
+        empty_bd = rtems_bdbuf_group_realloc (part, bd->group,
+                                              dd->bds_per_group);
     }
 
     if (empty_bd != NULL)
     {
-      rtems_bdbuf_setup_empty_buffer (empty_bd, dd, block);
+      rtems_bdbuf_setup_empty_buffer (part, empty_bd, dd, block);
 
       return empty_bd;
     }
@@ -1325,19 +1751,11 @@ rtems_bdbuf_do_init (void)
   bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
 
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
-  rtems_chain_initialize_empty (&bdbuf_cache.lru);
-  rtems_chain_initialize_empty (&bdbuf_cache.modified);
-  rtems_chain_initialize_empty (&bdbuf_cache.sync);
   rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
 
   rtems_mutex_set_name (&bdbuf_cache.lock, "bdbuf lock");
   rtems_mutex_set_name (&bdbuf_cache.sync_lock, "bdbuf sync lock");
-  rtems_condition_variable_set_name (&bdbuf_cache.access_waiters.cond_var,
-                                     "bdbuf access");
-  rtems_condition_variable_set_name (&bdbuf_cache.transfer_waiters.cond_var,
-                                     "bdbuf transfer");
-  rtems_condition_variable_set_name (&bdbuf_cache.buffer_waiters.cond_var,
-                                     "bdbuf buffer");
+  rtems_mutex_set_name (&bdbuf_cache.read_ahead_lock, "bdbuf read-ahead");
 
   rtems_bdbuf_lock_cache ();
 
@@ -1351,6 +1769,73 @@ rtems_bdbuf_do_init (void)
   bdbuf_cache.group_count =
     bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
 
+  /*
+   * Each partition needs at least one group.
+   */
+  bdbuf_cache.partition_count = bdbuf_config.partitions;
+  if (bdbuf_cache.partition_count > bdbuf_cache.group_count)
+    bdbuf_cache.partition_count = bdbuf_cache.group_count;
+  if (bdbuf_cache.partition_count == 0)
+    bdbuf_cache.partition_count = 1;
+  bdbuf_cache.groups_per_partition =
+    bdbuf_cache.group_count / bdbuf_cache.partition_count;
+  if (bdbuf_cache.groups_per_partition == 0)
+    bdbuf_cache.groups_per_partition = 1;
+
+  /*
+   * Allocate the memory for the partitions.
+   */
+  bdbuf_cache.partitions = calloc (sizeof (rtems_bdbuf_partition),
+                                   bdbuf_cache.partition_count);
+  if (!bdbuf_cache.partitions)
+    goto error;
+
+  for (b = 0; b < bdbuf_cache.partition_count; b++)
+  {
+    rtems_bdbuf_partition *part = &bdbuf_cache.partitions[b];
+
+    snprintf (part->name, sizeof (part->name), "bdbuf part %zu", b);
+    rtems_mutex_init (&part->lock, part->name);
+    rtems_chain_initialize_empty (&part->lru);
+    rtems_chain_initialize_empty (&part->modified);
+    rtems_chain_initialize_empty (&part->sync);
+    rtems_condition_variable_init (&part->access_waiters.cond_var,
+                                   "bdbuf access");
+    rtems_condition_variable_init (&part->transfer_waiters.cond_var,
+                                   "bdbuf transfer");
+    rtems_condition_variable_init (&part->buffer_waiters.cond_var,
+                                   "bdbuf buffer");
+
+    if (bdbuf_config.hash_index)
+    {
+      size_t groups = bdbuf_cache.groups_per_partition;
+      size_t bds;
+      size_t slots = 2;
+      int    shift = 31;
+
+      if (b == bdbuf_cache.partition_count - 1)
+        groups = bdbuf_cache.group_count - b * bdbuf_cache.groups_per_partition;
+
+      /*
+       * Use at least twice the slots than buffers to keep the probe sequences
+       * short.
+       */
+      bds = groups * bdbuf_cache.max_bds_per_group;
+      while (slots < 2 * bds)
+      {
+        slots *= 2;
+        --shift;
+      }
+
+      part->hash = calloc (sizeof (rtems_bdbuf_hash_slot), slots);
+      if (!part->hash)
+        goto error;
+
+      part->hash_mask = slots - 1;
+      part->hash_shift = shift;
+    }
+  }
+
   /*
    * Allocate the memory for the buffer descriptors.
    */
@@ -1390,7 +1875,8 @@ rtems_bdbuf_do_init (void)
     bd->group  = group;
     bd->buffer = buffer;
 
-    rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+    rtems_chain_append_unprotected (&rtems_bdbuf_partition_of_bd (bd)->lru,
+                                    &bd->link);
 
     if ((b % bdbuf_cache.max_bds_per_group) ==
         (bdbuf_cache.max_bds_per_group - 1))
@@ -1488,9 +1974,24 @@ error:
     }
   }
 
+  if (bdbuf_cache.partitions)
+  {
+    for (b = 0; b < bdbuf_cache.partition_count; b++)
+    {
+      rtems_bdbuf_partition *part = &bdbuf_cache.partitions[b];
+
+      rtems_mutex_destroy (&part->lock);
+      rtems_condition_variable_destroy (&part->access_waiters.cond_var);
+      rtems_condition_variable_destroy (&part->transfer_waiters.cond_var);
+      rtems_condition_variable_destroy (&part->buffer_waiters.cond_var);
+      free (part->hash);
+    }
+  }
+
   free (bdbuf_cache.buffers);
   free (bdbuf_cache.groups);
   free (bdbuf_cache.bds);
+  free (bdbuf_cache.partitions);
   free (bdbuf_cache.swapout_transfer);
   free (bdbuf_cache.swapout_workers);
 
@@ -1543,7 +2044,8 @@ rtems_bdbuf_wait_for_transient_event (void)
 }
 
 static void
-rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_access (rtems_bdbuf_partition *part,
+                             rtems_bdbuf_buffer    *bd)
 {
   while (true)
   {
@@ -1561,12 +2063,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (part, bd, &part->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (part, bd, &part->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_7);
@@ -1575,11 +2077,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_partition *part,
+                                              rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
   rtems_chain_extract_unprotected (&bd->link);
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&part->sync, &bd->link);
   rtems_bdbuf_wake_swapper ();
 }
 
@@ -1590,7 +2093,8 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
  * @retval @c false Buffer is invalid and has to searched again.
  */
 static bool
-rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_recycle (rtems_bdbuf_partition *part,
+                              rtems_bdbuf_buffer    *bd)
 {
   while (true)
   {
@@ -1599,7 +2103,7 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_FREE:
         return true;
       case RTEMS_BDBUF_STATE_MODIFIED:
-        rtems_bdbuf_request_sync_for_modified_buffer (bd);
+        rtems_bdbuf_request_sync_for_modified_buffer (part, bd);
         break;
       case RTEMS_BDBUF_STATE_CACHED:
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -1613,19 +2117,19 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
            * pong with another recycle waiter.  The state of the buffer is
            * arbitrary afterwards.
            */
-          rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_anonymous_wait (part, &part->buffer_waiters);
           return false;
         }
       case RTEMS_BDBUF_STATE_ACCESS_CACHED:
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (part, bd, &part->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (part, bd, &part->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_8);
@@ -1634,7 +2138,8 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_partition *part,
+                                rtems_bdbuf_buffer    *bd)
 {
   while (true)
   {
@@ -1651,7 +2156,7 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (part, bd, &part->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_9);
@@ -1660,26 +2165,27 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_buffer (void)
+rtems_bdbuf_wait_for_buffer (rtems_bdbuf_partition *part)
 {
-  if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+  if (!rtems_chain_is_empty (&part->modified))
     rtems_bdbuf_wake_swapper ();
 
-  rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+  rtems_bdbuf_anonymous_wait (part, &part->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_sync_after_access (rtems_bdbuf_partition *part,
+                               rtems_bdbuf_buffer    *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
 
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&part->sync, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&part->access_waiters);
 
   rtems_bdbuf_wake_swapper ();
-  rtems_bdbuf_wait_for_sync_done (bd);
+  rtems_bdbuf_wait_for_sync_done (part, bd);
 
   /*
    * We may have created a cached or empty buffer which may be recycled.
@@ -1690,24 +2196,25 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
-      rtems_bdbuf_make_free_and_add_to_lru_list (bd);
+      rtems_bdbuf_remove_from_tree (part, bd);
+      rtems_bdbuf_make_free_and_add_to_lru_list (part, bd);
     }
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&part->buffer_waiters);
   }
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
-                                       rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_for_read_ahead (rtems_bdbuf_partition *part,
+                                       rtems_disk_device     *dd,
+                                       rtems_blkdev_bnum      block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_index_search (part, dd, block);
 
   if (bd == NULL)
   {
-    bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+    bd = rtems_bdbuf_get_buffer_from_lru_list (part, dd, block);
 
     if (bd != NULL)
       rtems_bdbuf_group_obtain (bd);
@@ -1723,39 +2230,40 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
-                                   rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_for_access (rtems_bdbuf_partition *part,
+                                   rtems_disk_device     *dd,
+                                   rtems_blkdev_bnum      block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_index_search (part, dd, block);
 
     if (bd != NULL)
     {
       if (bd->group->bds_per_group != dd->bds_per_group)
       {
-        if (rtems_bdbuf_wait_for_recycle (bd))
+        if (rtems_bdbuf_wait_for_recycle (part, bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
-          rtems_bdbuf_make_free_and_add_to_lru_list (bd);
-          rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_remove_from_tree_and_lru_list (part, bd);
+          rtems_bdbuf_make_free_and_add_to_lru_list (part, bd);
+          rtems_bdbuf_wake (&part->buffer_waiters);
         }
         bd = NULL;
       }
     }
     else
     {
-      bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+      bd = rtems_bdbuf_get_buffer_from_lru_list (part, dd, block);
 
       if (bd == NULL)
-        rtems_bdbuf_wait_for_buffer ();
+        rtems_bdbuf_wait_for_buffer (part);
     }
   }
   while (bd == NULL);
 
-  rtems_bdbuf_wait_for_access (bd);
+  rtems_bdbuf_wait_for_access (part, bd);
   rtems_bdbuf_group_obtain (bd);
 
   return bd;
@@ -1794,11 +2302,14 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
   rtems_bdbuf_buffer *bd = NULL;
   rtems_blkdev_bnum   media_block;
 
-  rtems_bdbuf_lock_cache ();
-
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
   {
+    rtems_bdbuf_partition *part =
+      rtems_bdbuf_partition_of_block (dd, media_block);
+
+    rtems_bdbuf_lock_partition (part);
+
     /*
      * Print the block index relative to the physical disk.
      */
@@ -1806,7 +2317,7 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       printf ("bdbuf:get: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (part, dd, media_block);
 
     switch (bd->state)
     {
@@ -1836,9 +2347,9 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       rtems_bdbuf_show_users ("get", bd);
       rtems_bdbuf_show_usage ();
     }
-  }
 
-  rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_partition (part);
+  }
 
   *bd_ptr = bd;
 
@@ -1862,18 +2373,72 @@ rtems_bdbuf_transfer_done (rtems_blkdev_request* req, rtems_status_code status)
   rtems_event_transient_send (req->io_task);
 }
 
-static rtems_status_code
-rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
-                                      rtems_blkdev_request *req,
-                                      bool                  cache_locked)
+/**
+ * Complete the transfer of buffers which belong to the same partition. The
+ * partition must be locked.
+ *
+ * @param part The partition of the buffers.
+ * @param bufs The transferred buffers.
+ * @param bufnum The number of transferred buffers.
+ * @param sc The status of the transfer.
+ */
+static void
+rtems_bdbuf_transfer_buffers_done (rtems_bdbuf_partition  *part,
+                                   rtems_blkdev_sg_buffer *bufs,
+                                   uint32_t                bufnum,
+                                   rtems_status_code       sc)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
   uint32_t transfer_index = 0;
   bool wake_transfer_waiters = false;
   bool wake_buffer_waiters = false;
 
-  if (cache_locked)
-    rtems_bdbuf_unlock_cache ();
+  for (transfer_index = 0; transfer_index < bufnum; ++transfer_index)
+  {
+    rtems_bdbuf_buffer *bd = bufs [transfer_index].user;
+    bool waiters = bd->waiters;
+
+    if (waiters)
+      wake_transfer_waiters = true;
+    else
+      wake_buffer_waiters = true;
+
+    rtems_bdbuf_group_release (bd);
+
+    if (sc == RTEMS_SUCCESSFUL && bd->state == RTEMS_BDBUF_STATE_TRANSFER)
+      rtems_bdbuf_make_cached_and_add_to_lru_list (part, bd);
+    else
+      rtems_bdbuf_discard_buffer (part, bd);
+
+    if (rtems_bdbuf_tracer)
+      rtems_bdbuf_show_users ("transfer", bd);
+  }
+
+  if (wake_transfer_waiters)
+    rtems_bdbuf_wake (&part->transfer_waiters);
+
+  if (wake_buffer_waiters)
+    rtems_bdbuf_wake (&part->buffer_waiters);
+}
+
+/**
+ * Execute a transfer request.
+ *
+ * @param dd The disk device.
+ * @param req The transfer request.
+ * @param part The partition of all buffers of the request which is locked by
+ * the caller, otherwise NULL. In this case, the buffers may belong to
+ * different partitions and no partition is locked.
+ */
+static rtems_status_code
+rtems_bdbuf_execute_transfer_request (rtems_disk_device     *dd,
+                                      rtems_blkdev_request  *req,
+                                      rtems_bdbuf_partition *part)
+{
+  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_interrupt_lock_context lock_context;
+
+  if (part != NULL)
+    rtems_bdbuf_unlock_partition (part);
 
   /* The return value will be ignored for transfer requests */
   dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
@@ -1882,9 +2447,8 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
   rtems_bdbuf_wait_for_transient_event ();
   sc = req->status;
 
-  rtems_bdbuf_lock_cache ();
-
   /* Statistics */
+  rtems_bdbuf_lock_stats (&lock_context);
   if (req->req == RTEMS_BLKDEV_REQ_READ)
   {
     dd->stats.read_blocks += req->bufnum;
@@ -1898,47 +2462,59 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     if (sc != RTEMS_SUCCESSFUL)
       ++dd->stats.write_errors;
   }
+  rtems_bdbuf_unlock_stats (&lock_context);
 
-  for (transfer_index = 0; transfer_index < req->bufnum; ++transfer_index)
+  if (part != NULL)
   {
-    rtems_bdbuf_buffer *bd = req->bufs [transfer_index].user;
-    bool waiters = bd->waiters;
+    rtems_bdbuf_lock_partition (part);
+    rtems_bdbuf_transfer_buffers_done (part, req->bufs, req->bufnum, sc);
+  }
+  else
+  {
+    uint32_t transfer_index = 0;
 
-    if (waiters)
-      wake_transfer_waiters = true;
-    else
-      wake_buffer_waiters = true;
+    /*
+     * Complete the buffers partition by partition.  Buffers of the same
+     * partition are usually adjacent in the request.
+     */
+    while (transfer_index < req->bufnum)
+    {
+      uint32_t first = transfer_index;
 
-    rtems_bdbuf_group_release (bd);
+      part = rtems_bdbuf_partition_of_bd (req->bufs [first].user);
 
-    if (sc == RTEMS_SUCCESSFUL && bd->state == RTEMS_BDBUF_STATE_TRANSFER)
-      rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
-    else
-      rtems_bdbuf_discard_buffer (bd);
+      do
+        ++transfer_index;
+      while (transfer_index < req->bufnum
+             && rtems_bdbuf_partition_of_bd (req->bufs [transfer_index].user)
+               == part);
 
-    if (rtems_bdbuf_tracer)
-      rtems_bdbuf_show_users ("transfer", bd);
+      rtems_bdbuf_lock_partition (part);
+      rtems_bdbuf_transfer_buffers_done (part, &req->bufs [first],
+                                         transfer_index - first, sc);
+      rtems_bdbuf_unlock_partition (part);
+    }
   }
 
-  if (wake_transfer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
-
-  if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
-
-  if (!cache_locked)
-    rtems_bdbuf_unlock_cache ();
-
   if (sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED)
     return sc;
   else
     return RTEMS_IO_ERROR;
 }
 
+/**
+ * Execute a read request for the buffer and the following blocks. All blocks
+ * must belong to the partition, see rtems_bdbuf_partition_run_blocks(). The
+ * partition must be locked. The request ends at the first block which is
+ * already in the cache. The count of blocks in the request is stored in
+ * transferred if it is not NULL.
+ */
 static rtems_status_code
-rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
-                                  rtems_bdbuf_buffer *bd,
-                                  uint32_t            transfer_count)
+rtems_bdbuf_execute_read_request (rtems_bdbuf_partition *part,
+                                  rtems_disk_device     *dd,
+                                  rtems_bdbuf_buffer    *bd,
+                                  uint32_t               transfer_count,
+                                  uint32_t              *transferred)
 {
   rtems_blkdev_request *req = NULL;
   rtems_blkdev_bnum media_block = bd->block;
@@ -1972,7 +2548,8 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
   {
     media_block += media_blocks_per_block;
 
-    bd = rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+    _Assert (rtems_bdbuf_partition_of_block (dd, media_block) == part);
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (part, dd, media_block);
 
     if (bd == NULL)
       break;
@@ -1992,7 +2569,10 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
 
   req->bufnum = transfer_index;
 
-  return rtems_bdbuf_execute_transfer_request (dd, req, true);
+  if (transferred != NULL)
+    *transferred = transfer_index;
+
+  return rtems_bdbuf_execute_transfer_request (dd, req, part);
 }
 
 static bool
@@ -2014,43 +2594,111 @@ rtems_bdbuf_read_ahead_cancel (rtems_disk_device *dd)
 static void
 rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
 {
+  rtems_bdbuf_lock_read_ahead ();
   rtems_bdbuf_read_ahead_cancel (dd);
   dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  dd->read_ahead.begin = dd->read_ahead.end;
+  rtems_bdbuf_unlock_read_ahead ();
 }
 
 static void
 rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
                                       rtems_blkdev_bnum  block)
 {
+  /*
+   * Check the trigger without the read-ahead lock first to avoid a lock
+   * operation for each read.  A trigger set concurrently is checked again.
+   */
   if (bdbuf_cache.read_ahead_task != 0
-      && dd->read_ahead.trigger == block
-      && !rtems_bdbuf_is_read_ahead_active (dd))
+      && dd->read_ahead.trigger == block)
   {
-    rtems_status_code sc;
-    rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+    rtems_bdbuf_lock_read_ahead ();
 
-    if (rtems_chain_is_empty (chain))
+    if (dd->read_ahead.trigger == block
+        && !rtems_bdbuf_is_read_ahead_active (dd))
     {
-      sc = rtems_event_send (bdbuf_cache.read_ahead_task,
-                             RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-      if (sc != RTEMS_SUCCESSFUL)
-        rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
+      rtems_status_code sc;
+      rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+
+      if (rtems_chain_is_empty (chain))
+      {
+        sc = rtems_event_send (bdbuf_cache.read_ahead_task,
+                               RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
+        if (sc != RTEMS_SUCCESSFUL)
+          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
+      }
+
+      rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
     }
 
-    rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
+    rtems_bdbuf_unlock_read_ahead ();
   }
 }
 
+static bool
+rtems_bdbuf_is_in_read_ahead_window (const rtems_disk_device *dd,
+                                     rtems_blkdev_bnum        block)
+{
+  return block - dd->read_ahead.begin
+    < dd->read_ahead.end - dd->read_ahead.begin;
+}
+
 static void
 rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
                                     rtems_blkdev_bnum  block)
 {
+  rtems_bdbuf_lock_read_ahead ();
+
   if (dd->read_ahead.trigger != block)
   {
+    if (rtems_bdbuf_is_in_read_ahead_window (dd, block))
+    {
+      rtems_interrupt_lock_context lock_context;
+
+      /*
+       * The read-ahead blocks were removed from the cache before use, so
+       * shrink the window.
+       */
+      rtems_bdbuf_lock_stats (&lock_context);
+      ++dd->stats.read_ahead_misses;
+      rtems_bdbuf_unlock_stats (&lock_context);
+
+      dd->read_ahead.window = (dd->read_ahead.window + 1) / 2;
+    }
+    else
+    {
+      /*
+       * This is a new stream, so start with a small window.
+       */
+      dd->read_ahead.window = RTEMS_BDBUF_READ_AHEAD_WINDOW_INITIAL;
+      if (dd->read_ahead.window > bdbuf_config.max_read_ahead_blocks)
+        dd->read_ahead.window = bdbuf_config.max_read_ahead_blocks;
+    }
+
     rtems_bdbuf_read_ahead_cancel (dd);
     dd->read_ahead.trigger = block + 1;
     dd->read_ahead.next = block + 2;
+    dd->read_ahead.begin = dd->read_ahead.end;
   }
+
+  rtems_bdbuf_unlock_read_ahead ();
+}
+
+static void
+rtems_bdbuf_count_read_hit (rtems_disk_device *dd,
+                            rtems_blkdev_bnum  block)
+{
+  rtems_interrupt_lock_context lock_context;
+
+  /*
+   * The read-ahead window is checked without the read-ahead lock.  A
+   * concurrent change of the window may only lead to an imprecise statistic.
+   */
+  rtems_bdbuf_lock_stats (&lock_context);
+  ++dd->stats.read_hits;
+  if (rtems_bdbuf_is_in_read_ahead_window (dd, block))
+    ++dd->stats.read_ahead_hits;
+  rtems_bdbuf_unlock_stats (&lock_context);
 }
 
 rtems_status_code
@@ -2062,30 +2710,36 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
   rtems_bdbuf_buffer   *bd = NULL;
   rtems_blkdev_bnum     media_block;
 
-  rtems_bdbuf_lock_cache ();
-
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
   {
+    rtems_bdbuf_partition        *part =
+      rtems_bdbuf_partition_of_block (dd, media_block);
+    rtems_interrupt_lock_context  lock_context;
+
+    rtems_bdbuf_lock_partition (part);
+
     if (rtems_bdbuf_tracer)
       printf ("bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (part, dd, media_block);
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
-        ++dd->stats.read_hits;
+        rtems_bdbuf_count_read_hit (dd, block);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
-        ++dd->stats.read_hits;
+        rtems_bdbuf_count_read_hit (dd, block);
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
+        rtems_bdbuf_lock_stats (&lock_context);
         ++dd->stats.read_misses;
+        rtems_bdbuf_unlock_stats (&lock_context);
         rtems_bdbuf_set_read_ahead_trigger (dd, block);
-        sc = rtems_bdbuf_execute_read_request (dd, bd, 1);
+        sc = rtems_bdbuf_execute_read_request (part, dd, bd, 1, NULL);
         if (sc == RTEMS_SUCCESSFUL)
         {
           rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
@@ -2103,9 +2757,9 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
     }
 
     rtems_bdbuf_check_read_ahead_trigger (dd, block);
-  }
 
-  rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_partition (part);
+  }
 
   *bd_ptr = bd;
 
@@ -2113,7 +2767,9 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
 }
 
 static rtems_status_code
-rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
+rtems_bdbuf_check_bd_and_lock_partition (rtems_bdbuf_buffer     *bd,
+                                         const char             *kind,
+                                         rtems_bdbuf_partition **part)
 {
   if (bd == NULL)
     return RTEMS_INVALID_ADDRESS;
@@ -2122,7 +2778,8 @@ rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
     printf ("bdbuf:%s: %" PRIu32 "\n", kind, bd->block);
     rtems_bdbuf_show_users (kind, bd);
   }
-  rtems_bdbuf_lock_cache();
+  *part = rtems_bdbuf_partition_of_bd (bd);
+  rtems_bdbuf_lock_partition (*part);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2131,22 +2788,23 @@ rtems_status_code
 rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *part;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release");
+  sc = rtems_bdbuf_check_bd_and_lock_partition (bd, "release", &part);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-      rtems_bdbuf_add_to_lru_list_after_access (bd);
+      rtems_bdbuf_add_to_lru_list_after_access (part, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (part, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (part, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_0);
@@ -2156,7 +2814,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (part);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2165,8 +2823,9 @@ rtems_status_code
 rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *part;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release modified");
+  sc = rtems_bdbuf_check_bd_and_lock_partition (bd, "release modified", &part);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2175,10 +2834,10 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (part, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (part, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_6);
@@ -2188,7 +2847,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (part);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2197,8 +2856,9 @@ rtems_status_code
 rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 {
   rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_partition *part;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "sync");
+  sc = rtems_bdbuf_check_bd_and_lock_partition (bd, "sync", &part);
   if (sc != RTEMS_SUCCESSFUL)
     return sc;
 
@@ -2207,10 +2867,10 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_sync_after_access (bd);
+      rtems_bdbuf_sync_after_access (part, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (part, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_5);
@@ -2220,7 +2880,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_partition (part);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2348,7 +3008,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
 
       if (write)
       {
-        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, false);
+        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, NULL);
 
         transfer->write_req.status = RTEMS_RESOURCE_IN_USE;
         transfer->write_req.bufnum = 0;
@@ -2372,6 +3032,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  * Process the modified list of buffers. There is a sync or modified list that
  * needs to be handled so we have a common function to do the work.
  *
+ * @param part The partition of the chain. The partition must be locked.
  * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
  * device is selected so select the device of the first buffer to be written to
  * disk.
@@ -2383,7 +3044,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  *                    amount.
  */
 static void
-rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
+rtems_bdbuf_swapout_modified_processing (rtems_bdbuf_partition* part,
+                                         rtems_disk_device  **dd_ptr,
                                          rtems_chain_control* chain,
                                          rtems_chain_control* transfer,
                                          bool                 sync_active,
@@ -2417,7 +3079,7 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
        *       on TOD to be accurate. Does it matter ?
        */
       if (sync_all || (sync_active && (*dd_ptr == bd->dd))
-          || rtems_bdbuf_has_buffer_waiters ())
+          || rtems_bdbuf_has_buffer_waiters (part))
         bd->hold_timer = 0;
 
       if (bd->hold_timer)
@@ -2513,6 +3175,7 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   rtems_bdbuf_swapout_worker* worker;
   bool                        transfered_buffers = false;
   bool                        sync_active;
+  size_t                      p;
 
   rtems_bdbuf_lock_cache ();
 
@@ -2552,32 +3215,43 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
   if (sync_active)
     transfer->dd = bdbuf_cache.sync_device;
 
-  /*
-   * If we have any buffers in the sync queue move them to the modified
-   * list. The first sync buffer will select the device we use.
-   */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.sync,
-                                           &transfer->bds,
-                                           true, false,
-                                           timer_delta);
+  rtems_bdbuf_unlock_cache ();
 
   /*
-   * Process the cache's modified list.
+   * Gather the buffers partition by partition.  Each partition is unlocked
+   * after its lists have been processed because the state of each gathered
+   * buffer has been set to TRANSFER.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.modified,
-                                           &transfer->bds,
-                                           sync_active,
-                                           update_timers,
-                                           timer_delta);
+  for (p = 0; p < bdbuf_cache.partition_count; ++p)
+  {
+    rtems_bdbuf_partition *part = &bdbuf_cache.partitions[p];
 
-  /*
-   * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
-   * TRANSFER.
-   */
-  rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_lock_partition (part);
+
+    /*
+     * If we have any buffers in the sync queue move them to the modified
+     * list. The first sync buffer will select the device we use.
+     */
+    rtems_bdbuf_swapout_modified_processing (part,
+                                             &transfer->dd,
+                                             &part->sync,
+                                             &transfer->bds,
+                                             true, false,
+                                             timer_delta);
+
+    /*
+     * Process the partition's modified list.
+     */
+    rtems_bdbuf_swapout_modified_processing (part,
+                                             &transfer->dd,
+                                             &part->modified,
+                                             &transfer->bds,
+                                             sync_active,
+                                             update_timers,
+                                             timer_delta);
+
+    rtems_bdbuf_unlock_partition (part);
+  }
 
   /*
    * If there are buffers to transfer to the media transfer them.
@@ -2750,7 +3424,8 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
 }
 
 static void
-rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
+rtems_bdbuf_purge_list (rtems_bdbuf_partition *part,
+                        rtems_chain_control   *purge_list)
 {
   bool wake_buffer_waiters = false;
   rtems_chain_node *node = NULL;
@@ -2762,56 +3437,80 @@ rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
     if (bd->waiters == 0)
       wake_buffer_waiters = true;
 
-    rtems_bdbuf_discard_buffer (bd);
+    rtems_bdbuf_discard_buffer (part, bd);
   }
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&part->buffer_waiters);
 }
 
+/**
+ * Gather the buffer of the device for purge.
+ */
 static void
-rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
+rtems_bdbuf_gather_buffer_for_purge (rtems_bdbuf_partition   *part,
+                                     rtems_chain_control     *purge_list,
+                                     rtems_bdbuf_buffer      *bd)
+{
+  switch (bd->state)
+  {
+    case RTEMS_BDBUF_STATE_FREE:
+    case RTEMS_BDBUF_STATE_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+    case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+      break;
+    case RTEMS_BDBUF_STATE_SYNC:
+      rtems_bdbuf_wake (&part->transfer_waiters);
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_MODIFIED:
+      rtems_bdbuf_group_release (bd);
+      /* Fall through */
+    case RTEMS_BDBUF_STATE_CACHED:
+      rtems_chain_extract_unprotected (&bd->link);
+      rtems_chain_append_unprotected (purge_list, &bd->link);
+      break;
+    case RTEMS_BDBUF_STATE_TRANSFER:
+      rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
+      break;
+    case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+    case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+    case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+      rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_PURGED);
+      break;
+    default:
+      rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
+  }
+}
+
+static void
+rtems_bdbuf_gather_for_purge (rtems_bdbuf_partition   *part,
+                              rtems_chain_control     *purge_list,
                               const rtems_disk_device *dd)
 {
   rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
   rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  rtems_bdbuf_buffer *cur = part->tree;
+
+  if (part->hash != NULL)
+  {
+    size_t i;
+
+    for (i = 0; i <= part->hash_mask; ++i)
+    {
+      if (part->hash[i].bd != NULL && part->hash[i].dd == dd)
+        rtems_bdbuf_gather_buffer_for_purge (part, purge_list,
+                                             part->hash[i].bd);
+    }
+
+    return;
+  }
 
   *prev = NULL;
 
   while (cur != NULL)
   {
     if (cur->dd == dd)
-    {
-      switch (cur->state)
-      {
-        case RTEMS_BDBUF_STATE_FREE:
-        case RTEMS_BDBUF_STATE_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-          break;
-        case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_MODIFIED:
-          rtems_bdbuf_group_release (cur);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_CACHED:
-          rtems_chain_extract_unprotected (&cur->link);
-          rtems_chain_append_unprotected (purge_list, &cur->link);
-          break;
-        case RTEMS_BDBUF_STATE_TRANSFER:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
-          break;
-        case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-        case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
-          break;
-        default:
-          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
-      }
-    }
+      rtems_bdbuf_gather_buffer_for_purge (part, purge_list, cur);
 
     if (cur->avl.left != NULL)
     {
@@ -2846,23 +3545,33 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
   }
 }
 
+/**
+ * Purge the device. All partitions must be locked.
+ */
 static void
 rtems_bdbuf_do_purge_dev (rtems_disk_device *dd)
 {
-  rtems_chain_control purge_list;
+  size_t p;
 
-  rtems_chain_initialize_empty (&purge_list);
   rtems_bdbuf_read_ahead_reset (dd);
-  rtems_bdbuf_gather_for_purge (&purge_list, dd);
-  rtems_bdbuf_purge_list (&purge_list);
+
+  for (p = 0; p < bdbuf_cache.partition_count; ++p)
+  {
+    rtems_bdbuf_partition *part = &bdbuf_cache.partitions[p];
+    rtems_chain_control    purge_list;
+
+    rtems_chain_initialize_empty (&purge_list);
+    rtems_bdbuf_gather_for_purge (part, &purge_list, dd);
+    rtems_bdbuf_purge_list (part, &purge_list);
+  }
 }
 
 void
 rtems_bdbuf_purge_dev (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_partitions ();
   rtems_bdbuf_do_purge_dev (dd);
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_partitions ();
 }
 
 rtems_status_code
@@ -2879,7 +3588,7 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
   if (sync)
     rtems_bdbuf_syncdev (dd);
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_all_partitions ();
 
   if (block_size > 0)
   {
@@ -2899,11 +3608,16 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
       if ((dd->media_block_size << block_to_media_block_shift) != block_size)
         block_to_media_block_shift = -1;
 
+      /*
+       * The read-ahead task uses the block count without a partition lock.
+       */
+      rtems_bdbuf_lock_read_ahead ();
       dd->block_size = block_size;
       dd->block_count = dd->size / media_blocks_per_block;
       dd->media_blocks_per_block = media_blocks_per_block;
       dd->block_to_media_block_shift = block_to_media_block_shift;
       dd->bds_per_group = bds_per_group;
+      rtems_bdbuf_unlock_read_ahead ();
 
       rtems_bdbuf_do_purge_dev (dd);
     }
@@ -2917,11 +3631,73 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
     sc = RTEMS_INVALID_NUMBER;
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_all_partitions ();
 
   return sc;
 }
 
+/**
+ * Read ahead the blocks of the device. The transfer is split at the boundaries
+ * of the partitions and at blocks already in the cache. No lock is owned by
+ * the caller.
+ *
+ * @param dd The device.
+ * @param block The first block to read.
+ * @param transfer_count The number of blocks to read.
+ */
+static void
+rtems_bdbuf_read_ahead (rtems_disk_device *dd,
+                        rtems_blkdev_bnum  block,
+                        uint32_t           transfer_count)
+{
+  while (transfer_count > 0)
+  {
+    rtems_blkdev_bnum media_block = 0;
+    rtems_status_code sc =
+      rtems_bdbuf_get_media_block (dd, block, &media_block);
+    rtems_bdbuf_partition *part;
+    rtems_bdbuf_buffer *bd;
+    uint32_t count;
+
+    if (sc != RTEMS_SUCCESSFUL)
+      break;
+
+    part = rtems_bdbuf_partition_of_block (dd, media_block);
+    count = rtems_bdbuf_partition_run_blocks (dd, media_block);
+
+    if (count > transfer_count)
+      count = transfer_count;
+
+    rtems_bdbuf_lock_partition (part);
+
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (part, dd, media_block);
+
+    if (bd != NULL)
+    {
+      rtems_interrupt_lock_context lock_context;
+
+      rtems_bdbuf_execute_read_request (part, dd, bd, count, &count);
+
+      rtems_bdbuf_lock_stats (&lock_context);
+      ++dd->stats.read_ahead_transfers;
+      dd->stats.read_ahead_blocks += count;
+      rtems_bdbuf_unlock_stats (&lock_context);
+    }
+    else
+    {
+      /*
+       * Skip the block in the cache and continue with the next one.
+       */
+      count = 1;
+    }
+
+    rtems_bdbuf_unlock_partition (part);
+
+    block += count;
+    transfer_count -= count;
+  }
+}
+
 static rtems_task
 rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 {
@@ -2932,51 +3708,66 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
     rtems_chain_node *node;
 
     rtems_bdbuf_wait_for_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_read_ahead ();
 
     while ((node = rtems_chain_get_unprotected (chain)) != NULL)
     {
       rtems_disk_device *dd =
         RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
       rtems_blkdev_bnum block = dd->read_ahead.next;
-      rtems_blkdev_bnum media_block = 0;
-      rtems_status_code sc =
-        rtems_bdbuf_get_media_block (dd, block, &media_block);
+      uint32_t transfer_count = 0;
 
       rtems_chain_set_off_chain (&dd->read_ahead.node);
 
-      if (sc == RTEMS_SUCCESSFUL)
+      if (block < dd->block_count)
       {
-        rtems_bdbuf_buffer *bd =
-          rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+        uint32_t window = dd->read_ahead.window;
 
-        if (bd != NULL)
+        /*
+         * The reader arrived at the trigger within the previous window without
+         * a miss, so grow the window.
+         */
+        if (dd->read_ahead.begin != dd->read_ahead.end)
         {
-          uint32_t transfer_count = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+          window *= 2;
+          if (window > bdbuf_config.max_read_ahead_blocks)
+            window = bdbuf_config.max_read_ahead_blocks;
+        }
 
-          if (transfer_count >= max_transfer_count)
-          {
-            transfer_count = max_transfer_count;
-            dd->read_ahead.trigger = block + transfer_count / 2;
-            dd->read_ahead.next = block + transfer_count;
-          }
-          else
-          {
-            dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
-          }
+        if (window == 0)
+          window = 1;
+
+        dd->read_ahead.window = window;
+        transfer_count = dd->block_count - block;
 
-          ++dd->stats.read_ahead_transfers;
-          rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
+        if (transfer_count >= window)
+        {
+          transfer_count = window;
+          dd->read_ahead.trigger = block + transfer_count / 2;
+          dd->read_ahead.next = block + transfer_count;
+        }
+        else
+        {
+          dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
         }
+
+        dd->read_ahead.begin = block;
+        dd->read_ahead.end = block + transfer_count;
       }
       else
       {
         dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
       }
+
+      /*
+       * Do not own the read-ahead lock while a partition is locked.
+       */
+      rtems_bdbuf_unlock_read_ahead ();
+      rtems_bdbuf_read_ahead (dd, block, transfer_count);
+      rtems_bdbuf_lock_read_ahead ();
     }
 
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_read_ahead ();
   }
 
   rtems_task_exit();
@@ -2985,14 +3776,18 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 void rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
                                    rtems_blkdev_stats      *stats)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_bdbuf_lock_stats (&lock_context);
   *stats = dd->stats;
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_stats (&lock_context);
 }
 
 void rtems_bdbuf_reset_device_stats (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_interrupt_lock_context lock_context;
+
+  rtems_bdbuf_lock_stats (&lock_context);
   memset (&dd->stats, 0, sizeof(dd->stats));
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_stats (&lock_context);
 }
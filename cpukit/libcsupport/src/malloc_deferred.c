@@ -35,6 +35,8 @@ static RTEMS_CHAIN_DEFINE_EMPTY( _Malloc_GC_list );
 
 RTEMS_INTERRUPT_LOCK_DEFINE( static, _Malloc_GC_lock, "Malloc GC" )
 
+const Malloc_Cache_operations *_Malloc_Cache;
+
 Malloc_System_state _Malloc_System_state( void )
 {
   System_state_Codes state = _System_state_Get();
@@ -87,6 +89,15 @@ void *rtems_heap_allocate_aligned_with_boundary(
 
   switch ( _Malloc_System_state() ) {
     case MALLOC_SYSTEM_STATE_NORMAL:
+      if ( _Malloc_Cache != NULL && alignment == 0 && boundary == 0 ) {
+        _Malloc_Process_deferred_frees();
+        p = ( *_Malloc_Cache->allocate )( size );
+
+        if ( p != NULL ) {
+          break;
+        }
+      }
+
       _RTEMS_Lock_allocator();
       _Malloc_Process_deferred_frees();
       p = _Heap_Allocate_aligned_with_boundary(
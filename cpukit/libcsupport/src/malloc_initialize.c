@@ -18,6 +18,7 @@
 #endif
 
 #include <rtems/malloc.h>
+#include <rtems/score/heapimpl.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/sysinit.h>
 
@@ -36,6 +37,11 @@ RTEMS_SYSINIT_ITEM(
   RTEMS_SYSINIT_ORDER_MIDDLE
 );
 
+void _Malloc_Enable_segregated_fit( void )
+{
+  (void) _Heap_Free_index_enable( RTEMS_Malloc_Heap );
+}
+
 #ifdef RTEMS_NEWLIB
 static Heap_Control _Malloc_Heap;
 
@@ -29,6 +29,38 @@ void _Malloc_Deferred_free( void * );
 
 void _Malloc_Process_deferred_frees( void );
 
+/**
+ * @brief Operations of the per-processor caches of the C program heap.
+ */
+typedef struct {
+  /**
+   * @brief Tries to allocate an object of the specified size from the cache
+   * of the current processor.
+   *
+   * Returns NULL if the cache cannot satisfy the request.  In this case, the
+   * request shall be satisfied by the C program heap directly.
+   */
+  void *( *allocate )( size_t size );
+
+  /**
+   * @brief Tries to free the object to the cache of the current processor.
+   *
+   * Returns false if the object was not handed out by the caches.  In this
+   * case, the object shall be freed to the C program heap directly which
+   * reports invalid pointers.  A free of an object which is already in a cache
+   * ends with the RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE fatal error.
+   */
+  bool ( *free )( void *ptr );
+} Malloc_Cache_operations;
+
+/**
+ * @brief The operations of the per-processor caches, or NULL if the caches
+ * are not enabled.
+ *
+ * @see _Malloc_Cache_initialize().
+ */
+extern const Malloc_Cache_operations *_Malloc_Cache;
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
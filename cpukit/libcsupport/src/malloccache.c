@@ -0,0 +1,430 @@
+/**
+ * @file
+ *
+ * @ingroup MallocSupport
+ *
+ * @brief Per-Processor Caches of the C Program Heap
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include "malloc_p.h"
+
+#include <limits.h>
+
+#include <rtems/config.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/isrlevel.h>
+#include <rtems/score/percpudata.h>
+
+/*
+ * The size classes are the powers of two starting with 16 bytes.
+ */
+#define MALLOC_CACHE_MIN_SHIFT 4
+
+#define MALLOC_CACHE_CLASS_COUNT 8
+
+#define MALLOC_CACHE_MAX_SIZE \
+  ( (size_t) 1 << ( MALLOC_CACHE_MIN_SHIFT + MALLOC_CACHE_CLASS_COUNT - 1 ) )
+
+/*
+ * This is the maximum count of objects moved between a cache and the heap
+ * while the allocator lock is owned.
+ */
+#define MALLOC_CACHE_BATCH_MAX 8
+
+/*
+ * Each object handed out by the caches is allocated from the heap with room
+ * for a tag word directly after its size class area.  The tag identifies the
+ * objects owned by the caches in free().  It depends on the object address,
+ * the size class, and the object state, see _Malloc_Cache_tag().
+ */
+#define MALLOC_CACHE_TAG_SIZE sizeof( uintptr_t )
+
+#define MALLOC_CACHE_TAG_MAGIC ( (uintptr_t) 0x6d636163 )
+
+typedef struct {
+  uint32_t count;
+  void **objects;
+} Malloc_Cache_magazine;
+
+typedef struct {
+  Malloc_Cache_magazine magazines[ MALLOC_CACHE_CLASS_COUNT ];
+} Malloc_Cache_control;
+
+static PER_CPU_DATA_ITEM( Malloc_Cache_control, _Malloc_Cache_per_cpu );
+
+static uint32_t _Malloc_Cache_batch;
+
+static size_t _Malloc_Cache_class_size( size_t class_index )
+{
+  return (size_t) 1 << ( MALLOC_CACHE_MIN_SHIFT + class_index );
+}
+
+/*
+ * Returns the index of the smallest size class which can hold the specified
+ * size.  The size shall be in the range 1 to MALLOC_CACHE_MAX_SIZE.
+ */
+static size_t _Malloc_Cache_class_of_size( size_t size )
+{
+  size_t bits;
+
+  if ( size <= ( (size_t) 1 << MALLOC_CACHE_MIN_SHIFT ) ) {
+    return 0;
+  }
+
+  bits = CHAR_BIT * sizeof( unsigned long )
+    - (size_t) __builtin_clzl( (unsigned long) ( size - 1 ) );
+
+  return bits - MALLOC_CACHE_MIN_SHIFT;
+}
+
+static uintptr_t *_Malloc_Cache_tag_of_object(
+  void   *object,
+  size_t  class_index
+)
+{
+  return (uintptr_t *)
+    ( (char *) object + _Malloc_Cache_class_size( class_index ) );
+}
+
+static uintptr_t _Malloc_Cache_tag(
+  const void *object,
+  size_t      class_index,
+  bool        allocated
+)
+{
+  return ( (uintptr_t) object ^ MALLOC_CACHE_TAG_MAGIC )
+    + ( (uintptr_t) class_index << 1 ) + ( allocated ? 1 : 0 );
+}
+
+static void _Malloc_Cache_set_tag(
+  void   *object,
+  size_t  class_index,
+  bool    allocated
+)
+{
+  *_Malloc_Cache_tag_of_object( object, class_index ) =
+    _Malloc_Cache_tag( object, class_index, allocated );
+}
+
+static Malloc_Cache_magazine *_Malloc_Cache_get_magazine(
+  size_t class_index
+)
+{
+  Malloc_Cache_control *cache;
+
+  cache = PER_CPU_DATA_GET(
+    _Per_CPU_Get(),
+    Malloc_Cache_control,
+    _Malloc_Cache_per_cpu
+  );
+
+  return &cache->magazines[ class_index ];
+}
+
+static void _Malloc_Cache_free_to_heap(
+  void     **objects,
+  uint32_t   count,
+  size_t     class_index
+)
+{
+  Heap_Control *heap;
+  uint32_t      i;
+
+  heap = RTEMS_Malloc_Heap;
+
+  _RTEMS_Lock_allocator();
+
+  for ( i = 0; i < count; ++i ) {
+    /*
+     * Clear the tag, so that a later heap object at this address is not
+     * mistaken for a cache object.
+     */
+    *_Malloc_Cache_tag_of_object( objects[ i ], class_index ) = 0;
+    (void) _Heap_Free( heap, objects[ i ] );
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+static void *_Malloc_Cache_refill( size_t class_index )
+{
+  void         *objects[ MALLOC_CACHE_BATCH_MAX ];
+  Heap_Control *heap;
+  uintptr_t     alloc_size;
+  uint32_t      count;
+  uint32_t      depth;
+  void         *p;
+
+  heap = RTEMS_Malloc_Heap;
+  alloc_size = _Malloc_Cache_class_size( class_index ) + MALLOC_CACHE_TAG_SIZE;
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  for ( count = 0; count < _Malloc_Cache_batch; ++count ) {
+    p = _Heap_Allocate( heap, alloc_size );
+
+    if ( p == NULL ) {
+      break;
+    }
+
+    _Malloc_Cache_set_tag( p, class_index, false );
+    objects[ count ] = p;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( count == 0 ) {
+    return NULL;
+  }
+
+  --count;
+  p = objects[ count ];
+  _Malloc_Cache_set_tag( p, class_index, true );
+
+  /*
+   * The thread may have migrated to another processor in the meantime.  Put
+   * the remaining objects to the cache of the processor we execute now and
+   * give the objects which do not fit back to the heap.
+   */
+  if ( count > 0 ) {
+    Malloc_Cache_magazine *magazine;
+    ISR_Level              level;
+
+    depth = _Malloc_Cache_depth;
+
+    _ISR_Local_disable( level );
+    magazine = _Malloc_Cache_get_magazine( class_index );
+
+    while ( count > 0 && magazine->count < depth ) {
+      --count;
+      magazine->objects[ magazine->count ] = objects[ count ];
+      ++magazine->count;
+    }
+
+    _ISR_Local_enable( level );
+
+    if ( count > 0 ) {
+      _Malloc_Cache_free_to_heap( objects, count, class_index );
+    }
+  }
+
+  return p;
+}
+
+static void *_Malloc_Cache_allocate( size_t size )
+{
+  Malloc_Cache_magazine *magazine;
+  size_t                 class_index;
+  ISR_Level              level;
+  void                  *p;
+
+  if ( size > MALLOC_CACHE_MAX_SIZE ) {
+    return NULL;
+  }
+
+  class_index = _Malloc_Cache_class_of_size( size );
+
+  _ISR_Local_disable( level );
+  magazine = _Malloc_Cache_get_magazine( class_index );
+
+  if ( magazine->count > 0 ) {
+    --magazine->count;
+    p = magazine->objects[ magazine->count ];
+  } else {
+    p = NULL;
+  }
+
+  _ISR_Local_enable( level );
+
+  if ( p != NULL ) {
+    _Malloc_Cache_set_tag( p, class_index, true );
+  } else {
+    p = _Malloc_Cache_refill( class_index );
+  }
+
+  return p;
+}
+
+/*
+ * Returns the size class index of the object if it was handed out by the
+ * caches and marks it as free, otherwise MALLOC_CACHE_CLASS_COUNT.  This
+ * function does not use the allocator lock, see _Malloc_Cache_free().
+ */
+static size_t _Malloc_Cache_take_back( void *ptr )
+{
+  uintptr_t usable_size;
+  size_t    class_index;
+
+  /*
+   * Pointers which are not allocated areas of the heap are left to the heap
+   * which reports them.  The size of an allocated block owned by the caller
+   * does not change while the allocator lock is owned by another thread, only
+   * the flag of the previous block in the same header word may change.
+   */
+  if ( !_Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, ptr, &usable_size ) ) {
+    return MALLOC_CACHE_CLASS_COUNT;
+  }
+
+  for (
+    class_index = 0;
+    class_index < MALLOC_CACHE_CLASS_COUNT
+      && _Malloc_Cache_class_size( class_index ) + MALLOC_CACHE_TAG_SIZE
+        <= usable_size;
+    ++class_index
+  ) {
+    uintptr_t tag;
+
+    tag = *_Malloc_Cache_tag_of_object( ptr, class_index );
+
+    if ( tag == _Malloc_Cache_tag( ptr, class_index, true ) ) {
+      _Malloc_Cache_set_tag( ptr, class_index, false );
+      return class_index;
+    }
+
+    if ( tag == _Malloc_Cache_tag( ptr, class_index, false ) ) {
+      rtems_fatal(
+        RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE,
+        (rtems_fatal_code) ptr
+      );
+    }
+  }
+
+  return MALLOC_CACHE_CLASS_COUNT;
+}
+
+static bool _Malloc_Cache_free( void *ptr )
+{
+  void                  *objects[ MALLOC_CACHE_BATCH_MAX ];
+  Malloc_Cache_magazine *magazine;
+  size_t                 class_index;
+  uint32_t               count;
+  ISR_Level              level;
+
+  /*
+   * Only objects handed out by the caches go back to the caches.  Their size
+   * class is determined through the tag without the allocator lock.  The
+   * allocator lock is only obtained to give a batch of objects back to the
+   * heap if the magazine is full.  A free of an object which already is in a
+   * cache is reported like an invalid heap free.
+   */
+  class_index = _Malloc_Cache_take_back( ptr );
+
+  if ( class_index >= MALLOC_CACHE_CLASS_COUNT ) {
+    return false;
+  }
+
+  count = 0;
+
+  _ISR_Local_disable( level );
+  magazine = _Malloc_Cache_get_magazine( class_index );
+
+  if ( magazine->count >= _Malloc_Cache_depth ) {
+    while ( count < _Malloc_Cache_batch ) {
+      --magazine->count;
+      objects[ count ] = magazine->objects[ magazine->count ];
+      ++count;
+    }
+  }
+
+  magazine->objects[ magazine->count ] = ptr;
+  ++magazine->count;
+
+  _ISR_Local_enable( level );
+
+  if ( count > 0 ) {
+    _Malloc_Cache_free_to_heap( objects, count, class_index );
+  }
+
+  return true;
+}
+
+static const Malloc_Cache_operations _Malloc_Cache_operations = {
+  .allocate = _Malloc_Cache_allocate,
+  .free = _Malloc_Cache_free
+};
+
+void _Malloc_Cache_initialize( void )
+{
+  uint32_t   depth;
+  uint32_t   cpu_max;
+  uint32_t   cpu_index;
+  uintptr_t  size;
+  void     **objects;
+
+  depth = _Malloc_Cache_depth;
+  cpu_max = rtems_configuration_get_maximum_processors();
+  size = (uintptr_t) cpu_max * MALLOC_CACHE_CLASS_COUNT * depth
+    * sizeof( *objects );
+
+  objects = _Heap_Allocate( RTEMS_Malloc_Heap, size );
+
+  if ( objects == NULL ) {
+    return;
+  }
+
+  /*
+   * A flush gives half of a full magazine back to the heap, however, at most
+   * MALLOC_CACHE_BATCH_MAX objects to bound the allocator lock hold time.
+   */
+  _Malloc_Cache_batch = ( depth + 1 ) / 2;
+
+  if ( _Malloc_Cache_batch > MALLOC_CACHE_BATCH_MAX ) {
+    _Malloc_Cache_batch = MALLOC_CACHE_BATCH_MAX;
+  }
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache_control *cache;
+    size_t                class_index;
+
+    cache = PER_CPU_DATA_GET(
+      _Per_CPU_Get_by_index( cpu_index ),
+      Malloc_Cache_control,
+      _Malloc_Cache_per_cpu
+    );
+
+    for (
+      class_index = 0;
+      class_index < MALLOC_CACHE_CLASS_COUNT;
+      ++class_index
+    ) {
+      cache->magazines[ class_index ].objects = objects;
+      objects += depth;
+    }
+  }
+
+  _Malloc_Cache = &_Malloc_Cache_operations;
+}
+#endif
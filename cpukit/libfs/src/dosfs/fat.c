@@ -27,6 +27,7 @@
 
 #include "fat.h"
 #include "fat_fat_operations.h"
+#include "fat_file.h"
 
 static int
  _fat_block_release(fat_fs_info_t *fs_info);
@@ -863,7 +864,10 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->vhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
+        {
+            fat_file_free_extent_map((fat_file_fd_t *) node);
             free(node);
+        }
     }
 
     for (i = 0; i < FAT_HASH_SIZE; i++)
@@ -872,11 +876,15 @@ fat_shutdown_drive(fat_fs_info_t *fs_info)
         rtems_chain_control *the_chain = fs_info->rhash + i;
 
         while ( (node = rtems_chain_get_unprotected(the_chain)) != NULL )
+        {
+            fat_file_free_extent_map((fat_file_fd_t *) node);
             free(node);
+        }
     }
 
     free(fs_info->vhash);
     free(fs_info->rhash);
+    free(fs_info->vol.free_map);
 
     free(fs_info->uino);
     free(fs_info->sec_buf);
@@ -333,6 +333,20 @@ typedef struct fat_vol_s
     rtems_disk_device *dd;             /* disk device (see libblock) */
     dev_t              dev;            /* device identifier of disk */
     void              *private_data;   /* reserved */
+    /*
+     * The optional free cluster bitmap needs one bit for each data cluster,
+     * for example 1MiB for 8M clusters.  It is built by a scan of the complete
+     * FAT on the first cluster allocation or statvfs() call, see
+     * fat_init_free_map().  The caller owns the file system instance lock
+     * during the scan, so other operations on the volume stall until it is
+     * done.  It is enabled only by the free_cluster_map mount option.
+     */
+    uint32_t          *free_map;       /* free cluster bitmap, a set bit marks
+                                          a free data cluster */
+    bool               free_map_init;  /* free cluster bitmap initialization
+                                          was done */
+    bool               free_map_enabled; /* free cluster bitmap is enabled by
+                                            the mount options */
 } fat_vol_t;
 
 
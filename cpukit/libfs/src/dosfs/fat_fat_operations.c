@@ -27,6 +27,164 @@
 #include "fat.h"
 #include "fat_fat_operations.h"
 
+#define FAT_FREE_MAP_BITS 32
+
+static void
+fat_free_map_update(fat_vol_t *vol, uint32_t cln, bool is_free)
+{
+    uint32_t  bit = cln - FAT_RSRVD_CLN;
+    uint32_t *word = &vol->free_map[bit / FAT_FREE_MAP_BITS];
+    uint32_t  mask = UINT32_C(1) << (bit % FAT_FREE_MAP_BITS);
+
+    if (is_free)
+        *word |= mask;
+    else
+        *word &= ~mask;
+}
+
+/* fat_free_map_next --
+ *     Search the free cluster bitmap for the first cluster in the range
+ *     ['cln', 'end') which is free or used.
+ *
+ * PARAMETERS:
+ *     vol      - volume descriptor
+ *     cln      - first cluster to check
+ *     end      - end of the cluster range
+ *     is_free  - search for a free cluster if true, otherwise for a used one
+ *
+ * RETURNS:
+ *     the first matching cluster, or 'end' if there is no matching cluster
+ */
+static uint32_t
+fat_free_map_next(
+    const fat_vol_t                      *vol,
+    uint32_t                              cln,
+    uint32_t                              end,
+    bool                                  is_free
+    )
+{
+    while (cln < end)
+    {
+        uint32_t bit = cln - FAT_RSRVD_CLN;
+        uint32_t word = vol->free_map[bit / FAT_FREE_MAP_BITS];
+
+        if (!is_free)
+            word = ~word;
+
+        word >>= bit % FAT_FREE_MAP_BITS;
+
+        if (word != 0)
+        {
+            cln += (uint32_t) __builtin_ctz(word);
+            return cln < end ? cln : end;
+        }
+
+        cln += FAT_FREE_MAP_BITS - bit % FAT_FREE_MAP_BITS;
+    }
+
+    return end;
+}
+
+/* fat_free_map_find_run --
+ *     Search the free cluster bitmap for a run of 'count' contiguous free
+ *     clusters in the range ['cln', 'end').
+ *
+ * PARAMETERS:
+ *     vol      - volume descriptor
+ *     cln      - first cluster of the search range
+ *     end      - end of the search range
+ *     count    - count of contiguous free clusters
+ *
+ * RETURNS:
+ *     the first cluster of the run, or 'end' if there is no such run
+ */
+static uint32_t
+fat_free_map_find_run(
+    const fat_vol_t                      *vol,
+    uint32_t                              cln,
+    uint32_t                              end,
+    uint32_t                              count
+    )
+{
+    while (cln < end)
+    {
+        uint32_t run_end;
+
+        cln = fat_free_map_next(vol, cln, end, true);
+        if (end - cln < count)
+            break;
+
+        run_end = fat_free_map_next(vol, cln, cln + count, false);
+        if (run_end - cln == count)
+            return cln;
+
+        cln = run_end;
+    }
+
+    return end;
+}
+
+/* fat_init_free_map --
+ *     Initialize the free cluster bitmap of the volume and the free clusters
+ *     count with one scan of the File Allocation Table.  This is done once,
+ *     further calls have no effect.  If the bitmap is not enabled by the mount
+ *     options or there is not enough memory for the bitmap, then the volume
+ *     works without it.
+ *
+ * PARAMETERS:
+ *     fs_info  - FS info
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured (errno set appropriately)
+ */
+int
+fat_init_free_map(fat_fs_info_t *fs_info)
+{
+    fat_vol_t     *vol = &fs_info->vol;
+    uint32_t      *free_map;
+    uint32_t       free_cls = 0;
+    uint32_t       data_cls_val = vol->data_cls + 2;
+    uint32_t       cln;
+
+    if (vol->free_map_init || !vol->free_map_enabled)
+        return RC_OK;
+
+    vol->free_map_init = true;
+
+    free_map = calloc((vol->data_cls + FAT_FREE_MAP_BITS - 1) /
+                      FAT_FREE_MAP_BITS, sizeof(*free_map));
+    if (free_map == NULL)
+        return RC_OK;
+
+    for (cln = FAT_RSRVD_CLN; cln < data_cls_val; ++cln)
+    {
+        uint32_t value = 0;
+        int      rc;
+
+        rc = fat_get_fat_cluster(fs_info, cln, &value);
+        if ( rc != RC_OK )
+        {
+            free(free_map);
+            vol->free_map_init = false;
+            return rc;
+        }
+
+        if (value == FAT_GENFAT_FREE)
+        {
+            uint32_t bit = cln - FAT_RSRVD_CLN;
+
+            free_map[bit / FAT_FREE_MAP_BITS] |=
+                UINT32_C(1) << (bit % FAT_FREE_MAP_BITS);
+            ++free_cls;
+        }
+    }
+
+    vol->free_map = free_map;
+    vol->free_cls = free_cls;
+
+    return RC_OK;
+}
+
 /* fat_scan_fat_for_free_clusters --
  *     Allocate chain of free clusters from Files Allocation Table
  *
@@ -40,7 +198,9 @@
  *     RC_OK on success, or error code if error occured (errno set
  *     appropriately)
  *
- *
+ * If the free cluster bitmap is available, then free clusters are found
+ * without reading the FAT and a run of 'count' contiguous free clusters is
+ * preferred to keep the file unfragmented.
  */
 int
 fat_scan_fat_for_free_clusters(
@@ -63,6 +223,26 @@ fat_scan_fat_for_free_clusters(
 
     *cls_added = 0;
 
+    rc = fat_init_free_map(fs_info);
+    if ( rc != RC_OK )
+        return rc;
+
+    if (fs_info->vol.free_map != NULL && count > 1)
+    {
+        uint32_t run = fat_free_map_find_run(&fs_info->vol, cl4find,
+                                             data_cls_val, count);
+
+        if (run == data_cls_val)
+        {
+            run = fat_free_map_find_run(&fs_info->vol, 2, cl4find, count);
+            if (run == cl4find)
+                run = data_cls_val;
+        }
+
+        if (run != data_cls_val)
+            cl4find = run;
+    }
+
     /*
      * fs_info->vol.data_cls is exactly the count of data clusters
      * starting at cluster 2, so the maximum valid cluster number is
@@ -72,12 +252,28 @@ fat_scan_fat_for_free_clusters(
     {
         uint32_t next_cln = 0;
 
-        rc = fat_get_fat_cluster(fs_info, cl4find, &next_cln);
-        if ( rc != RC_OK )
+        if (fs_info->vol.free_map != NULL)
         {
-            if (*cls_added != 0)
-                fat_free_fat_clusters_chain(fs_info, (*chain));
-            return rc;
+            uint32_t free_cln = fat_free_map_next(&fs_info->vol, cl4find,
+                                                  data_cls_val, true);
+
+            i += free_cln - cl4find;
+            cl4find = free_cln;
+            if (cl4find >= data_cls_val)
+            {
+                cl4find = 2;
+                continue;
+            }
+        }
+        else
+        {
+            rc = fat_get_fat_cluster(fs_info, cl4find, &next_cln);
+            if ( rc != RC_OK )
+            {
+                if (*cls_added != 0)
+                    fat_free_fat_clusters_chain(fs_info, (*chain));
+                return rc;
+            }
         }
 
         if (next_cln == FAT_GENFAT_FREE)
@@ -422,5 +618,8 @@ fat_set_fat_cluster(
 
     }
 
+    if (fs_info->vol.free_map != NULL)
+        fat_free_map_update(&fs_info->vol, cln, in_val == FAT_GENFAT_FREE);
+
     return RC_OK;
 }
@@ -58,6 +58,9 @@ fat_scan_fat_for_free_clusters(
     bool                                  zero_fill
 );
 
+int
+fat_init_free_map(fat_fs_info_t *fs_info);
+
 int
 fat_free_fat_clusters_chain(
     fat_fs_info_t                        *fs_info,
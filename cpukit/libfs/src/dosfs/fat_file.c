@@ -25,6 +25,7 @@
 #include <stdarg.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <time.h>
 
@@ -59,6 +60,9 @@ fat_file_lseek(
     uint32_t                              *disk_cln
 );
 
+static void
+fat_file_trim_extent_map(fat_file_extent_map_t *extent_map, uint32_t cln_count);
+
 /* fat_file_open --
  *     Open fat-file. Two hash tables are accessed by key
  *     constructed from cluster num and offset of the node (i.e.
@@ -242,6 +246,7 @@ fat_file_close(
                 if (fat_ino_is_unique(fs_info, fat_fd->ino))
                     fat_free_unique_ino(fs_info, fat_fd->ino);
 
+                fat_file_free_extent_map(fat_fd);
                 free(fat_fd);
             }
         }
@@ -254,6 +259,7 @@ fat_file_close(
             else
             {
                 _hash_delete(fs_info->vhash, key, fat_fd->ino, fat_fd);
+                fat_file_free_extent_map(fat_fd);
                 free(fat_fd);
             }
         }
@@ -660,6 +666,7 @@ fat_file_extend(
         {
             fat_fd->map.disk_cln = chain;
             fat_fd->map.file_cln = 0;
+            fat_file_trim_extent_map(&fat_fd->extent_map, 0);
             fat_file_set_first_cluster_num(fat_fd, chain);
         }
         else
@@ -760,6 +767,8 @@ fat_file_truncate(
     if (rc != RC_OK)
         return rc;
 
+    fat_file_trim_extent_map(&fat_fd->extent_map, cl_start);
+
     if (cl_start != 0)
     {
         rc = fat_set_fat_cluster(fs_info, new_last_cln, FAT_GENFAT_EOC);
@@ -1003,6 +1012,224 @@ _hash_search(
     return -1;
 }
 
+/* extent map support routines */
+
+/*
+ * Maximum count of extents in the extent map of a fat-file.  This limits the
+ * memory used by the extent map of heavily fragmented files.  Clusters beyond
+ * the extent map are found by a walk through the FAT.
+ */
+#define FAT_FILE_EXTENT_MAP_MAX 4096
+
+#define FAT_FILE_EXTENT_MAP_INITIAL 8
+
+/* fat_file_free_extent_map --
+ *     Free the memory used by the extent map of the fat-file.
+ *
+ * PARAMETERS:
+ *     fat_fd     - fat-file descriptor
+ *
+ * RETURNS:
+ *     None
+ */
+void
+fat_file_free_extent_map(fat_file_fd_t *fat_fd)
+{
+    free(fat_fd->extent_map.extents);
+    memset(&fat_fd->extent_map, 0, sizeof(fat_fd->extent_map));
+}
+
+/* fat_file_trim_extent_map --
+ *     Remove the file clusters starting with 'cln_count' from the extent map.
+ *
+ * PARAMETERS:
+ *     extent_map - extent map of the fat-file
+ *     cln_count  - count of file clusters to keep
+ *
+ * RETURNS:
+ *     None
+ */
+static void
+fat_file_trim_extent_map(fat_file_extent_map_t *extent_map, uint32_t cln_count)
+{
+    if (cln_count >= extent_map->end)
+        return;
+
+    while (extent_map->count > 0 &&
+           extent_map->extents[extent_map->count - 1].file_cln >= cln_count)
+        --extent_map->count;
+
+    if (extent_map->count > 0)
+    {
+        fat_file_extent_t *last = &extent_map->extents[extent_map->count - 1];
+
+        if (last->file_cln + last->count > cln_count)
+            last->count = cln_count - last->file_cln;
+    }
+
+    extent_map->end = cln_count;
+}
+
+/* fat_file_append_to_extent_map --
+ *     Append the volume cluster of the next file cluster to the extent map.
+ *
+ * PARAMETERS:
+ *     extent_map - extent map of the fat-file
+ *     disk_cln   - volume cluster of the file cluster 'extent_map->end'
+ *
+ * RETURNS:
+ *     true on success, false if the extent map cannot grow
+ */
+static bool
+fat_file_append_to_extent_map(fat_file_extent_map_t *extent_map,
+                              uint32_t               disk_cln)
+{
+    fat_file_extent_t *extent;
+
+    if (extent_map->count > 0)
+    {
+        extent = &extent_map->extents[extent_map->count - 1];
+
+        if (extent->disk_cln + extent->count == disk_cln)
+        {
+            ++extent->count;
+            ++extent_map->end;
+            return true;
+        }
+    }
+
+    if (extent_map->count == extent_map->capacity)
+    {
+        uint32_t capacity;
+
+        if (extent_map->capacity >= FAT_FILE_EXTENT_MAP_MAX)
+            return false;
+
+        if (extent_map->capacity == 0)
+            capacity = FAT_FILE_EXTENT_MAP_INITIAL;
+        else
+            capacity = 2 * extent_map->capacity;
+
+        extent = realloc(extent_map->extents, capacity * sizeof(*extent));
+        if (extent == NULL)
+            return false;
+
+        extent_map->extents = extent;
+        extent_map->capacity = capacity;
+    }
+
+    extent = &extent_map->extents[extent_map->count];
+    extent->file_cln = extent_map->end;
+    extent->disk_cln = disk_cln;
+    extent->count = 1;
+    ++extent_map->count;
+    ++extent_map->end;
+    return true;
+}
+
+/* fat_file_lookup_extent_map --
+ *     Get the volume cluster of a mapped file cluster by a binary search in
+ *     the extent map.
+ *
+ * PARAMETERS:
+ *     extent_map - extent map of the fat-file
+ *     file_cln   - file cluster less than 'extent_map->end'
+ *
+ * RETURNS:
+ *     volume cluster of the file cluster
+ */
+static uint32_t
+fat_file_lookup_extent_map(const fat_file_extent_map_t *extent_map,
+                           uint32_t                     file_cln)
+{
+    uint32_t lo = 0;
+    uint32_t hi = extent_map->count;
+
+    while (hi - lo > 1)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+
+        if (extent_map->extents[mid].file_cln <= file_cln)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    return extent_map->extents[lo].disk_cln +
+           (file_cln - extent_map->extents[lo].file_cln);
+}
+
+static bool
+fat_file_is_data_cluster(const fat_fs_info_t *fs_info, uint32_t cln)
+{
+    return cln >= FAT_RSRVD_CLN &&
+           (cln & fs_info->vol.mask) < fs_info->vol.eoc_val;
+}
+
+/* fat_file_update_extent_map --
+ *     Extend the extent map of the fat-file up to and including the file
+ *     cluster 'file_cln' if possible.  The extent map stops at the end of the
+ *     cluster chain and if it reached its maximum size.
+ *
+ * PARAMETERS:
+ *     fs_info    - FS info
+ *     fat_fd     - fat-file descriptor
+ *     file_cln   - file cluster to map
+ *
+ * RETURNS:
+ *     RC_OK on success, or -1 if error occured (errno set appropriately)
+ */
+static int
+fat_file_update_extent_map(
+    fat_fs_info_t                         *fs_info,
+    fat_file_fd_t                         *fat_fd,
+    uint32_t                               file_cln
+    )
+{
+    fat_file_extent_map_t *extent_map = &fat_fd->extent_map;
+    uint32_t               cur_cln;
+
+    /*
+     * The first cluster number may change without a truncate, for example
+     * if the fat-file descriptor is reused for another node.
+     */
+    if (extent_map->count > 0 &&
+        extent_map->extents[0].disk_cln != fat_fd->cln)
+        fat_file_trim_extent_map(extent_map, 0);
+
+    if (file_cln < extent_map->end)
+        return RC_OK;
+
+    if (extent_map->end == 0)
+    {
+        cur_cln = fat_fd->cln;
+
+        if (!fat_file_is_data_cluster(fs_info, cur_cln) ||
+            !fat_file_append_to_extent_map(extent_map, cur_cln))
+            return RC_OK;
+    }
+    else
+    {
+        const fat_file_extent_t *last =
+            &extent_map->extents[extent_map->count - 1];
+
+        cur_cln = last->disk_cln + last->count - 1;
+    }
+
+    while (extent_map->end <= file_cln)
+    {
+        int rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+        if ( rc != RC_OK )
+            return rc;
+
+        if (!fat_file_is_data_cluster(fs_info, cur_cln) ||
+            !fat_file_append_to_extent_map(extent_map, cur_cln))
+            break;
+    }
+
+    return RC_OK;
+}
+
 static off_t
 fat_file_lseek(
     fat_fs_info_t                         *fs_info,
@@ -1021,23 +1248,44 @@ fat_file_lseek(
         uint32_t   count;
         uint32_t   i;
 
-        if (file_cln > fat_fd->map.file_cln)
+        rc = fat_file_update_extent_map(fs_info, fat_fd, file_cln);
+        if ( rc != RC_OK )
+            return rc;
+
+        if (file_cln < fat_fd->extent_map.end)
         {
-            cur_cln = fat_fd->map.disk_cln;
-            count = file_cln - fat_fd->map.file_cln;
+            cur_cln = fat_file_lookup_extent_map(&fat_fd->extent_map,
+                                                 file_cln);
         }
         else
         {
-            cur_cln = fat_fd->cln;
-            count = file_cln;
-        }
+            uint32_t end = fat_fd->extent_map.end;
 
-        /* skip over the clusters */
-        for (i = 0; i < count; i++)
-        {
-            rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
-            if ( rc != RC_OK )
-                return rc;
+            if (file_cln > fat_fd->map.file_cln &&
+                (end == 0 || fat_fd->map.file_cln >= end - 1))
+            {
+                cur_cln = fat_fd->map.disk_cln;
+                count = file_cln - fat_fd->map.file_cln;
+            }
+            else if (end > 0)
+            {
+                cur_cln = fat_file_lookup_extent_map(&fat_fd->extent_map,
+                                                     end - 1);
+                count = file_cln - (end - 1);
+            }
+            else
+            {
+                cur_cln = fat_fd->cln;
+                count = file_cln;
+            }
+
+            /* skip over the clusters */
+            for (i = 0; i < count; i++)
+            {
+                rc = fat_get_fat_cluster(fs_info, cur_cln, &cur_cln);
+                if ( rc != RC_OK )
+                    return rc;
+            }
         }
 
         /* update cache */
@@ -65,6 +65,35 @@ typedef struct fat_file_map_s
     uint32_t   last_cln;
 } fat_file_map_t;
 
+/**
+ * @brief Extent of a fat-file.
+ *
+ * An extent is a run of clusters which are contiguous in the file and on the
+ * volume.
+ */
+typedef struct fat_file_extent_s
+{
+    uint32_t   file_cln;
+    uint32_t   disk_cln;
+    uint32_t   count;
+} fat_file_extent_t;
+
+/**
+ * @brief Extent map of a fat-file.
+ *
+ * The extent map records the cluster chain of a fat-file as a sorted array of
+ * extents.  It is built lazily during seeks and maps the file clusters from
+ * zero up to but not including the end value.  A seek to a mapped cluster
+ * needs a binary search instead of a walk through the FAT.
+ */
+typedef struct fat_file_extent_map_s
+{
+    fat_file_extent_t *extents;
+    uint32_t           count;
+    uint32_t           capacity;
+    uint32_t           end;
+} fat_file_extent_map_t;
+
 /**
  * @brief Descriptor of a fat-file.
  *
@@ -89,6 +118,7 @@ typedef struct fat_file_fd_s
     fat_dir_pos_t    dir_pos;
     uint8_t          flags;
     fat_file_map_t   map;
+    fat_file_extent_map_t extent_map;
     time_t           ctime;
     time_t           mtime;
 
@@ -255,6 +285,9 @@ int
 fat_file_update(fat_fs_info_t *fs_info,
                 fat_file_fd_t *fat_fd);
 
+void
+fat_file_free_extent_map(fat_file_fd_t *fat_fd);
+
 #ifdef __cplusplus
 }
 #endif
@@ -117,6 +117,13 @@ int rtems_dosfs_initialize(
                                       &msdos_file_handlers,
                                       &msdos_dir_handlers,
                                       converter);
+
+        if (rc == RC_OK && mount_options != NULL) {
+            msdos_fs_info_t *fs_info = mt_entry->fs_info;
+
+            fs_info->fat.vol.free_map_enabled =
+                mount_options->free_cluster_map;
+        }
     } else {
         errno = ENOMEM;
         rc = -1;
@@ -25,6 +25,7 @@ int msdos_statvfs(
 {
   msdos_fs_info_t *fs_info = root_loc->mt_entry->fs_info;
   fat_vol_t *vol = &fs_info->fat.vol;
+  int rc;
 
   msdos_fs_lock(fs_info);
 
@@ -39,9 +40,15 @@ int msdos_statvfs(
   sb->f_flag = 0;
   sb->f_namemax = MSDOS_NAME_MAX_LNF_LEN;
 
+  rc = fat_init_free_map(&fs_info->fat);
+  if (rc != RC_OK)
+  {
+    msdos_fs_unlock(fs_info);
+    return rc;
+  }
+
   if (vol->free_cls == FAT_UNDEFINED_VALUE)
   {
-    int rc;
     uint32_t cur_cl = 2;
     uint32_t value = 0;
     uint32_t data_cls_val = vol->data_cls + 2;
@@ -0,0 +1,251 @@
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Directory Name Hash Index
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfs.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Directories with less entries are searched linearly.  This avoids the
+ * memory overhead of the hash table for small directories.
+ */
+#define IMFS_DIRECTORY_INDEX_THRESHOLD 8
+
+static uint32_t IMFS_directory_index_hash( const char *name, size_t namelen )
+{
+  uint32_t hash = 2166136261U;
+  size_t   i;
+
+  for ( i = 0; i < namelen; ++i ) {
+    hash ^= (uint8_t) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static size_t IMFS_directory_index_slot(
+  const IMFS_directory_index *index,
+  const IMFS_jnode_t         *entry
+)
+{
+  return IMFS_directory_index_hash( entry->name, entry->namelen )
+    & index->mask;
+}
+
+static void IMFS_directory_index_put(
+  IMFS_directory_index *index,
+  IMFS_jnode_t         *entry
+)
+{
+  size_t i = IMFS_directory_index_slot( index, entry );
+
+  while ( index->table[ i ] != NULL ) {
+    i = ( i + 1 ) & index->mask;
+  }
+
+  index->table[ i ] = entry;
+}
+
+static void IMFS_directory_index_rebuild( IMFS_directory_t *dir )
+{
+  IMFS_directory_index *index = &dir->Index;
+  IMFS_jnode_t        **table;
+  size_t                size;
+  rtems_chain_node     *current;
+  rtems_chain_node     *tail;
+
+  size = IMFS_DIRECTORY_INDEX_THRESHOLD;
+
+  while ( size < 4 * index->count ) {
+    size *= 2;
+  }
+
+  table = calloc( size, sizeof( *table ) );
+
+  if ( table == NULL ) {
+    /*
+     * Keep the current table as long as it has a free slot, otherwise fall
+     * back to the linear search.  The rebuild is tried again with the next
+     * insert.
+     */
+    if ( index->table != NULL ) {
+      if ( index->count <= index->mask ) {
+        IMFS_jnode_t *entry;
+
+        entry = (IMFS_jnode_t *) rtems_chain_last( &dir->Entries );
+        IMFS_directory_index_put( index, entry );
+      } else {
+        free( index->table );
+        index->table = NULL;
+        index->mask = 0;
+      }
+    }
+
+    return;
+  }
+
+  free( index->table );
+  index->table = table;
+  index->mask = size - 1;
+
+  current = rtems_chain_first( &dir->Entries );
+  tail = rtems_chain_tail( &dir->Entries );
+
+  while ( current != tail ) {
+    IMFS_directory_index_put( index, (IMFS_jnode_t *) current );
+    current = rtems_chain_next( current );
+  }
+}
+
+void IMFS_directory_index_insert(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+)
+{
+  IMFS_directory_index *index = &dir->Index;
+
+  ++index->count;
+
+  if ( index->table != NULL && 2 * index->count <= index->mask + 1 ) {
+    IMFS_directory_index_put( index, entry );
+  } else if ( index->count >= IMFS_DIRECTORY_INDEX_THRESHOLD ) {
+    IMFS_directory_index_rebuild( dir );
+  }
+}
+
+void IMFS_directory_index_remove(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t     *entry
+)
+{
+  IMFS_directory_index *index = &dir->Index;
+  size_t                i;
+  size_t                j;
+
+  --index->count;
+
+  if ( index->table == NULL ) {
+    return;
+  }
+
+  if ( index->count == 0 ) {
+    free( index->table );
+    index->table = NULL;
+    index->mask = 0;
+    return;
+  }
+
+  i = IMFS_directory_index_slot( index, entry );
+
+  while ( index->table[ i ] != entry ) {
+    IMFS_assert( index->table[ i ] != NULL );
+    i = ( i + 1 ) & index->mask;
+  }
+
+  /* Move back entries of the probe sequence to close the gap */
+  j = i;
+
+  while ( true ) {
+    IMFS_jnode_t *other;
+    size_t        k;
+
+    j = ( j + 1 ) & index->mask;
+    other = index->table[ j ];
+
+    if ( other == NULL ) {
+      break;
+    }
+
+    k = IMFS_directory_index_slot( index, other );
+
+    if ( ( ( j - k ) & index->mask ) >= ( ( j - i ) & index->mask ) ) {
+      index->table[ i ] = other;
+      i = j;
+    }
+  }
+
+  index->table[ i ] = NULL;
+}
+
+IMFS_jnode_t *IMFS_directory_index_search(
+  const IMFS_directory_t *dir,
+  const char             *name,
+  size_t                  namelen
+)
+{
+  const IMFS_directory_index *index = &dir->Index;
+  size_t                      i;
+  IMFS_jnode_t               *entry;
+
+  i = IMFS_directory_index_hash( name, namelen ) & index->mask;
+
+  while ( ( entry = index->table[ i ] ) != NULL ) {
+    if ( entry->namelen == namelen
+      && memcmp( entry->name, name, namelen ) == 0 ) {
+      return entry;
+    }
+
+    i = ( i + 1 ) & index->mask;
+  }
+
+  return NULL;
+}
+
+IMFS_jnode_t *IMFS_node_initialize_directory_hashed(
+  IMFS_jnode_t *node,
+  void *arg
+)
+{
+  IMFS_directory_t *dir = (IMFS_directory_t *) node;
+
+  node = IMFS_node_initialize_directory( node, arg );
+  dir->Index.enabled = true;
+
+  return node;
+}
+
+void IMFS_node_destroy_directory_hashed( IMFS_jnode_t *node )
+{
+  IMFS_directory_t *dir = (IMFS_directory_t *) node;
+
+  free( dir->Index.table );
+  IMFS_node_destroy_default( node );
+}
@@ -47,3 +47,13 @@ const IMFS_mknod_control IMFS_mknod_control_dir_minimal = {
   },
   .node_size = sizeof( IMFS_directory_t )
 };
+
+const IMFS_mknod_control IMFS_mknod_control_dir_minimal_hashed = {
+  {
+    .handlers = &IMFS_dir_minimal_handlers,
+    .node_initialize = IMFS_node_initialize_directory_hashed,
+    .node_remove = IMFS_node_remove_directory,
+    .node_destroy = IMFS_node_destroy_directory_hashed
+  },
+  .node_size = sizeof( IMFS_directory_t )
+};
@@ -49,6 +49,8 @@ static IMFS_jnode_t *IMFS_search_in_directory(
   } else {
     if ( rtems_filesystem_is_parent_directory( token, tokenlen ) ) {
       return dir->Node.Parent;
+    } else if ( dir->Index.table != NULL ) {
+      return IMFS_directory_index_search( dir, token, tokenlen );
     } else {
       rtems_chain_control *entries = &dir->Entries;
       rtems_chain_node *current = rtems_chain_first( entries );
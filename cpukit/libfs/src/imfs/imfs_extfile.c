@@ -0,0 +1,497 @@
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief IMFS Extent File Handlers
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfs.h>
+
+#include <sys/mman.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The extents grow with the file capacity to keep the count of extents
+ * logarithmic in the file size for sequential appends.  The growth is limited
+ * to bound the memory wasted at the end of a file.  An extent may be larger
+ * than the maximum growth if a single write or truncate needs it.
+ */
+#define IMFS_EXTFILE_MINIMUM_EXTENT_SIZE IMFS_MEMFILE_BYTES_PER_BLOCK
+
+#define IMFS_EXTFILE_MAXIMUM_EXTENT_GROWTH ( 1024 * 1024 )
+
+#define IMFS_EXTFILE_INITIAL_EXTENT_CAPACITY 4
+
+static size_t IMFS_extfile_round_up( size_t size )
+{
+  size_t minimum = IMFS_EXTFILE_MINIMUM_EXTENT_SIZE;
+
+  return ( ( size + minimum - 1 ) / minimum ) * minimum;
+}
+
+static size_t IMFS_extfile_find_extent(
+  IMFS_extfile_t *extfile,
+  size_t          offset
+)
+{
+  const IMFS_extent_t *extents;
+  size_t               last;
+  size_t               lo;
+  size_t               hi;
+
+  extents = extfile->extents;
+  last = extfile->last;
+
+  /* Fast path for sequential access */
+  if ( last < extfile->extent_count ) {
+    if ( offset - extents[ last ].offset < extents[ last ].size ) {
+      return last;
+    }
+
+    ++last;
+
+    if (
+      last < extfile->extent_count
+        && offset - extents[ last ].offset < extents[ last ].size
+    ) {
+      extfile->last = last;
+      return last;
+    }
+  }
+
+  lo = 0;
+  hi = extfile->extent_count;
+
+  while ( hi - lo > 1 ) {
+    size_t mid = lo + ( hi - lo ) / 2;
+
+    if ( extents[ mid ].offset <= offset ) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+
+  extfile->last = lo;
+  return lo;
+}
+
+static int IMFS_extfile_add_extent( IMFS_extfile_t *extfile, size_t needed )
+{
+  IMFS_extent_t *extent;
+  size_t         size;
+  void          *data;
+
+  if ( extfile->extent_count == extfile->extent_capacity ) {
+    size_t extent_capacity;
+
+    if ( extfile->extent_capacity == 0 ) {
+      extent_capacity = IMFS_EXTFILE_INITIAL_EXTENT_CAPACITY;
+    } else {
+      extent_capacity = 2 * extfile->extent_capacity;
+    }
+
+    extent = realloc(
+      extfile->extents,
+      extent_capacity * sizeof( *extent )
+    );
+    if ( extent == NULL ) {
+      return -1;
+    }
+
+    extfile->extents = extent;
+    extfile->extent_capacity = extent_capacity;
+  }
+
+  size = extfile->capacity;
+
+  if ( size > IMFS_EXTFILE_MAXIMUM_EXTENT_GROWTH ) {
+    size = IMFS_EXTFILE_MAXIMUM_EXTENT_GROWTH;
+  }
+
+  if ( size < needed ) {
+    size = needed;
+  }
+
+  size = IMFS_extfile_round_up( size );
+
+  /*
+   * Try smaller extents in case the heap is fragmented, the file may then
+   * need more than one extent for the new capacity.
+   */
+  while ( true ) {
+    data = malloc( size );
+    if ( data != NULL ) {
+      break;
+    }
+
+    if ( size <= IMFS_EXTFILE_MINIMUM_EXTENT_SIZE ) {
+      return -1;
+    }
+
+    size = IMFS_extfile_round_up( size / 2 );
+  }
+
+  extent = &extfile->extents[ extfile->extent_count ];
+  extent->offset = extfile->capacity;
+  extent->size = size;
+  extent->data = data;
+  ++extfile->extent_count;
+  extfile->capacity += size;
+
+  return 0;
+}
+
+static void IMFS_extfile_fill_zero(
+  IMFS_extfile_t *extfile,
+  size_t          begin,
+  size_t          end
+)
+{
+  while ( begin < end ) {
+    const IMFS_extent_t *extent;
+    size_t               offset;
+    size_t               count;
+
+    extent = &extfile->extents[ IMFS_extfile_find_extent( extfile, begin ) ];
+    offset = begin - extent->offset;
+    count = extent->size - offset;
+
+    if ( count > end - begin ) {
+      count = end - begin;
+    }
+
+    memset( &extent->data[ offset ], 0, count );
+    begin += count;
+  }
+}
+
+/*
+ *  IMFS_extfile_extend
+ *
+ *  This routine insures that the extent file is of the length specified.
+ *  The new part of the file is filled with zeros if requested.
+ */
+static int IMFS_extfile_extend(
+  IMFS_extfile_t *extfile,
+  bool            zero_fill,
+  off_t           new_length
+)
+{
+  size_t length;
+
+  if ( new_length <= (off_t) extfile->File.size ) {
+    return 0;
+  }
+
+  if ( (uintmax_t) new_length > SIZE_MAX / 2 ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  length = (size_t) new_length;
+
+  while ( extfile->capacity < length ) {
+    if ( IMFS_extfile_add_extent( extfile, length - extfile->capacity ) != 0 ) {
+      rtems_set_errno_and_return_minus_one( ENOSPC );
+    }
+  }
+
+  if ( zero_fill ) {
+    IMFS_extfile_fill_zero( extfile, extfile->File.size, length );
+  }
+
+  extfile->File.size = length;
+
+  return 0;
+}
+
+static void IMFS_extfile_shrink( IMFS_extfile_t *extfile, size_t length )
+{
+  /* Free the extents which contain no file data */
+  while ( extfile->extent_count > 0 ) {
+    IMFS_extent_t *extent;
+
+    extent = &extfile->extents[ extfile->extent_count - 1 ];
+
+    if ( extent->offset < length ) {
+      break;
+    }
+
+    free( extent->data );
+    extfile->capacity -= extent->size;
+    --extfile->extent_count;
+  }
+
+  extfile->last = 0;
+  extfile->File.size = length;
+}
+
+static ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile;
+  unsigned char  *dest;
+  off_t           start;
+  size_t          offset;
+  size_t          remaining;
+
+  extfile = IMFS_iop_to_extfile( iop );
+  start = iop->offset;
+
+  if ( start >= (off_t) extfile->File.size ) {
+    return 0;
+  }
+
+  offset = (size_t) start;
+
+  if ( count > extfile->File.size - offset ) {
+    count = extfile->File.size - offset;
+  }
+
+  dest = buffer;
+  remaining = count;
+
+  while ( remaining > 0 ) {
+    const IMFS_extent_t *extent;
+    size_t               extent_offset;
+    size_t               to_copy;
+
+    extent = &extfile->extents[ IMFS_extfile_find_extent( extfile, offset ) ];
+    extent_offset = offset - extent->offset;
+    to_copy = extent->size - extent_offset;
+
+    if ( to_copy > remaining ) {
+      to_copy = remaining;
+    }
+
+    memcpy( dest, &extent->data[ extent_offset ], to_copy );
+    dest += to_copy;
+    offset += to_copy;
+    remaining -= to_copy;
+  }
+
+  iop->offset = (off_t) offset;
+  IMFS_update_atime( &extfile->File.Node );
+
+  return (ssize_t) count;
+}
+
+static ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t      *extfile;
+  const unsigned char *src;
+  off_t                start;
+  size_t               offset;
+  size_t               remaining;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if ( rtems_libio_iop_is_append( iop ) ) {
+    iop->offset = extfile->File.size;
+  }
+
+  start = iop->offset;
+
+  if ( start + (off_t) count > (off_t) extfile->File.size ) {
+    size_t old_size;
+    int    rv;
+
+    old_size = extfile->File.size;
+    rv = IMFS_extfile_extend( extfile, false, start + (off_t) count );
+    if ( rv != 0 ) {
+      return rv;
+    }
+
+    if ( start > (off_t) old_size ) {
+      IMFS_extfile_fill_zero( extfile, old_size, (size_t) start );
+    }
+  }
+
+  offset = (size_t) start;
+  src = buffer;
+  remaining = count;
+
+  while ( remaining > 0 ) {
+    const IMFS_extent_t *extent;
+    size_t               extent_offset;
+    size_t               to_copy;
+
+    extent = &extfile->extents[ IMFS_extfile_find_extent( extfile, offset ) ];
+    extent_offset = offset - extent->offset;
+    to_copy = extent->size - extent_offset;
+
+    if ( to_copy > remaining ) {
+      to_copy = remaining;
+    }
+
+    memcpy( &extent->data[ extent_offset ], src, to_copy );
+    src += to_copy;
+    offset += to_copy;
+    remaining -= to_copy;
+  }
+
+  iop->offset = (off_t) offset;
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return (ssize_t) count;
+}
+
+static int IMFS_extfile_ftruncate( rtems_libio_t *iop, off_t length )
+{
+  IMFS_extfile_t *extfile;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if ( length > (off_t) extfile->File.size ) {
+    int rv;
+
+    rv = IMFS_extfile_extend( extfile, true, length );
+    if ( rv != 0 ) {
+      return rv;
+    }
+  } else {
+    /*
+     * The shrink frees extents which may be mapped.  An extend does not move
+     * the data of the existing extents.
+     */
+    if ( IMFS_file_is_mapped( &extfile->File ) ) {
+      rtems_set_errno_and_return_minus_one( EBUSY );
+    }
+
+    IMFS_extfile_shrink( extfile, (size_t) length );
+  }
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+static int IMFS_extfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_extfile_t      *extfile;
+  const IMFS_extent_t *extent;
+  size_t               offset;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if ( ( prot & PROT_WRITE ) != 0 ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  if (
+    off < 0 || len == 0 || (size_t) off >= extfile->File.size
+      || len > extfile->File.size - (size_t) off
+  ) {
+    rtems_set_errno_and_return_minus_one( EOVERFLOW );
+  }
+
+  /*
+   * Only ranges within one extent are contiguous.  The extent is freed only
+   * by a truncation, which is rejected while the file is mapped, or by the
+   * removal of the file, which is delayed by the file descriptor of the
+   * mapping until munmap().
+   */
+  offset = (size_t) off;
+  extent = &extfile->extents[ IMFS_extfile_find_extent( extfile, offset ) ];
+
+  if ( len > extent->size - ( offset - extent->offset ) ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  IMFS_file_map( &extfile->File, iop );
+  IMFS_update_atime( &extfile->File.Node );
+  *addr = extent->data + ( offset - extent->offset );
+
+  return 0;
+}
+
+static void IMFS_extfile_destroy( IMFS_jnode_t *node )
+{
+  IMFS_extfile_t *extfile;
+  size_t          i;
+
+  extfile = (IMFS_extfile_t *) node;
+
+  for ( i = 0; i < extfile->extent_count; ++i ) {
+    free( extfile->extents[ i ].data );
+  }
+
+  free( extfile->extents );
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = IMFS_file_close,
+  .read_h = IMFS_extfile_read,
+  .write_h = IMFS_extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_file,
+  .ftruncate_h = IMFS_extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = IMFS_extfile_mmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+const IMFS_mknod_control IMFS_mknod_control_extfile = {
+  {
+    .handlers = &IMFS_extfile_handlers,
+    .node_initialize = IMFS_node_initialize_default,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_extfile_destroy
+  },
+  .node_size = sizeof( IMFS_extfile_t )
+};
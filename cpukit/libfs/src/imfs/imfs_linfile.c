@@ -17,6 +17,8 @@
 #include "config.h"
 #endif
 
+#include <sys/mman.h>
+#include <errno.h>
 #include <string.h>
 
 #include <rtems/imfs.h>
@@ -76,6 +78,38 @@ static int IMFS_linfile_open(
   return 0;
 }
 
+static int IMFS_linfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  const unsigned char *data = file->Linearfile.direct;
+
+  /*
+   * The file image may reside in read-only memory.  A write opens the file
+   * as a memory file.  The image is provided by the application and is not
+   * freed by an unlink() or truncation of the file, so the mapping needs no
+   * accounting, see IMFS_file_map().
+   */
+  if ( ( prot & PROT_WRITE ) != 0 ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  if ( off < 0 || (size_t) off > file->File.size
+    || len > file->File.size - (size_t) off ) {
+    rtems_set_errno_and_return_minus_one( EOVERFLOW );
+  }
+
+  IMFS_update_atime( &file->Node );
+  *addr = RTEMS_DECONST( unsigned char *, &data[ off ] );
+
+  return 0;
+}
+
 static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .open_h = IMFS_linfile_open,
   .close_h = rtems_filesystem_default_close,
@@ -89,7 +123,7 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = IMFS_linfile_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
@@ -21,6 +21,8 @@
 
 #include <rtems/imfs.h>
 
+#include <sys/mman.h>
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -112,6 +114,13 @@ static int memfile_ftruncate(
 {
   IMFS_memfile_t *memfile = IMFS_iop_to_memfile( iop );
 
+  /*
+   *  The file data of a direct mapping must stay within the file.  An extend
+   *  does not move the existing blocks.
+   */
+  if ( length < memfile->File.size && IMFS_file_is_mapped( &memfile->File ) )
+    rtems_set_errno_and_return_minus_one( EBUSY );
+
   /*
    *  POSIX 1003.1b does not specify what happens if you truncate a file
    *  and the new length is greater than the current size.  We treat this
@@ -133,6 +142,79 @@ static int memfile_ftruncate(
   return 0;
 }
 
+/*
+ *  memfile_mmap
+ *
+ *  A read-only mapping refers directly to the file data, if the requested
+ *  range is located in consecutive memory.  This is always the case for
+ *  ranges within one block.  The blocks are freed only by the removal of the
+ *  file, which is delayed by the file descriptor of the mapping until
+ *  munmap().  A truncation is rejected while the file is mapped.
+ */
+static int memfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_file_t   *file = IMFS_iop_to_file( iop );
+  block_p       *block_ptr;
+  unsigned int   block;
+  unsigned int   last;
+  unsigned char *begin;
+  unsigned char *expected;
+
+  if ( ( prot & PROT_WRITE ) != 0 ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  if ( off < 0 || len == 0 || off > file->Memfile.File.size
+    || len > file->Memfile.File.size - off ) {
+    rtems_set_errno_and_return_minus_one( EOVERFLOW );
+  }
+
+  block = off / IMFS_MEMFILE_BYTES_PER_BLOCK;
+  last = ( off + len - 1 ) / IMFS_MEMFILE_BYTES_PER_BLOCK;
+
+  block_ptr = IMFS_memfile_get_block_pointer( &file->Memfile, block, 0 );
+  if ( block_ptr == NULL || *block_ptr == NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOTSUP );
+  }
+
+  begin = (unsigned char *) *block_ptr;
+  expected = begin + IMFS_MEMFILE_BYTES_PER_BLOCK;
+
+  while ( block < last ) {
+    ++block;
+    block_ptr = IMFS_memfile_get_block_pointer( &file->Memfile, block, 0 );
+    if ( block_ptr == NULL || (unsigned char *) *block_ptr != expected ) {
+      rtems_set_errno_and_return_minus_one( ENOTSUP );
+    }
+
+    expected += IMFS_MEMFILE_BYTES_PER_BLOCK;
+  }
+
+  IMFS_file_map( &file->File, iop );
+  IMFS_update_atime( &file->Node );
+  *addr = begin + off % IMFS_MEMFILE_BYTES_PER_BLOCK;
+
+  return 0;
+}
+
+int IMFS_file_close( rtems_libio_t *iop )
+{
+  /* See IMFS_file_map() */
+  if ( iop->data0 != 0 ) {
+    IMFS_file_t *file = IMFS_iop_to_file( iop );
+
+    --file->File.map_count;
+  }
+
+  return 0;
+}
+
 /*
  *  IMFS_memfile_extend
  *
@@ -834,7 +916,7 @@ void memfile_free_block(
 
 static const rtems_filesystem_file_handlers_r IMFS_memfile_handlers = {
   .open_h = rtems_filesystem_default_open,
-  .close_h = rtems_filesystem_default_close,
+  .close_h = IMFS_file_close,
   .read_h = memfile_read,
   .write_h = memfile_write,
   .ioctl_h = rtems_filesystem_default_ioctl,
@@ -845,7 +927,7 @@ static const rtems_filesystem_file_handlers_r IMFS_memfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = memfile_mmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
@@ -86,6 +86,12 @@ int IMFS_rename(
     IMFS_restore_replaced_control( node );
   }
 
+  /*
+   * Remove the node from the directory before the name changes, since the
+   * directory name hash index uses the name to find the node.
+   */
+  IMFS_remove_from_directory( node );
+
   control->Base = *node->control;
   control->Base.node_destroy = IMFS_renamed_destroy;
   control->replaced = node->control;
@@ -93,7 +99,6 @@ int IMFS_rename(
   node->name = control->name;
   node->namelen = namelen;
 
-  IMFS_remove_from_directory( node );
   IMFS_add_to_directory( new_parent, node );
   IMFS_update_ctime( node );
 
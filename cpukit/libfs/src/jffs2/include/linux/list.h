@@ -139,6 +139,14 @@ list_empty( struct list_head *list )
     (_ent_) != (_list_);                 \
     (_ent_) = (_ent_)->next )
 
+/* list_for_each_safe - using _ent_, iterate through list _list_ while
+   _next_ keeps the following entry, so that _ent_ may be removed */
+
+#define list_for_each_safe( _ent_, _next_, _list_ )   \
+    for ( (_ent_) = (_list_)->next, (_next_) = (_ent_)->next; \
+    (_ent_) != (_list_);                                      \
+    (_ent_) = (_next_), (_next_) = (_ent_)->next )
+
 /*
  * list_for_each_entry - this function can be use to iterate over all
  * items in a list* _list_ with it's head at _head_ and link _item_
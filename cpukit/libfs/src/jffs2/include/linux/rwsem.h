@@ -1,6 +1,31 @@
 #ifndef __LINUX_RWSEM_H__
 #define __LINUX_RWSEM_H__
 
-struct rw_semaphore;
+struct rw_semaphore { };
+
+static inline void init_rwsem(struct rw_semaphore *sem)
+{
+	(void) sem;
+}
+
+static inline void down_read(struct rw_semaphore *sem)
+{
+	(void) sem;
+}
+
+static inline void up_read(struct rw_semaphore *sem)
+{
+	(void) sem;
+}
+
+static inline void down_write(struct rw_semaphore *sem)
+{
+	(void) sem;
+}
+
+static inline void up_write(struct rw_semaphore *sem)
+{
+	(void) sem;
+}
 
 #endif /* __LINUX_RWSEM_H__ */
@@ -1,4 +1,6 @@
 #ifndef _LINUX_UIO_H
 #define _LINUX_UIO_H
 
+#include <sys/uio.h>
+
 #endif /* _LINUX_UIO_H */
@@ -3,6 +3,8 @@
 
 struct work_struct { } ;
 
+struct delayed_work { } ;
+
 #define INIT_WORK(x,y,z) /* */
 #define schedule_work(x) do { } while(0)
 #define flush_scheduled_work() do { } while(0)
@@ -17,7 +17,7 @@
 #include <linux/kernel.h>
 #include "nodelist.h"
 
-int jffs2_flash_read(struct jffs2_sb_info * c,
+int jffs2_flash_direct_read(struct jffs2_sb_info * c,
 			  cyg_uint32 read_buffer_offset, const size_t size,
 			  size_t * return_size, unsigned char *write_buffer)
 {
@@ -29,7 +29,7 @@ int jffs2_flash_read(struct jffs2_sb_info * c,
 	return (*fc->read)(fc, read_buffer_offset, write_buffer, size);
 }
 
-int jffs2_flash_write(struct jffs2_sb_info * c,
+int jffs2_flash_direct_write(struct jffs2_sb_info * c,
 			   cyg_uint32 write_buffer_offset, const size_t size,
 			   size_t * return_size, unsigned char *read_buffer)
 {
@@ -49,6 +49,15 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 	size_t totlen = 0, thislen;
 	int ret = 0;
 
+	if (jffs2_sum_active()) {
+		ret = jffs2_sum_add_kvec(c, vecs, count, (uint32_t) to);
+		if (ret) {
+			if (retlen)
+				*retlen = 0;
+			return ret;
+		}
+	}
+
 	for (i = 0; i < count; i++) {
 		// writes need to be aligned but the data we're passed may not be
 		// Observation suggests most unaligned writes are small, so we
@@ -84,7 +93,7 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 					cbufptr += vecs[j].iov_len;
 				}
 				ret =
-				    jffs2_flash_write(c, to, sizetomalloc,
+				    jffs2_flash_direct_write(c, to, sizetomalloc,
 						      &thislen, cbuf);
 				if (thislen > totvecsize)	// in case it was aligned up
 					thislen = totvecsize;
@@ -103,14 +112,14 @@ jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 				memcpy(buf, vecs[i].iov_base, lentowrite);
 
 				ret =
-				    jffs2_flash_write(c, to, lentowrite,
+				    jffs2_flash_direct_write(c, to, lentowrite,
 						      &thislen, (char *) &buf);
 				if (thislen > vecs[i].iov_len)
 					thislen = vecs[i].iov_len;
 			}	// else
 		} else
 			ret =
-			    jffs2_flash_write(c, to, vecs[i].iov_len, &thislen,
+			    jffs2_flash_direct_write(c, to, vecs[i].iov_len, &thislen,
 					      vecs[i].iov_base);
 		totlen += thislen;
 		if (ret || thislen != vecs[i].iov_len)
@@ -361,9 +361,12 @@ static void rtems_jffs2_free_fs_info(rtems_jffs2_fs_info *fs_info, bool do_mount
 	if (do_mount_fs_was_successful) {
 		jffs2_free_ino_caches(c);
 		jffs2_free_raw_node_refs(c);
+		jffs2_sum_exit(c);
 		free(c->blocks);
 	}
 
+	jffs2_flash_cleanup(c);
+
 	rtems_jffs2_flash_control_destroy(fs_info->sb.s_flash_control);
 	rtems_jffs2_compressor_control_destroy(fs_info->sb.s_compressor_control);
 	rtems_recursive_mutex_destroy(&sb->s_mutex);
@@ -556,6 +559,15 @@ static int rtems_jffs2_on_demand_garbage_collection(struct jffs2_sb_info *c)
 	}
 }
 
+static int rtems_jffs2_flush_write_buffer(struct jffs2_sb_info *c)
+{
+	if (jffs2_is_readonly(c)) {
+		return 0;
+	}
+
+	return -jffs2_flush_wbuf_gc(c, 0);
+}
+
 static int rtems_jffs2_ioctl(
 	rtems_libio_t   *iop,
 	ioctl_command_t  request,
@@ -578,6 +590,9 @@ static int rtems_jffs2_ioctl(
 		case RTEMS_JFFS2_FORCE_GARBAGE_COLLECTION:
 			eno = -jffs2_garbage_collect_pass(&inode->i_sb->jffs2_sb);
 			break;
+		case RTEMS_JFFS2_FLUSH_WRITE_BUFFER:
+			eno = rtems_jffs2_flush_write_buffer(&inode->i_sb->jffs2_sb);
+			break;
 		default:
 			eno = EINVAL;
 			break;
@@ -588,6 +603,20 @@ static int rtems_jffs2_ioctl(
 	return rtems_jffs2_eno_to_rv_and_errno(eno);
 }
 
+static int rtems_jffs2_fsync(rtems_libio_t *iop)
+{
+	struct _inode *inode = rtems_jffs2_get_inode_by_iop(iop);
+	int eno;
+
+	rtems_jffs2_do_lock(inode->i_sb);
+
+	eno = -jffs2_flush_wbuf_gc(&inode->i_sb->jffs2_sb, inode->i_ino);
+
+	rtems_jffs2_do_unlock(inode->i_sb);
+
+	return rtems_jffs2_eno_to_rv_and_errno(eno);
+}
+
 static const rtems_filesystem_file_handlers_r rtems_jffs2_directory_handlers = {
 	.open_h = rtems_filesystem_default_open,
 	.close_h = rtems_filesystem_default_close,
@@ -597,8 +626,8 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_directory_handlers = {
 	.lseek_h = rtems_filesystem_default_lseek_directory,
 	.fstat_h = rtems_jffs2_fstat,
 	.ftruncate_h = rtems_filesystem_default_ftruncate_directory,
-	.fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
-	.fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+	.fsync_h = rtems_jffs2_fsync,
+	.fdatasync_h = rtems_jffs2_fsync,
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
@@ -740,8 +769,8 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_file_handlers = {
 	.lseek_h = rtems_filesystem_default_lseek_file,
 	.fstat_h = rtems_jffs2_fstat,
 	.ftruncate_h = rtems_jffs2_file_ftruncate,
-	.fsync_h = rtems_filesystem_default_fsync_or_fdatasync,
-	.fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync,
+	.fsync_h = rtems_jffs2_fsync,
+	.fdatasync_h = rtems_jffs2_fsync,
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
@@ -1062,6 +1091,10 @@ static void rtems_jffs2_fsunmount(rtems_filesystem_mount_table_entry_t *mt_entry
 	rtems_jffs2_free_directory_entries(root_i);
 	free(root_i);
 
+	if (!jffs2_is_readonly(&fs_info->sb.jffs2_sb)) {
+		jffs2_flush_wbuf_pad(&fs_info->sb.jffs2_sb);
+	}
+
 	rtems_jffs2_free_fs_info(fs_info, true);
 }
 
@@ -1261,6 +1294,7 @@ int rtems_jffs2_initialize(
 
 	if (err == 0) {
 		sb->s_is_readonly = !mt_entry->writeable;
+		sb->s_use_summary = jffs2_mount_data->enable_summary;
 		sb->s_flash_control = fc;
 		sb->s_compressor_control = jffs2_mount_data->compressor_control;
 
@@ -1270,6 +1304,10 @@ int rtems_jffs2_initialize(
 		c->flash_size = fc->flash_size;
 		c->cleanmarker_size = sizeof(struct jffs2_unknown_node);
 
+		err = jffs2_flash_setup(c);
+	}
+
+	if (err == 0) {
 		err = jffs2_do_mount_fs(c);
 	}
 
@@ -743,6 +743,16 @@ static int jffs2_garbage_collect_pristine(struct jffs2_sb_info *c,
 			ret = -EIO;
 		goto out_node;
 	}
+#ifdef __rtems__
+	/* Buffered writes are collected by jffs2_flash_writev() */
+	if (!jffs2_is_writebuffered(c) && jffs2_sum_active()) {
+		struct kvec vecs[1];
+
+		vecs[0].iov_base = node;
+		vecs[0].iov_len = rawlen;
+		jffs2_sum_add_kvec(c, vecs, 1, phys_ofs);
+	}
+#endif /* __rtems__ */
 	jffs2_add_physical_node_ref(c, phys_ofs | REF_PRISTINE, rawlen, ic);
 
 	jffs2_mark_node_obsolete(c, raw);
@@ -40,6 +40,7 @@
 
 struct _inode;
 struct super_block;
+struct jffs2_eraseblock;
 
 static inline unsigned int full_name_hash(const void *salt, const unsigned char * name, size_t len) {
 
@@ -52,9 +53,6 @@ static inline unsigned int full_name_hash(const void *salt, const unsigned char
 	return hash;
 }
 
-/* NAND flash not currently supported on RTEMS */
-#define jffs2_can_mark_obsolete(c) (1)
-
 #define JFFS2_INODE_INFO(i) (&(i)->jffs2_i)
 #define OFNI_EDONI_2SFFJ(f)  ((struct _inode *) ( ((char *)f) - ((char *)(&((struct _inode *)NULL)->jffs2_i)) ) )
 
@@ -105,6 +103,7 @@ struct super_block {
 	rtems_jffs2_flash_control	*s_flash_control;
 	rtems_jffs2_compressor_control	*s_compressor_control;
 	bool			s_is_readonly;
+	bool			s_use_summary;
 	unsigned char		s_gc_buffer[PAGE_CACHE_SIZE]; // Avoids malloc when user may be under memory pressure
 	rtems_recursive_mutex	s_mutex;
 	char			s_name_buf[JFFS2_MAX_NAME_LEN];
@@ -120,6 +119,13 @@ static inline bool jffs2_is_readonly(struct jffs2_sb_info *c)
 	return sb->s_is_readonly;
 }
 
+static inline bool jffs2_use_summary(struct jffs2_sb_info *c)
+{
+	struct super_block *sb = OFNI_BS_2SFFJ(c);
+
+	return sb->s_use_summary;
+}
+
 static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
 {
 	const struct super_block *sb = OFNI_BS_2SFFJ(c);
@@ -130,6 +136,16 @@ static inline void jffs2_garbage_collect_trigger(struct jffs2_sb_info *c)
 	}
 }
 
+static inline void jffs2_dirty_trigger(struct jffs2_sb_info *c)
+{
+	const struct super_block *sb = OFNI_BS_2SFFJ(c);
+	rtems_jffs2_flash_control *fc = sb->s_flash_control;
+
+	if (fc->trigger_write_buffer_flush != NULL) {
+		(*fc->trigger_write_buffer_flush)(fc);
+	}
+}
+
 /* fs-rtems.c */
 struct _inode *jffs2_new_inode (struct _inode *dir_i, int mode, struct jffs2_raw_inode *ri);
 struct _inode *jffs2_iget(struct super_block *sb, cyg_uint32 ino);
@@ -154,9 +170,9 @@ static inline uint32_t jffs2_to_os_mode (uint32_t jmode)
 
 
 /* flashio.c */
-int jffs2_flash_read(struct jffs2_sb_info *c, cyg_uint32 read_buffer_offset,
+int jffs2_flash_direct_read(struct jffs2_sb_info *c, cyg_uint32 read_buffer_offset,
 			  const size_t size, size_t * return_size, unsigned char * write_buffer);
-int jffs2_flash_write(struct jffs2_sb_info *c, cyg_uint32 write_buffer_offset,
+int jffs2_flash_direct_write(struct jffs2_sb_info *c, cyg_uint32 write_buffer_offset,
 			   const size_t size, size_t * return_size, unsigned char * read_buffer);
 int jffs2_flash_direct_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
 			      unsigned long count, loff_t to, size_t *retlen);
@@ -176,7 +192,33 @@ int jffs2_rename (struct _inode *old_dir_i, struct _inode *d_inode, const unsign
 static inline void jffs2_erase_pending_trigger(struct jffs2_sb_info *c)
 { }
 
-#ifndef CONFIG_JFFS2_FS_WRITEBUFFER
+#ifdef CONFIG_JFFS2_FS_WRITEBUFFER
+#define SECTOR_ADDR(x) ( (((unsigned long)(x) / c->sector_size) * c->sector_size) )
+#define jffs2_is_writebuffered(c) (c->wbuf != NULL)
+#define jffs2_can_mark_obsolete(c) (!jffs2_is_writebuffered(c))
+#define jffs2_wbuf_dirty(c) (!!(c)->wbuf_len)
+
+static inline bool jffs2_cleanmarker_oob(struct jffs2_sb_info *c)
+{
+	const struct super_block *sb = OFNI_BS_2SFFJ(c);
+	const rtems_jffs2_flash_control *fc = sb->s_flash_control;
+
+	return fc->write_size != 0 && fc->oob_size != 0;
+}
+
+/* wbuf.c */
+int jffs2_flash_read(struct jffs2_sb_info *c, cyg_uint32 ofs, const size_t len,
+		     size_t *retlen, unsigned char *buf);
+int jffs2_flash_write(struct jffs2_sb_info *c, cyg_uint32 ofs, const size_t len,
+		      size_t *retlen, unsigned char *buf);
+int jffs2_flash_writev(struct jffs2_sb_info *c, const struct iovec *vecs,
+		       unsigned long count, loff_t to, size_t *retlen, uint32_t ino);
+int jffs2_flash_block_is_bad(struct jffs2_sb_info *c, uint32_t ofs);
+int jffs2_check_oob_empty(struct jffs2_sb_info *c, struct jffs2_eraseblock *jeb, int mode);
+int jffs2_write_nand_badblock(struct jffs2_sb_info *c, struct jffs2_eraseblock *jeb, uint32_t bad_offset);
+int jffs2_flash_setup(struct jffs2_sb_info *c);
+void jffs2_flash_cleanup(struct jffs2_sb_info *c);
+#else
 #define SECTOR_ADDR(x) ( ((unsigned long)(x) & ~(c->sector_size-1)) )
 #define jffs2_can_mark_obsolete(c) (1)
 #define jffs2_is_writebuffered(c) (0)
@@ -185,17 +227,13 @@ static inline void jffs2_erase_pending_trigger(struct jffs2_sb_info *c)
 
 #define jffs2_flush_wbuf_pad(c) (c=c)
 #define jffs2_flush_wbuf_gc(c, i) ({ (void)(c), (void) i, 0; })
-#define jffs2_nand_read_failcnt(c,jeb) do { ; } while(0)
 #define jffs2_write_nand_badblock(c,jeb,p) (0)
 #define jffs2_flash_setup(c) (0)
-#define jffs2_nand_flash_cleanup(c) do {} while(0)
+#define jffs2_flash_cleanup(c) do {} while(0)
 #define jffs2_wbuf_dirty(c) (0)
+#define jffs2_flash_read(c,ofs,len,retlen,buf) jffs2_flash_direct_read(c,ofs,len,retlen,buf)
+#define jffs2_flash_write(c,ofs,len,retlen,buf) jffs2_flash_direct_write(c,ofs,len,retlen,buf)
 #define jffs2_flash_writev(a,b,c,d,e,f) jffs2_flash_direct_writev(a,b,c,d,e)
-#define jffs2_wbuf_timeout NULL
-#define jffs2_wbuf_process NULL
-#define jffs2_nor_ecc(c) (0)
-#else
-#error no nand yet
 #endif
 
 #ifndef BUG_ON
@@ -1,2 +1,4 @@
 #define __ECOS 1
 #define KBUILD_MODNAME "JFFS2"
+#define CONFIG_JFFS2_SUMMARY 1
+#define CONFIG_JFFS2_FS_WRITEBUFFER 1
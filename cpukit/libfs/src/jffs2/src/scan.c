@@ -283,6 +283,7 @@ int jffs2_scan_medium(struct jffs2_sb_info *c)
 	else
 		mtd_unpoint(c->mtd, 0, c->mtd->size);
 #endif
+	jffs2_sum_reset_collected(s);
 	kfree(s);
 	return ret;
 }
@@ -465,7 +466,11 @@ static int jffs2_scan_eraseblock (struct jffs2_sb_info *c, struct jffs2_eraseblo
 	if (jffs2_cleanmarker_oob(c)) {
 		int ret;
 
+#ifndef __rtems__
 		if (mtd_block_isbad(c->mtd, jeb->offset))
+#else /* __rtems__ */
+		if (jffs2_flash_block_is_bad(c, jeb->offset))
+#endif /* __rtems__ */
 			return BLK_STATE_BADBLOCK;
 
 		ret = jffs2_check_nand_cleanmarker(c, jeb);
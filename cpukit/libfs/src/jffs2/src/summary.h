@@ -171,7 +171,12 @@ struct jffs2_sum_marker
 
 #ifdef CONFIG_JFFS2_SUMMARY	/* SUMMARY SUPPORT ENABLED */
 
+#ifndef __rtems__
 #define jffs2_sum_active() (1)
+#else /* __rtems__ */
+/* The summary support is enabled at mount time, see jffs2_sum_init() */
+#define jffs2_sum_active() (c->summary != NULL)
+#endif /* __rtems__ */
 int jffs2_sum_init(struct jffs2_sb_info *c);
 void jffs2_sum_exit(struct jffs2_sb_info *c);
 void jffs2_sum_disable_collecting(struct jffs2_summary *s);
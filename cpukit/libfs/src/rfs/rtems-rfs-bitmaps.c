@@ -581,6 +581,43 @@ rtems_rfs_bitmap_map_alloc (rtems_rfs_bitmap_control* control,
   return 0;
 }
 
+int
+rtems_rfs_bitmap_map_extend (rtems_rfs_bitmap_control* control,
+                             rtems_rfs_bitmap_bit      bit,
+                             size_t                    count,
+                             size_t*                   extended)
+{
+  rtems_rfs_bitmap_map map;
+  int                  rc;
+
+  *extended = 0;
+
+  rc = rtems_rfs_bitmap_load_map (control, &map);
+  if (rc > 0)
+    return rc;
+
+  /*
+   * Set bits following the bit until a set bit or the end of the map is
+   * reached.
+   */
+  while ((*extended < count) && (++bit < control->size))
+  {
+    int index  = rtems_rfs_bitmap_map_index (bit);
+    int offset = rtems_rfs_bitmap_map_offset (bit);
+
+    if (rtems_rfs_bitmap_test (map[index], offset))
+      break;
+
+    rc = rtems_rfs_bitmap_map_set (control, bit);
+    if (rc > 0)
+      return rc;
+
+    ++(*extended);
+  }
+
+  return 0;
+}
+
 int
 rtems_rfs_bitmap_create_search (rtems_rfs_bitmap_control* control)
 {
@@ -107,6 +107,9 @@ rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
 
   map->dirty = false;
   map->inode = NULL;
+  map->reserved = 0;
+  map->reserved_count = 0;
+  map->reserve_window = 0;
   rtems_rfs_block_set_size_zero (&map->size);
   rtems_rfs_block_set_bpos_zero (&map->bpos);
 
@@ -149,6 +152,18 @@ rtems_rfs_block_map_close (rtems_rfs_file_system* fs,
   int rc = 0;
   int brc;
 
+  /*
+   * Return the blocks reserved but not used to the bitmaps.
+   */
+  while (map->reserved_count)
+  {
+    brc = rtems_rfs_group_bitmap_free (fs, false, map->reserved);
+    if ((brc > 0) && (rc == 0))
+      rc = brc;
+    map->reserved++;
+    map->reserved_count--;
+  }
+
   if (map->dirty && map->inode)
   {
     brc = rtems_rfs_inode_load (fs, map->inode);
@@ -402,6 +417,74 @@ rtems_rfs_block_map_indirect_alloc (rtems_rfs_file_system*   fs,
   return 0;
 }
 
+int
+rtems_rfs_block_map_reserve (rtems_rfs_file_system* fs,
+                             rtems_rfs_block_map*   map,
+                             size_t                 blocks)
+{
+  rtems_rfs_bitmap_bit block;
+  size_t               count;
+  int                  rc;
+
+  if (map->reserved_count)
+    return 0;
+
+  count = blocks;
+  if (count < map->reserve_window)
+    count = map->reserve_window;
+
+  /*
+   * A single block is allocated when the map grows.
+   */
+  if (count <= 1)
+    return 0;
+
+  rc = rtems_rfs_group_bitmap_alloc_blocks (fs, map->last_data_block, count,
+                                            &block, &count);
+  if (rc > 0)
+    return rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_MAP_GROW))
+    printf ("rtems-rfs: block-map-reserve: block=%" PRIu32 " count=%zu\n",
+            block, count);
+
+  map->reserved = block;
+  map->reserved_count = count;
+  return 0;
+}
+
+/**
+ * Allocate a data block for the map. The block is taken from the reservation
+ * if the map has one.
+ *
+ * @param fs The file system data.
+ * @param map The map the allocation is for.
+ * @param blocks The number of blocks the map still grows by.
+ * @param block The block allocated.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_alloc_data (rtems_rfs_file_system* fs,
+                                rtems_rfs_block_map*   map,
+                                size_t                 blocks,
+                                rtems_rfs_bitmap_bit*  block)
+{
+  int rc;
+
+  rc = rtems_rfs_block_map_reserve (fs, map, blocks);
+  if (rc > 0)
+    return rc;
+
+  if (map->reserved_count == 0)
+    return rtems_rfs_group_bitmap_alloc (fs, map->last_data_block,
+                                         false, block);
+
+  *block = map->reserved;
+  map->reserved++;
+  map->reserved_count--;
+  return 0;
+}
+
 int
 rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
                           rtems_rfs_block_map*   map,
@@ -418,8 +501,10 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
     return EFBIG;
 
   /*
-   * Allocate a block at a time. The buffer handles hold the blocks so adding
-   * this way does not thrash the cache with lots of requests.
+   * Add a block at a time. The buffer handles hold the blocks so adding this
+   * way does not thrash the cache with lots of requests. The data blocks come
+   * from a reservation of contiguous blocks if more than one is needed or the
+   * map has a reserve window.
    */
   for (b = 0; b < blocks; b++)
   {
@@ -431,8 +516,7 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
      * allocated free this block.
      */
 
-    rc = rtems_rfs_group_bitmap_alloc (fs, map->last_data_block,
-                                       false, &block);
+    rc = rtems_rfs_block_map_alloc_data (fs, map, blocks - b, &block);
     if (rc > 0)
       return rc;
 
@@ -22,57 +22,176 @@
 #include <inttypes.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <rtems/rfs/rtems-rfs-buffer.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 
 /**
- * Scan the chain for a buffer that matches the block number.
+ * The initial number of entries of the buffer hash table.
+ */
+#define RTEMS_RFS_BUFFER_HASH_INITIAL_SIZE (32)
+
+/**
+ * Return the hash table slot of a block.
  *
- * @param chain The chain to scan.
- * @param count The number of items on the chain.
+ * @param block The block number.
+ * @param size The number of entries of the table.
+ * @return uint32_t The slot.
+ */
+static uint32_t
+rtems_rfs_buffer_hash (rtems_rfs_buffer_block block, uint32_t size)
+{
+  uint32_t hash = ((uint32_t) block) * UINT32_C (0x9e3779b1);
+  return (hash ^ (hash >> 16)) & (size - 1);
+}
+
+/**
+ * Find the hash table entry of a held buffer.
+ *
+ * @param fs The file system data.
  * @param block The block number to find.
- * @return  rtems_rfs_buffer* The buffer if found else NULL.
+ * @return rtems_rfs_buffer_hash_entry* The entry if found else NULL.
  */
-static rtems_rfs_buffer*
-rtems_rfs_scan_chain (rtems_chain_control*   chain,
-                      uint32_t*              count,
-                      rtems_rfs_buffer_block block)
+static rtems_rfs_buffer_hash_entry*
+rtems_rfs_buffer_hash_find (rtems_rfs_file_system* fs,
+                            rtems_rfs_buffer_block block)
 {
-  rtems_rfs_buffer* buffer;
-  rtems_chain_node* node;
+  uint32_t slot;
 
-  node = rtems_chain_last (chain);
+  if (fs->buffer_hash_count == 0)
+    return NULL;
 
-  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
-    printf ("rtems-rfs: buffer-scan: count=%" PRIu32 ", block=%" PRIu32 ": ", *count, block);
+  slot = rtems_rfs_buffer_hash (block, fs->buffer_hash_size);
 
-  while (!rtems_chain_is_head (chain, node))
+  while (fs->buffer_hash[slot].buffer)
   {
-    buffer = (rtems_rfs_buffer*) node;
+    if (fs->buffer_hash[slot].block == block)
+      return &fs->buffer_hash[slot];
+    slot = (slot + 1) & (fs->buffer_hash_size - 1);
+  }
 
-    if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
-      printf ("%" PRIiPTR " ", ((intptr_t) buffer->user));
+  return NULL;
+}
+
+/**
+ * Place an entry in the first free slot of the table. The table must have a
+ * free slot.
+ */
+static void
+rtems_rfs_buffer_hash_place (rtems_rfs_buffer_hash_entry*       table,
+                             uint32_t                           size,
+                             const rtems_rfs_buffer_hash_entry* entry)
+{
+  uint32_t slot;
+
+  slot = rtems_rfs_buffer_hash (entry->block, size);
+
+  while (table[slot].buffer)
+    slot = (slot + 1) & (size - 1);
+
+  table[slot] = *entry;
+}
+
+/**
+ * Add a buffer to the hash table. The table is grown to keep at least half of
+ * the slots free.
+ *
+ * @param fs The file system data.
+ * @param block The block number of the buffer.
+ * @param buffer The buffer.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_buffer_hash_insert (rtems_rfs_file_system* fs,
+                              rtems_rfs_buffer_block block,
+                              rtems_rfs_buffer*      buffer)
+{
+  rtems_rfs_buffer_hash_entry entry;
+
+  if (((fs->buffer_hash_count + 1) * 2) > fs->buffer_hash_size)
+  {
+    rtems_rfs_buffer_hash_entry* table;
+    uint32_t                     size;
+    uint32_t                     slot;
+
+    if (fs->buffer_hash_size)
+      size = fs->buffer_hash_size * 2;
+    else
+      size = RTEMS_RFS_BUFFER_HASH_INITIAL_SIZE;
+
+    table = calloc (size, sizeof (rtems_rfs_buffer_hash_entry));
+    if (!table)
+      return ENOMEM;
+
+    for (slot = 0; slot < fs->buffer_hash_size; slot++)
+      if (fs->buffer_hash[slot].buffer)
+        rtems_rfs_buffer_hash_place (table, size, &fs->buffer_hash[slot]);
+
+    free (fs->buffer_hash);
+    fs->buffer_hash = table;
+    fs->buffer_hash_size = size;
+  }
 
-    if (((rtems_rfs_buffer_block) ((intptr_t)(buffer->user))) == block)
+  entry.block = block;
+  entry.buffer = buffer;
+  entry.modified = false;
+
+  rtems_rfs_buffer_hash_place (fs->buffer_hash, fs->buffer_hash_size, &entry);
+  fs->buffer_hash_count++;
+
+  return 0;
+}
+
+/**
+ * Remove a buffer from the hash table. The following entries of the probe
+ * sequence are moved up so no deleted markers are needed.
+ *
+ * @param fs The file system data.
+ * @param block The block number of the buffer.
+ */
+static void
+rtems_rfs_buffer_hash_remove (rtems_rfs_file_system* fs,
+                              rtems_rfs_buffer_block block)
+{
+  rtems_rfs_buffer_hash_entry* entry;
+  uint32_t                     mask;
+  uint32_t                     hole;
+  uint32_t                     slot;
+
+  entry = rtems_rfs_buffer_hash_find (fs, block);
+  if (!entry)
+    return;
+
+  mask = fs->buffer_hash_size - 1;
+  hole = entry - fs->buffer_hash;
+  slot = hole;
+
+  while (true)
+  {
+    uint32_t home;
+
+    slot = (slot + 1) & mask;
+
+    if (!fs->buffer_hash[slot].buffer)
+      break;
+
+    /*
+     * An entry can only move to the hole if the hole is not before its home
+     * slot in the probe sequence.
+     */
+    home = rtems_rfs_buffer_hash (fs->buffer_hash[slot].block,
+                                  fs->buffer_hash_size);
+    if (((slot - home) & mask) >= ((slot - hole) & mask))
     {
-      if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
-        printf (": found block=%" PRIiPTR "\n",
-                ((intptr_t)(buffer->user)));
-
-      (*count)--;
-      rtems_chain_extract_unprotected (node);
-      rtems_chain_set_off_chain (node);
-      return buffer;
+      fs->buffer_hash[hole] = fs->buffer_hash[slot];
+      hole = slot;
     }
-    node = rtems_chain_previous (node);
   }
 
-  if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
-    printf (": not found\n");
-
-  return NULL;
+  fs->buffer_hash[hole].buffer = NULL;
+  fs->buffer_hash_count--;
 }
 
 int
@@ -81,7 +200,8 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
                                  rtems_rfs_buffer_block   block,
                                  bool                     read)
 {
-  int rc;
+  rtems_rfs_buffer_hash_entry* entry;
+  int                          rc;
 
   /*
    * If the handle has a buffer release it. This allows a handle to be reused
@@ -110,53 +230,48 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
     printf ("rtems-rfs: buffer-request: block=%" PRIu32 "\n", block);
 
   /*
-   * First check to see if the buffer has already been requested and is
-   * currently attached to a handle. If it is share the access. A buffer could
-   * be shared where different parts of the block have separate functions. An
-   * example is an inode block and the file system needs to handle 2 inodes in
-   * the same block at the same time.
+   * First check to see if the buffer is held by the file system. If it is
+   * currently attached to a handle share the access. A buffer could be shared
+   * where different parts of the block have separate functions. An example is
+   * an inode block and the file system needs to handle 2 inodes in the same
+   * block at the same time. If it is on the local cache of released buffers
+   * take it from the cache. There are release and released modified lists to
+   * preserve the state.
    */
-  if (fs->buffers_count)
+  entry = rtems_rfs_buffer_hash_find (fs, block);
+  if (entry)
   {
-    /*
-     * Check the active buffer list for shared buffers.
-     */
-    handle->buffer = rtems_rfs_scan_chain (&fs->buffers,
-                                           &fs->buffers_count,
-                                           block);
-    if (rtems_rfs_buffer_handle_has_block (handle) &&
-        rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
-      printf ("rtems-rfs: buffer-request: buffer shared: refs: %d\n",
-              rtems_rfs_buffer_refs (handle) + 1);
-  }
+    handle->buffer = entry->buffer;
 
-  /*
-   * If the buffer has not been found check the local cache of released
-   * buffers. There are release and released modified lists to preserve the
-   * state.
-   */
-  if (!rtems_rfs_fs_no_local_cache (fs) &&
-      !rtems_rfs_buffer_handle_has_block (handle))
-  {
-    /*
-     * Check the local cache of released buffers.
-     */
-    if (fs->release_count)
-      handle->buffer = rtems_rfs_scan_chain (&fs->release,
-                                             &fs->release_count,
-                                             block);
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
+      printf ("rtems-rfs: buffer-hash: count=%" PRIu32 ", block=%" PRIu32
+              ": found refs=%d%s\n", fs->buffer_hash_count, block,
+              rtems_rfs_buffer_refs (handle),
+              entry->modified ? " (modified)" : "");
+
+    rtems_chain_extract_unprotected (rtems_rfs_buffer_link (handle));
+    rtems_chain_set_off_chain (rtems_rfs_buffer_link (handle));
 
-    if (!rtems_rfs_buffer_handle_has_block (handle) &&
-        fs->release_modified_count)
+    if (rtems_rfs_buffer_refs (handle) > 0)
+    {
+      fs->buffers_count--;
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
+        printf ("rtems-rfs: buffer-request: buffer shared: refs: %d\n",
+                rtems_rfs_buffer_refs (handle) + 1);
+    }
+    else if (entry->modified)
     {
-      handle->buffer = rtems_rfs_scan_chain (&fs->release_modified,
-                                             &fs->release_modified_count,
-                                             block);
+      fs->release_modified_count--;
+      entry->modified = false;
+
       /*
-       * If we found a buffer retain the dirty buffer state.
+       * Retain the dirty buffer state.
        */
-      if (rtems_rfs_buffer_handle_has_block (handle))
-        rtems_rfs_buffer_mark_dirty (handle);
+      rtems_rfs_buffer_mark_dirty (handle);
+    }
+    else
+    {
+      fs->release_count--;
     }
   }
 
@@ -175,6 +290,17 @@ rtems_rfs_buffer_handle_request (rtems_rfs_file_system*   fs,
       return rc;
     }
 
+    rc = rtems_rfs_buffer_hash_insert (fs, block, handle->buffer);
+    if (rc > 0)
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_HANDLE_REQUEST))
+        printf ("rtems-rfs: buffer-request: block=%" PRIu32 ": hash: %d: %s\n",
+                block, rc, strerror (rc));
+      rtems_rfs_buffer_io_release (handle->buffer, false);
+      handle->buffer = NULL;
+      return rc;
+    }
+
     rtems_chain_set_off_chain (rtems_rfs_buffer_link(handle));
   }
 
@@ -201,7 +327,8 @@ int
 rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
                                  rtems_rfs_buffer_handle* handle)
 {
-  int rc = 0;
+  rtems_rfs_buffer_hash_entry* entry;
+  int                          rc = 0;
 
   if (rtems_rfs_buffer_handle_has_block (handle))
   {
@@ -222,6 +349,7 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
 
       if (rtems_rfs_fs_no_local_cache (fs))
       {
+        rtems_rfs_buffer_hash_remove (fs, rtems_rfs_buffer_bnum (handle));
         handle->buffer->user = (void*) 0;
         rc = rtems_rfs_buffer_io_release (handle->buffer,
                                           rtems_rfs_buffer_dirty (handle));
@@ -261,6 +389,8 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
             fs->release_modified_count--;
             modified = true;
           }
+          rtems_rfs_buffer_hash_remove (fs, (rtems_rfs_buffer_block)
+                                        ((intptr_t) buffer->user));
           buffer->user = (void*) 0;
           rc = rtems_rfs_buffer_io_release (buffer, modified);
         }
@@ -277,6 +407,9 @@ rtems_rfs_buffer_handle_release (rtems_rfs_file_system*   fs,
                                           rtems_rfs_buffer_link (handle));
           fs->release_count++;
         }
+
+        entry = rtems_rfs_buffer_hash_find (fs, rtems_rfs_buffer_bnum (handle));
+        entry->modified = rtems_rfs_buffer_dirty (handle);
       }
     }
     handle->buffer = NULL;
@@ -364,6 +497,11 @@ rtems_rfs_buffer_close (rtems_rfs_file_system* fs)
     printf ("rtems-rfs: buffer-close: set media block size failed: %d: %s\n",
             rc, strerror (rc));
 
+  free (fs->buffer_hash);
+  fs->buffer_hash = NULL;
+  fs->buffer_hash_size = 0;
+  fs->buffer_hash_count = 0;
+
   if (close (fs->device) < 0)
   {
     rc = errno;
@@ -436,10 +574,47 @@ rtems_rfs_buffer_setblksize (rtems_rfs_file_system* fs, uint32_t size)
   return rc;
 }
 
+/**
+ * Sort the buffers of the chain in block order. The buffers are inserted
+ * from the tail of the sorted chain so blocks released in order cost a single
+ * compare.
+ *
+ * @param chain The chain to sort.
+ */
+static void
+rtems_rfs_sort_chain (rtems_chain_control* chain)
+{
+  rtems_chain_control sorted;
+
+  rtems_chain_initialize_empty (&sorted);
+
+  while (!rtems_chain_is_empty (chain))
+  {
+    rtems_chain_node*      node = rtems_chain_get_unprotected (chain);
+    rtems_chain_node*      tnode = rtems_chain_last (&sorted);
+    rtems_rfs_buffer_block block;
+
+    block = (rtems_rfs_buffer_block)
+      ((intptr_t) ((rtems_rfs_buffer*) node)->user);
+
+    while (!rtems_chain_is_head (&sorted, tnode) &&
+           (block < ((rtems_rfs_buffer_block)
+                     ((intptr_t) ((rtems_rfs_buffer*) tnode)->user))))
+      tnode = rtems_chain_previous (tnode);
+
+    rtems_chain_insert_unprotected (tnode, node);
+  }
+
+  while (!rtems_chain_is_empty (&sorted))
+    rtems_chain_append_unprotected (chain,
+                                    rtems_chain_get_unprotected (&sorted));
+}
+
 static int
-rtems_rfs_release_chain (rtems_chain_control* chain,
-                         uint32_t*            count,
-                         bool                 modified)
+rtems_rfs_release_chain (rtems_rfs_file_system* fs,
+                         rtems_chain_control*   chain,
+                         uint32_t*              count,
+                         bool                   modified)
 {
   rtems_rfs_buffer* buffer;
   int               rrc = 0;
@@ -448,11 +623,21 @@ rtems_rfs_release_chain (rtems_chain_control* chain,
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_BUFFER_CHAINS))
     printf ("rtems-rfs: release-chain: count=%" PRIu32 "\n", *count);
 
+  /*
+   * Release the modified buffers in block order. The cache writes the
+   * modified buffers in the order they are released and merges consecutive
+   * blocks into a single transfer.
+   */
+  if (modified && (*count > 1))
+    rtems_rfs_sort_chain (chain);
+
   while (!rtems_chain_is_empty (chain))
   {
     buffer = (rtems_rfs_buffer*) rtems_chain_get_unprotected (chain);
     (*count)--;
 
+    rtems_rfs_buffer_hash_remove (fs, (rtems_rfs_buffer_block)
+                                  ((intptr_t) buffer->user));
     buffer->user = (void*) 0;
 
     rc = rtems_rfs_buffer_io_release (buffer, modified);
@@ -473,12 +658,12 @@ rtems_rfs_buffers_release (rtems_rfs_file_system* fs)
             "release:%" PRIu32 " release-modified:%" PRIu32 "\n",
             fs->buffers_count, fs->release_count, fs->release_modified_count);
 
-  rc = rtems_rfs_release_chain (&fs->release,
+  rc = rtems_rfs_release_chain (fs, &fs->release,
                                 &fs->release_count,
                                 false);
   if ((rc > 0) && (rrc == 0))
     rrc = rc;
-  rc = rtems_rfs_release_chain (&fs->release_modified,
+  rc = rtems_rfs_release_chain (fs, &fs->release_modified,
                                 &fs->release_modified_count,
                                 true);
   if ((rc > 0) && (rrc == 0))
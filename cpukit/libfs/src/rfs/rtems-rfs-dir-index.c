@@ -0,0 +1,423 @@
+/**
+ * @file
+ *
+ * @ingroup rtems_rfs
+ *
+ * @brief RTEMS File Systems Directory Index Routines
+ *
+ * The index of a directory is a hash table with chaining. The chains are
+ * linked through indexes into the entry table so an entry needs 12 bytes. A
+ * removed entry is replaced by the last entry of the table to keep the table
+ * dense.
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/rfs/rtems-rfs-buffer.h>
+#include <rtems/rfs/rtems-rfs-dir.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
+#include <rtems/rfs/rtems-rfs-trace.h>
+
+/**
+ * The initial number of buckets and entries of an index.
+ */
+#define RTEMS_RFS_DIR_INDEX_INITIAL_SIZE (64)
+
+static rtems_rfs_dir_index*
+rtems_rfs_dir_index_find (rtems_rfs_file_system* fs, rtems_rfs_ino dir)
+{
+  rtems_chain_node* node;
+
+  node = rtems_chain_first (&fs->dir_indexes);
+
+  while (!rtems_chain_is_tail (&fs->dir_indexes, node))
+  {
+    rtems_rfs_dir_index* index = (rtems_rfs_dir_index*) node;
+
+    if (index->ino == dir)
+      return index;
+
+    node = rtems_chain_next (node);
+  }
+
+  return NULL;
+}
+
+static void
+rtems_rfs_dir_index_free (rtems_rfs_file_system* fs,
+                          rtems_rfs_dir_index*   index)
+{
+  rtems_chain_extract (&index->link);
+  fs->dir_index_count--;
+  free (index->buckets);
+  free (index->entries);
+  free (index);
+}
+
+static bool
+rtems_rfs_dir_index_rehash (rtems_rfs_dir_index* index, uint32_t buckets)
+{
+  uint32_t* table;
+  uint32_t  e;
+
+  table = malloc (buckets * sizeof (*table));
+  if (!table)
+    return false;
+
+  memset (table, 0xff, buckets * sizeof (*table));
+
+  free (index->buckets);
+  index->buckets = table;
+  index->bucket_mask = buckets - 1;
+
+  for (e = 0; e < index->count; e++)
+  {
+    rtems_rfs_dir_index_entry* entry = &index->entries[e];
+    uint32_t*                  head;
+
+    head = &table[entry->hash & index->bucket_mask];
+    entry->next = *head;
+    *head = e;
+  }
+
+  return true;
+}
+
+static bool
+rtems_rfs_dir_index_insert (rtems_rfs_dir_index* index,
+                            uint32_t             hash,
+                            rtems_rfs_block_no   bno)
+{
+  rtems_rfs_dir_index_entry* entry;
+  uint32_t*                  head;
+
+  if (index->count == index->size)
+  {
+    rtems_rfs_dir_index_entry* entries;
+    uint32_t                   size = index->size * 2;
+
+    entries = realloc (index->entries, size * sizeof (*entries));
+    if (!entries)
+      return false;
+
+    index->entries = entries;
+    index->size = size;
+  }
+
+  /*
+   * Keep the chains short by growing the bucket table with the entries.
+   */
+  if (index->count > (2 * (index->bucket_mask + 1)))
+  {
+    if (!rtems_rfs_dir_index_rehash (index, 2 * (index->bucket_mask + 1)))
+      return false;
+  }
+
+  head = &index->buckets[hash & index->bucket_mask];
+  entry = &index->entries[index->count];
+  entry->hash = hash;
+  entry->bno = bno;
+  entry->next = *head;
+  *head = index->count;
+  index->count++;
+
+  return true;
+}
+
+static int
+rtems_rfs_dir_index_build (rtems_rfs_file_system*  fs,
+                           rtems_rfs_inode_handle* dir,
+                           rtems_rfs_block_map*    map,
+                           rtems_rfs_dir_index*    index)
+{
+  rtems_rfs_buffer_handle entries;
+  rtems_rfs_block_no      block;
+  int                     rc;
+
+  rc = rtems_rfs_buffer_handle_open (fs, &entries);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_block_map_seek (fs, map, 0, &block);
+
+  while (rc == 0)
+  {
+    uint8_t* entry;
+    int      offset;
+
+    rc = rtems_rfs_buffer_handle_request (fs, &entries, block, true);
+    if (rc > 0)
+      break;
+
+    entry  = rtems_rfs_buffer_data (&entries);
+    offset = 0;
+
+    while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+    {
+      int elength;
+
+      elength = rtems_rfs_dir_entry_length (entry);
+
+      if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+        break;
+
+      if ((elength <= RTEMS_RFS_DIR_ENTRY_SIZE) ||
+          (elength >= rtems_rfs_fs_max_name (fs)))
+      {
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+          printf ("rtems-rfs: dir-index: "
+                  "bad length for ino %" PRIu32 ": %u @ %" PRIu32 ".%04x\n",
+                  rtems_rfs_inode_ino (dir), elength, map->bpos.bno, offset);
+        rc = EIO;
+        break;
+      }
+
+      if (!rtems_rfs_dir_index_insert (index,
+                                       rtems_rfs_dir_entry_hash (entry),
+                                       map->bpos.bno))
+      {
+        rc = ENOMEM;
+        break;
+      }
+
+      entry  += elength;
+      offset += elength;
+    }
+
+    if (rc == 0)
+      rc = rtems_rfs_block_map_next_block (fs, map, &block);
+  }
+
+  if (rc == ENXIO)
+    rc = 0;
+
+  rtems_rfs_buffer_handle_close (fs, &entries);
+  return rc;
+}
+
+int
+rtems_rfs_dir_index_get (rtems_rfs_file_system*  fs,
+                         rtems_rfs_inode_handle* dir,
+                         rtems_rfs_block_map*    map,
+                         rtems_rfs_dir_index**   index)
+{
+  rtems_rfs_ino ino = rtems_rfs_inode_ino (dir);
+  int           rc;
+
+  *index = NULL;
+
+  if (!rtems_rfs_fs_dir_index (fs) ||
+      (rtems_rfs_block_map_count (map) < RTEMS_RFS_DIR_INDEX_MIN_BLOCKS))
+    return 0;
+
+  *index = rtems_rfs_dir_index_find (fs, ino);
+  if (*index)
+  {
+    rtems_chain_extract (&(*index)->link);
+    rtems_chain_prepend (&fs->dir_indexes, &(*index)->link);
+    return 0;
+  }
+
+  if (fs->dir_index_count >= RTEMS_RFS_DIR_INDEX_MAX_DIRS)
+    rtems_rfs_dir_index_free (fs,
+      (rtems_rfs_dir_index*) rtems_chain_last (&fs->dir_indexes));
+
+  *index = calloc (1, sizeof (rtems_rfs_dir_index));
+  if (!*index)
+    return 0;
+
+  (*index)->ino = ino;
+  (*index)->size = RTEMS_RFS_DIR_INDEX_INITIAL_SIZE;
+  (*index)->entries = malloc ((*index)->size * sizeof (rtems_rfs_dir_index_entry));
+  rtems_chain_prepend (&fs->dir_indexes, &(*index)->link);
+  fs->dir_index_count++;
+
+  if (!(*index)->entries ||
+      !rtems_rfs_dir_index_rehash (*index, RTEMS_RFS_DIR_INDEX_INITIAL_SIZE))
+    rc = ENOMEM;
+  else
+    rc = rtems_rfs_dir_index_build (fs, dir, map, *index);
+
+  if (rc > 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: build failed for ino %" PRIu32 ": %d: %s\n",
+              ino, rc, strerror (rc));
+    rtems_rfs_dir_index_free (fs, *index);
+    *index = NULL;
+
+    /*
+     * Without memory for the index the directory is searched block by block.
+     */
+    if (rc == ENOMEM)
+      rc = 0;
+
+    return rc;
+  }
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: built for ino %" PRIu32 ": entries=%" PRIu32
+            " blocks=%" PRIu32 "\n",
+            ino, (*index)->count, rtems_rfs_block_map_count (map));
+
+  return 0;
+}
+
+bool
+rtems_rfs_dir_index_next (const rtems_rfs_dir_index* index,
+                          uint32_t                   hash,
+                          uint32_t*                  cursor,
+                          rtems_rfs_block_no*        bno)
+{
+  uint32_t e;
+
+  if (*cursor == RTEMS_RFS_DIR_INDEX_END)
+    e = index->buckets[hash & index->bucket_mask];
+  else
+    e = index->entries[*cursor].next;
+
+  while (e != RTEMS_RFS_DIR_INDEX_END)
+  {
+    const rtems_rfs_dir_index_entry* entry = &index->entries[e];
+
+    if (entry->hash == hash)
+    {
+      *cursor = e;
+      *bno = entry->bno;
+      return true;
+    }
+
+    e = entry->next;
+  }
+
+  return false;
+}
+
+void
+rtems_rfs_dir_index_add (rtems_rfs_file_system* fs,
+                         rtems_rfs_ino          dir,
+                         uint32_t               hash,
+                         rtems_rfs_block_no     bno)
+{
+  rtems_rfs_dir_index* index;
+
+  index = rtems_rfs_dir_index_find (fs, dir);
+  if (index && !rtems_rfs_dir_index_insert (index, hash, bno))
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: no memory to add to ino %" PRIu32 "\n",
+              dir);
+    rtems_rfs_dir_index_free (fs, index);
+  }
+}
+
+void
+rtems_rfs_dir_index_remove (rtems_rfs_file_system* fs,
+                            rtems_rfs_ino          dir,
+                            uint32_t               hash,
+                            rtems_rfs_block_no     bno)
+{
+  rtems_rfs_dir_index* index;
+  uint32_t*            link;
+  uint32_t             e;
+  uint32_t             last;
+
+  index = rtems_rfs_dir_index_find (fs, dir);
+  if (!index)
+    return;
+
+  link = &index->buckets[hash & index->bucket_mask];
+
+  while (*link != RTEMS_RFS_DIR_INDEX_END)
+  {
+    rtems_rfs_dir_index_entry* entry = &index->entries[*link];
+
+    if ((entry->hash == hash) && (entry->bno == bno))
+      break;
+
+    link = &entry->next;
+  }
+
+  if (*link == RTEMS_RFS_DIR_INDEX_END)
+  {
+    /*
+     * The index does not match the directory. Release it and build it again
+     * on the next look up.
+     */
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+      printf ("rtems-rfs: dir-index: entry not found in ino %" PRIu32
+              ": hash=%08" PRIx32 " bno=%" PRIu32 "\n", dir, hash, bno);
+    rtems_rfs_dir_index_free (fs, index);
+    return;
+  }
+
+  /*
+   * Unlink the entry and move the last entry of the table into its slot.
+   */
+  e = *link;
+  *link = index->entries[e].next;
+  last = index->count - 1;
+
+  if (e != last)
+  {
+    link = &index->buckets[index->entries[last].hash & index->bucket_mask];
+    while (*link != last)
+      link = &index->entries[*link].next;
+    *link = e;
+    index->entries[e] = index->entries[last];
+  }
+
+  index->count = last;
+}
+
+void
+rtems_rfs_dir_index_release (rtems_rfs_file_system* fs,
+                             rtems_rfs_ino          dir)
+{
+  rtems_rfs_dir_index* index;
+
+  index = rtems_rfs_dir_index_find (fs, dir);
+  if (index)
+    rtems_rfs_dir_index_free (fs, index);
+}
+
+void
+rtems_rfs_dir_index_close (rtems_rfs_file_system* fs)
+{
+  while (!rtems_chain_is_empty (&fs->dir_indexes))
+    rtems_rfs_dir_index_free (fs,
+      (rtems_rfs_dir_index*) rtems_chain_first (&fs->dir_indexes));
+}
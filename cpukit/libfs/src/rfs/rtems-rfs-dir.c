@@ -38,6 +38,7 @@
 #include <rtems/rfs/rtems-rfs-trace.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
 #include <rtems/rfs/rtems-rfs-dir-hash.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 
 /**
  * Validate the directory entry data.
@@ -46,6 +47,101 @@
   (((_l) <= RTEMS_RFS_DIR_ENTRY_SIZE) || ((_l) >= rtems_rfs_fs_max_name (_f)) \
    || (_i < RTEMS_RFS_ROOT_INO) || (_i > rtems_rfs_fs_inodes (_f)))
 
+/**
+ * Search a directory block for the name. The map position is the block to
+ * search.
+ */
+static int
+rtems_rfs_dir_search_block (rtems_rfs_file_system*   fs,
+                            rtems_rfs_inode_handle*  inode,
+                            rtems_rfs_block_map*     map,
+                            rtems_rfs_buffer_handle* entries,
+                            rtems_rfs_block_no       block,
+                            uint32_t                 hash,
+                            const char*              name,
+                            int                      length,
+                            rtems_rfs_ino*           ino,
+                            uint32_t*                offset,
+                            bool*                    found)
+{
+  uint8_t* entry;
+  int      rc;
+
+  *found = false;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+    printf ("rtems-rfs: dir-lookup-ino: block read, ino=%" PRIu32 " bno=%" PRId32 "\n",
+            rtems_rfs_inode_ino (inode), map->bpos.bno);
+
+  rc = rtems_rfs_buffer_handle_request (fs, entries, block, true);
+  if (rc > 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+      printf ("rtems-rfs: dir-lookup-ino: block read, ino=%" PRIu32 " block=%" PRId32 ": %d: %s\n",
+              rtems_rfs_inode_ino (inode), block, rc, strerror (rc));
+    return rc;
+  }
+
+  /*
+   * Search the block to see if the name matches. A hash of 0xffff or 0x0
+   * means the entry is empty.
+   */
+
+  entry = rtems_rfs_buffer_data (entries);
+
+  map->bpos.boff = 0;
+
+  while (map->bpos.boff < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    uint32_t ehash;
+    int      elength;
+
+    ehash  = rtems_rfs_dir_entry_hash (entry);
+    elength = rtems_rfs_dir_entry_length (entry);
+    *ino = rtems_rfs_dir_entry_ino (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      break;
+
+    if (rtems_rfs_dir_entry_valid (fs, elength, *ino))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+        printf ("rtems-rfs: dir-lookup-ino: "
+                "bad length or ino for ino %" PRIu32 ": %u/%" PRId32 " @ %04" PRIx32 "\n",
+                rtems_rfs_inode_ino (inode), elength, *ino, map->bpos.boff);
+      return EIO;
+    }
+
+    if (ehash == hash)
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_CHECK))
+        printf ("rtems-rfs: dir-lookup-ino: "
+                "checking entry for ino %" PRId32 ": bno=%04" PRIx32 "/off=%04" PRIx32
+                " length:%d ino:%" PRId32 "\n",
+                rtems_rfs_inode_ino (inode), map->bpos.bno, map->bpos.boff,
+                elength, rtems_rfs_dir_entry_ino (entry));
+
+      if (memcmp (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length) == 0)
+      {
+        *offset = rtems_rfs_block_map_pos (fs, map);
+
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_FOUND))
+          printf ("rtems-rfs: dir-lookup-ino: "
+                  "entry found in ino %" PRIu32 ", ino=%" PRIu32 " offset=%" PRIu32 "\n",
+                  rtems_rfs_inode_ino (inode), *ino, *offset);
+
+        *found = true;
+        return 0;
+      }
+    }
+
+    map->bpos.boff += elength;
+    entry += elength;
+  }
+
+  return 0;
+}
+
 int
 rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
                           rtems_rfs_inode_handle* inode,
@@ -91,14 +187,63 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
   }
   else
   {
-    rtems_rfs_block_no block;
-    uint32_t           hash;
+    rtems_rfs_dir_index* index;
+    rtems_rfs_block_no   block;
+    uint32_t             hash;
+    bool                 found = false;
 
     /*
      * Calculate the hash of the look up string.
      */
     hash = rtems_rfs_dir_hash (name, length);
 
+    /*
+     * A large directory can have an index of the blocks holding each hash. If
+     * so only search these blocks.
+     */
+    rc = rtems_rfs_dir_index_get (fs, inode, &map, &index);
+    if (rc > 0)
+    {
+      rtems_rfs_buffer_handle_close (fs, &entries);
+      rtems_rfs_block_map_close (fs, &map);
+      return rc;
+    }
+
+    if (index)
+    {
+      rtems_rfs_block_no bno;
+      uint32_t           cursor = RTEMS_RFS_DIR_INDEX_END;
+
+      rc = ENOENT;
+
+      while (rtems_rfs_dir_index_next (index, hash, &cursor, &bno))
+      {
+        rc = rtems_rfs_block_map_seek (fs, &map,
+                                       (rtems_rfs_pos) bno *
+                                       rtems_rfs_fs_block_size (fs),
+                                       &block);
+        if (rc == 0)
+          rc = rtems_rfs_dir_search_block (fs, inode, &map, &entries, block,
+                                           hash, name, length, ino, offset,
+                                           &found);
+        if (rc > 0)
+        {
+          if (rc == ENXIO)
+            rc = EIO;
+          break;
+        }
+
+        if (found)
+          break;
+
+        rc = ENOENT;
+      }
+
+      rtems_rfs_buffer_handle_close (fs, &entries);
+      rtems_rfs_block_map_close (fs, &map);
+      return rc;
+    }
+
     /*
      * Locate the first block. The map points to the start after open so just
      * seek 0. If an error the block will be 0.
@@ -118,93 +263,29 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
 
     while ((rc == 0) && block)
     {
-      uint8_t* entry;
-
-      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
-        printf ("rtems-rfs: dir-lookup-ino: block read, ino=%" PRIu32 " bno=%" PRId32 "\n",
-                rtems_rfs_inode_ino (inode), map.bpos.bno);
-
-      rc = rtems_rfs_buffer_handle_request (fs, &entries, block, true);
+      rc = rtems_rfs_dir_search_block (fs, inode, &map, &entries, block,
+                                       hash, name, length, ino, offset,
+                                       &found);
       if (rc > 0)
-      {
-        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
-          printf ("rtems-rfs: dir-lookup-ino: block read, ino=%" PRIu32 " block=%" PRId32 ": %d: %s\n",
-                  rtems_rfs_inode_ino (inode), block, rc, strerror (rc));
         break;
-      }
 
-      /*
-       * Search the block to see if the name matches. A hash of 0xffff or 0x0
-       * means the entry is empty.
-       */
-
-      entry = rtems_rfs_buffer_data (&entries);
-
-      map.bpos.boff = 0;
-
-      while (map.bpos.boff < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+      if (found)
       {
-        uint32_t ehash;
-        int      elength;
-
-        ehash  = rtems_rfs_dir_entry_hash (entry);
-        elength = rtems_rfs_dir_entry_length (entry);
-        *ino = rtems_rfs_dir_entry_ino (entry);
-
-        if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
-          break;
-
-        if (rtems_rfs_dir_entry_valid (fs, elength, *ino))
-        {
-          if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
-            printf ("rtems-rfs: dir-lookup-ino: "
-                    "bad length or ino for ino %" PRIu32 ": %u/%" PRId32 " @ %04" PRIx32 "\n",
-                    rtems_rfs_inode_ino (inode), elength, *ino, map.bpos.boff);
-          rc = EIO;
-          break;
-        }
-
-        if (ehash == hash)
-        {
-          if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_CHECK))
-            printf ("rtems-rfs: dir-lookup-ino: "
-                    "checking entry for ino %" PRId32 ": bno=%04" PRIx32 "/off=%04" PRIx32
-                    " length:%d ino:%" PRId32 "\n",
-                    rtems_rfs_inode_ino (inode), map.bpos.bno, map.bpos.boff,
-                    elength, rtems_rfs_dir_entry_ino (entry));
-
-          if (memcmp (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length) == 0)
-          {
-            *offset = rtems_rfs_block_map_pos (fs, &map);
-
-            if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO_FOUND))
-              printf ("rtems-rfs: dir-lookup-ino: "
-                      "entry found in ino %" PRIu32 ", ino=%" PRIu32 " offset=%" PRIu32 "\n",
-                      rtems_rfs_inode_ino (inode), *ino, *offset);
-
-            rtems_rfs_buffer_handle_close (fs, &entries);
-            rtems_rfs_block_map_close (fs, &map);
-            return 0;
-          }
-        }
-
-        map.bpos.boff += elength;
-        entry += elength;
+        rtems_rfs_buffer_handle_close (fs, &entries);
+        rtems_rfs_block_map_close (fs, &map);
+        return 0;
       }
 
-      if (rc == 0)
+      rc = rtems_rfs_block_map_next_block (fs, &map, &block);
+      if ((rc > 0) && (rc != ENXIO))
       {
-        rc = rtems_rfs_block_map_next_block (fs, &map, &block);
-        if ((rc > 0) && (rc != ENXIO))
-        {
-          if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
-            printf ("rtems-rfs: dir-lookup-ino: "
-                    "block map next block failed in ino %" PRIu32 ": %d: %s\n",
-                    rtems_rfs_inode_ino (inode), rc, strerror (rc));
-        }
-        if (rc == ENXIO)
-          rc = ENOENT;
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+          printf ("rtems-rfs: dir-lookup-ino: "
+                  "block map next block failed in ino %" PRIu32 ": %d: %s\n",
+                  rtems_rfs_inode_ino (inode), rc, strerror (rc));
       }
+      if (rc == ENXIO)
+        rc = ENOENT;
     }
 
     if ((rc == 0) && (block == 0))
@@ -339,6 +420,8 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
                                           RTEMS_RFS_DIR_ENTRY_SIZE + length);
           memcpy (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length);
           rtems_rfs_buffer_mark_dirty (&buffer);
+          rtems_rfs_dir_index_add (fs, rtems_rfs_inode_ino (dir), hash,
+                                   bpos.bno - 1);
           rtems_rfs_buffer_handle_close (fs, &buffer);
           rtems_rfs_block_map_close (fs, &map);
           return 0;
@@ -460,6 +543,11 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
       if (ino == rtems_rfs_dir_entry_ino (entry))
       {
         uint32_t remaining;
+
+        rtems_rfs_dir_index_remove (fs, rtems_rfs_inode_ino (dir),
+                                    rtems_rfs_dir_entry_hash (entry),
+                                    map.bpos.bno);
+
         remaining = rtems_rfs_fs_block_size (fs) - (eoffset + elength);
         memmove (entry, entry + elength, remaining);
         memset (entry + remaining, 0xff, elength);
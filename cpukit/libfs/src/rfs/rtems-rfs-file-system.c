@@ -24,6 +24,7 @@
 #include <string.h>
 
 #include <rtems/rfs/rtems-rfs-data.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 #include <rtems/rfs/rtems-rfs-file-system.h>
 #include <rtems/rfs/rtems-rfs-inode.h>
 #include <rtems/rfs/rtems-rfs-trace.h>
@@ -112,6 +113,9 @@ rtems_rfs_fs_read_superblock (rtems_rfs_file_system* fs)
     return EIO;
   }
 
+  if ((read_sb (RTEMS_RFS_SB_OFFSET_VERSION) & RTEMS_RFS_FEATURE_DIR_INDEX) != 0)
+    fs->flags |= RTEMS_RFS_FS_DIR_INDEX;
+
   fs->bad_blocks      = read_sb (RTEMS_RFS_SB_OFFSET_BAD_BLOCKS);
   fs->max_name_length = read_sb (RTEMS_RFS_SB_OFFSET_MAX_NAME_LENGTH);
   fs->group_count     = read_sb (RTEMS_RFS_SB_OFFSET_GROUPS);
@@ -226,11 +230,14 @@ rtems_rfs_fs_open (const char*             name,
   rtems_chain_initialize_empty (&(*fs)->release);
   rtems_chain_initialize_empty (&(*fs)->release_modified);
   rtems_chain_initialize_empty (&(*fs)->file_shares);
+  rtems_chain_initialize_empty (&(*fs)->dir_indexes);
 
   (*fs)->max_held_buffers = max_held_buffers;
+  (*fs)->reserve_blocks = RTEMS_RFS_FS_RESERVE_BLOCKS;
   (*fs)->buffers_count = 0;
   (*fs)->release_count = 0;
   (*fs)->release_modified_count = 0;
+  (*fs)->dir_index_count = 0;
   (*fs)->flags = flags;
 
 #if UNUSED
@@ -314,6 +321,8 @@ rtems_rfs_fs_close (rtems_rfs_file_system* fs)
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_CLOSE))
     printf ("rtems-rfs: close\n");
 
+  rtems_rfs_dir_index_close (fs);
+
   for (group = 0; group < fs->group_count; group++)
     rtems_rfs_group_close (fs, &fs->groups[group]);
 
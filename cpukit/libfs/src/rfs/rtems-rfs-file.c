@@ -117,6 +117,8 @@ rtems_rfs_file_open (rtems_rfs_file_system*  fs,
       return rc;
     }
 
+    rtems_rfs_block_map_set_reserve_window (&shared->map, fs->reserve_blocks);
+
     shared->references = 1;
     shared->size.count = rtems_rfs_inode_get_block_count (&shared->inode);
     shared->size.offset = rtems_rfs_inode_get_block_offset (&shared->inode);
@@ -258,6 +260,18 @@ rtems_rfs_file_io_start (rtems_rfs_file_handle* handle,
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_FILE_IO))
         printf ("rtems-rfs: file-io: start: grow\n");
 
+      /*
+       * Reserve the blocks the rest of the write needs so they are
+       * contiguous.
+       */
+      size = rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle));
+      rc = rtems_rfs_block_map_reserve (rtems_rfs_file_fs (handle),
+                                        rtems_rfs_file_map (handle),
+                                        (handle->bpos.boff + *available +
+                                         size - 1) / size);
+      if (rc > 0)
+        return rc;
+
       rc = rtems_rfs_block_map_grow (rtems_rfs_file_fs (handle),
                                      rtems_rfs_file_map (handle),
                                      1, &block);
@@ -511,6 +525,15 @@ rtems_rfs_file_set_size (rtems_rfs_file_handle* handle,
         length = rtems_rfs_fs_block_size (rtems_rfs_file_fs (handle));
         read_block = false;
 
+        /*
+         * Reserve the blocks the new size needs so they are contiguous.
+         */
+        rc = rtems_rfs_block_map_reserve (rtems_rfs_file_fs (handle), map,
+                                          ((new_size + length - 1) / length) -
+                                          rtems_rfs_block_map_count (map));
+        if (rc > 0)
+          return rc;
+
         while (count)
         {
           rtems_rfs_buffer_block block;
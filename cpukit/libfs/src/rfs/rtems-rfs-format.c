@@ -422,7 +422,9 @@ rtems_rfs_write_superblock (rtems_rfs_file_system* fs)
   memset (sb, 0xff, rtems_rfs_fs_block_size (fs));
 
   write_sb (RTEMS_RFS_SB_OFFSET_MAGIC, RTEMS_RFS_SB_MAGIC);
-  write_sb (RTEMS_RFS_SB_OFFSET_VERSION, RTEMS_RFS_VERSION);
+  write_sb (RTEMS_RFS_SB_OFFSET_VERSION,
+            RTEMS_RFS_VERSION |
+            (rtems_rfs_fs_dir_index (fs) ? RTEMS_RFS_FEATURE_DIR_INDEX : 0));
   write_sb (RTEMS_RFS_SB_OFFSET_BLOCKS, rtems_rfs_fs_blocks (fs));
   write_sb (RTEMS_RFS_SB_OFFSET_BLOCK_SIZE, rtems_rfs_fs_block_size (fs));
   write_sb (RTEMS_RFS_SB_OFFSET_BAD_BLOCKS, fs->bad_blocks);
@@ -552,6 +554,7 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
   rtems_chain_initialize_empty (&fs.release);
   rtems_chain_initialize_empty (&fs.release_modified);
   rtems_chain_initialize_empty (&fs.file_shares);
+  rtems_chain_initialize_empty (&fs.dir_indexes);
 
   fs.max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
 
@@ -560,6 +563,9 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
 
   fs.flags = RTEMS_RFS_FS_NO_LOCAL_CACHE;
 
+  if (config->dir_index)
+    fs.flags |= RTEMS_RFS_FS_DIR_INDEX;
+
   /*
    * Open the buffer interface.
    */
@@ -618,6 +624,8 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
     printf ("rtems-rfs: format: groups = %u\n", fs.group_count);
     printf ("rtems-rfs: format: group blocks = %zu\n", fs.group_blocks);
     printf ("rtems-rfs: format: group inodes = %zu\n", fs.group_inodes);
+    printf ("rtems-rfs: format: directory index = %s\n",
+            config->dir_index ? "yes" : "no");
   }
 
   rc = rtems_rfs_buffer_setblksize (&fs, rtems_rfs_fs_block_size (&fs));
@@ -269,6 +269,57 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
   return ENOSPC;
 }
 
+int
+rtems_rfs_group_bitmap_alloc_blocks (rtems_rfs_file_system* fs,
+                                     rtems_rfs_bitmap_bit   goal,
+                                     size_t                 count,
+                                     rtems_rfs_bitmap_bit*  result,
+                                     size_t*                allocated)
+{
+  rtems_rfs_bitmap_control* bitmap;
+  unsigned int              group;
+  rtems_rfs_bitmap_bit      bit;
+  size_t                    extended;
+  int                       rc;
+
+  *allocated = 0;
+
+  rc = rtems_rfs_group_bitmap_alloc (fs, goal, false, result);
+  if (rc > 0)
+    return rc;
+
+  *allocated = 1;
+
+  if (count <= 1)
+    return 0;
+
+  group = (*result - RTEMS_RFS_SUPERBLOCK_SIZE) / fs->group_blocks;
+  bit = (rtems_rfs_bitmap_bit) (*result - fs->groups[group].base);
+  bitmap = &fs->groups[group].block_bitmap;
+
+  rc = rtems_rfs_bitmap_map_extend (bitmap, bit, count - 1, &extended);
+
+  if (rtems_rfs_fs_release_bitmaps (fs))
+    rtems_rfs_bitmap_release_buffer (fs, bitmap);
+
+  if (rc > 0)
+  {
+    size_t b;
+    for (b = 0; b <= extended; b++)
+      rtems_rfs_group_bitmap_free (fs, false, *result + b);
+    *allocated = 0;
+    return rc;
+  }
+
+  *allocated += extended;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_GROUP_BITMAPS))
+    printf ("rtems-rfs: group-bitmap-alloc-blocks: allocated: %" PRId32
+            " count=%zu\n", *result, *allocated);
+
+  return 0;
+}
+
 int
 rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
                              bool                   inode,
@@ -30,6 +30,7 @@
 #include <rtems/rfs/rtems-rfs-trace.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
 #include <rtems/rfs/rtems-rfs-dir-hash.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 #include <rtems/rfs/rtems-rfs-link.h>
 
 int
@@ -206,6 +207,8 @@ rtems_rfs_unlink (rtems_rfs_file_system* fs,
 
     if (dir)
     {
+      rtems_rfs_dir_index_release (fs, target);
+
       links = rtems_rfs_inode_get_links (&parent_inode);
       if (links > 1)
         links--;
@@ -754,6 +754,7 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
   rtems_rfs_file_system*   fs;
   uint32_t                 flags = 0;
   uint32_t                 max_held_buffers = RTEMS_RFS_FS_MAX_HELD_BUFFERS;
+  uint32_t                 reserve_blocks = RTEMS_RFS_FS_RESERVE_BLOCKS;
   const char*              options = data;
   int                      rc;
 
@@ -769,11 +770,19 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     else if (strncmp (options, "no-local-cache",
                       sizeof ("no-local-cache") - 1) == 0)
       flags |= RTEMS_RFS_FS_NO_LOCAL_CACHE;
+    else if (strncmp (options, "dir-index",
+                      sizeof ("dir-index") - 1) == 0)
+      flags |= RTEMS_RFS_FS_DIR_INDEX;
     else if (strncmp (options, "max-held-bufs",
                       sizeof ("max-held-bufs") - 1) == 0)
     {
       max_held_buffers = strtoul (options + sizeof ("max-held-bufs"), 0, 0);
     }
+    else if (strncmp (options, "reserve-blocks",
+                      sizeof ("reserve-blocks") - 1) == 0)
+    {
+      reserve_blocks = strtoul (options + sizeof ("reserve-blocks"), 0, 0);
+    }
     else
       return rtems_rfs_rtems_error ("initialise: invalid option", EINVAL);
 
@@ -816,6 +825,8 @@ rtems_rfs_rtems_initialise (rtems_filesystem_mount_table_entry_t* mt_entry,
     return rtems_rfs_rtems_error ("initialise: open", errno);
   }
 
+  fs->reserve_blocks = reserve_blocks;
+
   mt_entry->fs_info                          = fs;
   mt_entry->ops                              = &rtems_rfs_ops;
   mt_entry->mt_fs_root->location.node_access = (void*) RTEMS_RFS_ROOT_INO;
@@ -144,6 +144,7 @@ rtems_rfs_shell_data (rtems_rfs_file_system* fs, int argc, char *argv[])
   printf ("     singly blocks: %zd\n",           fs->block_map_singly_blocks);
   printf ("    doublly blocks: %zd\n",           fs->block_map_doubly_blocks);
   printf (" max. held buffers: %" PRId32 "\n",   fs->max_held_buffers);
+  printf ("    reserve blocks: %" PRId32 "\n",   fs->reserve_blocks);
 
   rtems_rfs_shell_lock_rfs (fs);
 
@@ -713,6 +714,10 @@ rtems_shell_rfs_format (int argc, char* argv[])
           config.initialise_inodes = true;
           break;
 
+        case 'x':
+          config.dir_index = true;
+          break;
+
         case 'o':
           arg++;
           if (arg >= argc)
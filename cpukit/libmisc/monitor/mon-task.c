@@ -8,6 +8,7 @@
 
 #include <rtems.h>
 #include <rtems/monitor.h>
+#include <rtems/rtems/eventimpl.h>
 #include <rtems/rtems/tasksdata.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/threadqimpl.h>
@@ -112,7 +113,7 @@ rtems_monitor_task_canonical(
     canonical_task->stack = rtems_thread->Start.Initial_stack.area;
     canonical_task->stack_size = rtems_thread->Start.Initial_stack.size;
     canonical_task->priority = _Thread_Get_unmapped_priority( rtems_thread );
-    canonical_task->events = api->Event.pending_events;
+    canonical_task->events = _Event_Get_pending( &api->Event );
     /*
      * FIXME: make this optionally cpu_time_executed
      */
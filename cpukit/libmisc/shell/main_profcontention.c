@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+
+#include <rtems/profiling.h>
+#include <rtems/printer.h>
+#include <rtems/shell.h>
+#include <rtems/shellconfig.h>
+#include <rtems/stringto.h>
+
+static int usage(void)
+{
+  puts(rtems_shell_PROFCONTENTION_Command.usage);
+
+  return -1;
+}
+
+static int rtems_shell_main_profcontention(int argc, char **argv)
+{
+  rtems_printer printer;
+  unsigned long max_count;
+
+  if (argc == 1) {
+    max_count = 0;
+  } else if (argc == 2) {
+    rtems_status_code sc;
+
+    sc = rtems_string_to_unsigned_long(argv[1], &max_count, NULL, 10);
+    if (sc != RTEMS_SUCCESSFUL) {
+      return usage();
+    }
+  } else {
+    return usage();
+  }
+
+  rtems_print_printer_printf(&printer);
+  rtems_profiling_report_contention_xml(
+    "Shell",
+    &printer,
+    0,
+    "  ",
+    max_count
+  );
+
+  return 0;
+}
+
+rtems_shell_cmd_t rtems_shell_PROFCONTENTION_Command = {
+  .name = "profcontention",
+  .usage = "profcontention [MAX-COUNT]",
+  .topic = "rtems",
+  .command = rtems_shell_main_profcontention
+};
@@ -35,6 +35,46 @@
  */
 CHAIN_DEFINE_EMPTY( mmap_mappings );
 
+/*
+ * A direct mapping holds a file descriptor of its own.  This keeps the file
+ * alive after a close() of the file descriptor used to map it and after an
+ * unlink() of the file.  The file system may pin the mapped file data
+ * through this file descriptor until it is closed by munmap().
+ */
+static int mmap_direct(
+  mmap_mapping  *mapping,
+  rtems_libio_t *iop,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  rtems_libio_t *map_iop;
+  int            err;
+
+  map_iop = rtems_libio_allocate();
+  if ( map_iop == NULL ) {
+    errno = ENFILE;
+    return -1;
+  }
+
+  rtems_filesystem_instance_lock( &iop->pathinfo );
+  rtems_filesystem_location_clone( &map_iop->pathinfo, &iop->pathinfo );
+  rtems_filesystem_instance_unlock( &iop->pathinfo );
+
+  rtems_libio_iop_flags_set( map_iop, LIBIO_FLAGS_READ );
+
+  err = (*map_iop->pathinfo.handlers->mmap_h)(
+      map_iop, &mapping->addr, len, prot, off );
+  if ( err != 0 ) {
+    rtems_libio_free( map_iop );
+    return err;
+  }
+
+  mapping->iop = map_iop;
+  return 0;
+}
+
 void *mmap(
   void *addr, size_t len, int prot, int flags, int fildes, off_t off
 )
@@ -48,6 +88,7 @@ void *mmap(
   bool            map_anonymous;
   bool            map_shared;
   bool            map_private;
+  bool            map_direct;
   bool            is_shared_shm;
   int             err;
 
@@ -77,9 +118,10 @@ void *mmap(
   /*
    * We can not normally provide restriction of write access. Reject any
    * attempt to map without write permission, since we are not able to
-   * prevent a write from succeeding.
+   * prevent a write from succeeding.  Read-only mappings of regular files are
+   * the exception, see below.
    */
-  if ( PROT_WRITE != (prot & PROT_WRITE) ) {
+  if ( PROT_WRITE != (prot & PROT_WRITE) && map_anonymous ) {
     errno = ENOTSUP;
     return MAP_FAILED;
   }
@@ -157,11 +199,18 @@ void *mmap(
       return MAP_FAILED;
     }
 
+    /*
+     * Read-only mappings are only supported for regular files.  The
+     * application is responsible to not write to these mappings.
+     */
+    if ( PROT_WRITE != (prot & PROT_WRITE) && !S_ISREG( sb.st_mode ) ) {
+      errno = ENOTSUP;
+      return MAP_FAILED;
+    }
+
     /* Check to see if the mapping is valid for a regular file. */
     if ( S_ISREG( sb.st_mode )
-    /* FIXME: Should this be using strict inequality (>) comparisons? It would
-     * be valid to map a region exactly equal to the st_size, e.g. see below. */
-         && (( off >= sb.st_size ) || (( off + len ) >= sb.st_size ))) {
+         && (( off >= sb.st_size ) || (( off + len ) > sb.st_size ))) {
       errno = EOVERFLOW;
       return MAP_FAILED;
     }
@@ -196,6 +245,16 @@ void *mmap(
   mapping->len = len;
   mapping->flags = flags;
 
+  /*
+   * Read-only mappings of regular files may refer directly to the file data,
+   * if the file system provides this through the mmap handler, see
+   * mmap_direct().  Private mappings fall back to a copy of the data
+   * otherwise.  It is unspecified by POSIX if later modifications of the file
+   * are visible through a private mapping.
+   */
+  map_direct = !map_anonymous && !map_fixed && S_ISREG( sb.st_mode )
+    && PROT_WRITE != (prot & PROT_WRITE);
+
   if ( !map_anonymous ) {
     /*
      * HACK: We should have a better generic way to distinguish between
@@ -216,7 +275,7 @@ void *mmap(
 
   if ( map_fixed ) {
     mapping->addr = addr;
-  } else if ( map_private ) {
+  } else if ( map_private && !map_direct ) {
     /* private mappings of shared memory do not need special treatment. */
     is_shared_shm = false;
     err = posix_memalign( &mapping->addr, PAGE_SIZE, len );
@@ -257,13 +316,35 @@ void *mmap(
     }
   }
 
+  if ( map_direct ) {
+    err = mmap_direct( mapping, iop, len, prot, off );
+    if ( err != 0 && map_shared ) {
+      mmap_mappings_lock_release( );
+      free( mapping );
+      return MAP_FAILED;
+    } else if ( err != 0 ) {
+      map_direct = false;
+      errno = 0;
+      err = posix_memalign( &mapping->addr, PAGE_SIZE, len );
+      if ( err != 0 ) {
+        mmap_mappings_lock_release( );
+        free( mapping );
+        errno = ENOMEM;
+        return MAP_FAILED;
+      }
+    }
+  }
+
   /* Populate the data */
-  if ( map_private ) {
+  if ( map_direct ) {
+    /* Nothing to do */
+  } else if ( map_private ) {
     if ( !map_anonymous ) {
       /*
        * Use read() for private mappings. This updates atime as needed.
        * Changes to the underlying object will NOT be reflected in the mapping.
-       * The underlying object can be removed while the mapping exists.
+       * The underlying object can be removed while the mapping exists.  This
+       * is also true for direct mappings, see mmap_direct().
        */
       r = read( fildes, mapping->addr, len );
 
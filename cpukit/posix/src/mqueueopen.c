@@ -102,7 +102,8 @@ static mqd_t _POSIX_Message_queue_Create(
       &the_mq->Message_queue,
       CORE_MESSAGE_QUEUE_DISCIPLINES_FIFO,
       attr->mq_maxmsg,
-      attr->mq_msgsize
+      attr->mq_msgsize,
+      true
     )
   ) {
     _POSIX_Message_queue_Free( the_mq );
@@ -58,8 +58,18 @@ int munmap(void *addr, size_t len)
         POSIX_Shm_Attempt_delete(mapping->shm);
       }
 
+      /*
+       * Direct mappings refer to memory managed by the file system.  Close
+       * the file descriptor of the mapping, so that the file system may
+       * release the file data.
+       */
+      if ( mapping->iop != NULL ) {
+        (void) (*mapping->iop->pathinfo.handlers->close_h)( mapping->iop );
+        rtems_libio_free( mapping->iop );
+      }
+
       /* only free the mapping address for non-fixed mapping */
-      if (( mapping->flags & MAP_FIXED ) != MAP_FIXED ) {
+      if (( mapping->flags & MAP_FIXED ) != MAP_FIXED && mapping->iop == NULL ) {
         /* only free the mapping address for non-shared mapping, because we
          * re-use the mapping address across all of the shared mappings, and
          * it is memory managed independently... */
@@ -40,7 +40,7 @@ int timer_create(
 {
   POSIX_Timer_Control *ptimer;
 
-  if ( clock_id != CLOCK_REALTIME )
+  if ( clock_id != CLOCK_REALTIME && clock_id != CLOCK_MONOTONIC )
     rtems_set_errno_and_return_minus_one( EINVAL );
 
   if ( !timerid )
@@ -79,6 +79,7 @@ int timer_create(
 
   ptimer->state     = POSIX_TIMER_STATE_CREATE_NEW;
   ptimer->thread_id = _Thread_Get_executing()->Object.id;
+  ptimer->clock_id  = clock_id;
 
   if ( evp != NULL ) {
     ptimer->inf.sigev_notify = evp->sigev_notify;
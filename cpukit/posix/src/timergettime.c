@@ -25,6 +25,7 @@
 #include <errno.h>
 
 #include <rtems/posix/timerimpl.h>
+#include <rtems/score/timecounter.h>
 #include <rtems/score/todimpl.h>
 #include <rtems/score/watchdogimpl.h>
 #include <rtems/seterr.h>
@@ -54,15 +55,41 @@ int timer_gettime(
     Per_CPU_Control *cpu;
 
     cpu = _POSIX_Timer_Acquire_critical( ptimer, &lock_context );
-    now = cpu->Watchdog.ticks;
 
-    if ( now < ptimer->Timer.expire ) {
-      remaining = (uint32_t) ( ptimer->Timer.expire - now );
+    if ( ptimer->clock_id == CLOCK_MONOTONIC ) {
+      struct timespec uptime;
+      uint64_t        expire;
+
+      _Timecounter_Nanouptime( &uptime );
+      now = _Watchdog_Nanoseconds_from_ticks(
+        _Watchdog_Ticks_from_timespec( &uptime )
+      );
+      expire = _Watchdog_Nanoseconds_from_ticks( ptimer->Timer.expire );
+
+      if ( now < expire ) {
+        uint64_t delta;
+
+        delta = expire - now;
+        _Timespec_Set(
+          &value->it_value,
+          (time_t) ( delta / WATCHDOG_NANOSECONDS_PER_SECOND ),
+          (long) ( delta % WATCHDOG_NANOSECONDS_PER_SECOND )
+        );
+      } else {
+        _Timespec_Set_to_zero( &value->it_value );
+      }
     } else {
-      remaining = 0;
+      now = cpu->Watchdog.ticks;
+
+      if ( now < ptimer->Timer.expire ) {
+        remaining = (uint32_t) ( ptimer->Timer.expire - now );
+      } else {
+        remaining = 0;
+      }
+
+      _Timespec_From_ticks( remaining, &value->it_value );
     }
 
-    _Timespec_From_ticks( remaining, &value->it_value );
     value->it_interval = ptimer->timer_data.it_interval;
 
     _POSIX_Timer_Release( cpu, &lock_context );
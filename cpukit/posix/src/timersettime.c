@@ -25,6 +25,7 @@
 #include <errno.h>
 
 #include <rtems/posix/timerimpl.h>
+#include <rtems/score/timecounter.h>
 #include <rtems/score/todimpl.h>
 #include <rtems/score/watchdogimpl.h>
 #include <rtems/seterr.h>
@@ -48,6 +49,55 @@ static void _POSIX_Timer_Insert(
   );
 }
 
+static uint64_t _POSIX_Timer_Monotonic_expire( const struct timespec *ts )
+{
+  if ( _Watchdog_Is_far_future_timespec( ts ) ) {
+    return WATCHDOG_MAXIMUM_TICKS;
+  }
+
+  return _Watchdog_Ticks_from_timespec( ts );
+}
+
+static void _POSIX_Timer_Insert_monotonic(
+  POSIX_Timer_Control *ptimer,
+  Per_CPU_Control     *cpu,
+  uint64_t             expire
+)
+{
+  Watchdog_Header *header;
+
+  ptimer->state = POSIX_TIMER_STATE_CREATE_RUN;
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  _Watchdog_Insert( header, &ptimer->Timer, expire );
+  _Watchdog_High_resolution_inserted( cpu, header, &ptimer->Timer );
+}
+
+static void _POSIX_Timer_Reinsert_monotonic(
+  POSIX_Timer_Control *ptimer,
+  Per_CPU_Control     *cpu
+)
+{
+  uint64_t        expire;
+  struct timespec next;
+
+  /*
+   * The next expiration time is relative to the previous one and not to the
+   * current time, so that periodic timers do not drift.
+   */
+  expire = ptimer->Timer.expire;
+  next.tv_sec = (time_t) ( expire >> WATCHDOG_BITS_FOR_1E9_NANOSECONDS );
+  next.tv_nsec = (long) ( expire
+    & ( ( UINT64_C( 1 ) << WATCHDOG_BITS_FOR_1E9_NANOSECONDS ) - 1 ) );
+  _Watchdog_Future_timespec( &next, &ptimer->timer_data.it_interval );
+
+  _POSIX_Timer_Insert_monotonic(
+    ptimer,
+    cpu,
+    _POSIX_Timer_Monotonic_expire( &next )
+  );
+}
+
 /*
  *  This is the operation that is run when a timer expires
  */
@@ -67,7 +117,11 @@ void _POSIX_Timer_TSR( Watchdog_Control *the_watchdog )
   /* The timer must be reprogrammed */
   if ( ( ptimer->timer_data.it_interval.tv_sec  != 0 ) ||
        ( ptimer->timer_data.it_interval.tv_nsec != 0 ) ) {
-    _POSIX_Timer_Insert( ptimer, cpu, ptimer->ticks );
+    if ( ptimer->clock_id == CLOCK_MONOTONIC ) {
+      _POSIX_Timer_Reinsert_monotonic( ptimer, cpu );
+    } else {
+      _POSIX_Timer_Insert( ptimer, cpu, ptimer->ticks );
+    }
   } else {
    /* Indicates that the timer is stopped */
    ptimer->state = POSIX_TIMER_STATE_CREATE_STOP;
@@ -97,6 +151,110 @@ void _POSIX_Timer_TSR( Watchdog_Control *the_watchdog )
   ptimer->overrun = 0;
 }
 
+static int _POSIX_Timer_Set_monotonic(
+  POSIX_Timer_Control     *ptimer,
+  Per_CPU_Control         *cpu,
+  int                      flags,
+  const struct itimerspec *value,
+  struct itimerspec       *ovalue
+)
+{
+  struct timespec expire;
+
+  /* Stop the timer */
+  _Watchdog_Remove(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ],
+    &ptimer->Timer
+  );
+
+  /* The old data of the timer are returned */
+  if ( ovalue )
+    *ovalue = ptimer->timer_data;
+
+  ptimer->timer_data = *value;
+
+  if ( value->it_value.tv_sec == 0 && value->it_value.tv_nsec == 0 ) {
+    /* Indicates that the timer is created and stopped */
+    ptimer->state = POSIX_TIMER_STATE_CREATE_STOP;
+    return 0;
+  }
+
+  /*
+   * An absolute time in the past expires immediately.  The precise uptime is
+   * used for relative times, since the timer may expire between clock ticks.
+   */
+  if ( flags == TIMER_ABSTIME ) {
+    expire = value->it_value;
+  } else {
+    _Timecounter_Nanouptime( &expire );
+    _Watchdog_Future_timespec( &expire, &value->it_value );
+  }
+
+  _POSIX_Timer_Insert_monotonic(
+    ptimer,
+    cpu,
+    _POSIX_Timer_Monotonic_expire( &expire )
+  );
+  return 0;
+}
+
+static int _POSIX_Timer_Set_realtime(
+  POSIX_Timer_Control     *ptimer,
+  Per_CPU_Control         *cpu,
+  int                      flags,
+  const struct itimerspec *value,
+  struct itimerspec       *ovalue
+)
+{
+  uint32_t          initial_period;
+  struct itimerspec normalize;
+
+  normalize = *value;
+
+  /* Convert absolute to relative time */
+  if (flags == TIMER_ABSTIME) {
+    struct timespec now;
+    _TOD_Get( &now );
+    /* Check for seconds in the past */
+    if ( _Timespec_Greater_than( &now, &normalize.it_value ) )
+      return EINVAL;
+    _Timespec_Subtract( &now, &normalize.it_value, &normalize.it_value );
+  }
+
+  /* Stop the timer */
+  _Watchdog_Remove(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+    &ptimer->Timer
+  );
+
+  /* First, it verifies if the timer must be stopped */
+  if ( normalize.it_value.tv_sec == 0 && normalize.it_value.tv_nsec == 0 ) {
+    /* The old data of the timer are returned */
+    if ( ovalue )
+      *ovalue = ptimer->timer_data;
+    /* The new data are set */
+    ptimer->timer_data = normalize;
+    /* Indicates that the timer is created and stopped */
+    ptimer->state = POSIX_TIMER_STATE_CREATE_STOP;
+    return 0;
+  }
+
+  /* Convert from seconds and nanoseconds to ticks */
+  ptimer->ticks  = _Timespec_To_ticks( &value->it_interval );
+  initial_period = _Timespec_To_ticks( &normalize.it_value );
+
+  _POSIX_Timer_Insert( ptimer, cpu, initial_period );
+
+  /*
+   * The timer has been started and is running.  So we return the
+   * old ones in "ovalue"
+   */
+  if ( ovalue )
+    *ovalue = ptimer->timer_data;
+  ptimer->timer_data = normalize;
+  return 0;
+}
+
 int timer_settime(
   timer_t                  timerid,
   int                      flags,
@@ -106,8 +264,6 @@ int timer_settime(
 {
   POSIX_Timer_Control *ptimer;
   ISR_lock_Context     lock_context;
-  uint32_t             initial_period;
-  struct itimerspec    normalize;
 
   if ( !value )
     rtems_set_errno_and_return_minus_one( EINVAL );
@@ -127,18 +283,6 @@ int timer_settime(
     rtems_set_errno_and_return_minus_one( EINVAL );
   }
 
-  normalize = *value;
-
-  /* Convert absolute to relative time */
-  if (flags == TIMER_ABSTIME) {
-    struct timespec now;
-    _TOD_Get( &now );
-    /* Check for seconds in the past */
-    if ( _Timespec_Greater_than( &now, &normalize.it_value ) )
-      rtems_set_errno_and_return_minus_one( EINVAL );
-    _Timespec_Subtract( &now, &normalize.it_value, &normalize.it_value );
-  }
-
   /* If the function reaches this point, then it will be necessary to do
    * something with the structure of times of the timer: to stop, start
    * or start it again
@@ -147,43 +291,22 @@ int timer_settime(
   ptimer = _POSIX_Timer_Get( timerid, &lock_context );
   if ( ptimer != NULL ) {
     Per_CPU_Control *cpu;
+    int              eno;
 
     cpu = _POSIX_Timer_Acquire_critical( ptimer, &lock_context );
 
-    /* Stop the timer */
-    _Watchdog_Remove(
-      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
-      &ptimer->Timer
-    );
-
-    /* First, it verifies if the timer must be stopped */
-    if ( normalize.it_value.tv_sec == 0 && normalize.it_value.tv_nsec == 0 ) {
-      /* The old data of the timer are returned */
-      if ( ovalue )
-        *ovalue = ptimer->timer_data;
-      /* The new data are set */
-      ptimer->timer_data = normalize;
-      /* Indicates that the timer is created and stopped */
-      ptimer->state = POSIX_TIMER_STATE_CREATE_STOP;
-      /* Returns with success */
-      _POSIX_Timer_Release( cpu, &lock_context );
-      return 0;
+    if ( ptimer->clock_id == CLOCK_MONOTONIC ) {
+      eno = _POSIX_Timer_Set_monotonic( ptimer, cpu, flags, value, ovalue );
+    } else {
+      eno = _POSIX_Timer_Set_realtime( ptimer, cpu, flags, value, ovalue );
     }
 
-    /* Convert from seconds and nanoseconds to ticks */
-    ptimer->ticks  = _Timespec_To_ticks( &value->it_interval );
-    initial_period = _Timespec_To_ticks( &normalize.it_value );
+    _POSIX_Timer_Release( cpu, &lock_context );
 
-    _POSIX_Timer_Insert( ptimer, cpu, initial_period );
+    if ( eno != 0 ) {
+      rtems_set_errno_and_return_minus_one( eno );
+    }
 
-    /*
-     * The timer has been started and is running.  So we return the
-     * old ones in "ovalue"
-     */
-    if ( ovalue )
-      *ovalue = ptimer->timer_data;
-    ptimer->timer_data = normalize;
-    _POSIX_Timer_Release( cpu, &lock_context );
     return 0;
   }
 
@@ -56,7 +56,7 @@ rtems_status_code rtems_event_receive(
         &lock_context
       );
     } else {
-      *event_out = event->pending_events;
+      *event_out = _Event_Get_pending( event );
       _Thread_Wait_release_default( executing, &lock_context );
       sc = RTEMS_SUCCESSFUL;
     }
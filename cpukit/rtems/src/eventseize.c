@@ -26,6 +26,29 @@
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/watchdogimpl.h>
 
+static bool _Event_Try_seize(
+  Event_Control   *event,
+  rtems_event_set  event_in,
+  rtems_option     option_set,
+  rtems_event_set *seized_events
+)
+{
+  rtems_event_set pending_events;
+  rtems_event_set seized;
+
+  pending_events = _Event_Get_pending( event );
+  seized = _Event_sets_Get( pending_events, event_in );
+  *seized_events = seized;
+
+  if ( !_Event_sets_Is_empty( seized ) &&
+       (seized == event_in || _Options_Is_any( option_set )) ) {
+    _Event_Clear_pending( event, seized );
+    return true;
+  }
+
+  return false;
+}
+
 rtems_status_code _Event_Seize(
   rtems_event_set    event_in,
   rtems_option       option_set,
@@ -39,18 +62,11 @@ rtems_status_code _Event_Seize(
 )
 {
   rtems_event_set    seized_events;
-  rtems_event_set    pending_events;
   bool               success;
   Thread_Wait_flags  intend_to_block;
   Per_CPU_Control   *cpu_self;
 
-  pending_events = event->pending_events;
-  seized_events  = _Event_sets_Get( pending_events, event_in );
-
-  if ( !_Event_sets_Is_empty( seized_events ) &&
-       (seized_events == event_in || _Options_Is_any( option_set )) ) {
-    event->pending_events =
-      _Event_sets_Clear( pending_events, seized_events );
+  if ( _Event_Try_seize( event, event_in, option_set, &seized_events ) ) {
     _Thread_Wait_release_default( executing, lock_context );
     *event_out = seized_events;
     return RTEMS_SUCCESSFUL;
@@ -78,6 +94,23 @@ rtems_status_code _Event_Seize(
   executing->Wait.return_argument = event_out;
   _Thread_Wait_flags_set( executing, intend_to_block );
 
+#if defined(RTEMS_SMP)
+  /*
+   * Events may be posted without the thread wait lock, see _Event_Surrender().
+   * The full fence pairs with the one in _Event_Surrender().  Check the
+   * pending events again, since they may have been posted after the first
+   * check by a sender which did not observe the intend to block state.
+   */
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( _Event_Try_seize( event, event_in, option_set, &seized_events ) ) {
+    _Thread_Wait_flags_set( executing, THREAD_WAIT_FLAGS_INITIAL );
+    _Thread_Wait_release_default( executing, lock_context );
+    *event_out = seized_events;
+    return RTEMS_SUCCESSFUL;
+  }
+#endif
+
   cpu_self = _Thread_Dispatch_disable_critical( lock_context );
   _Thread_Wait_release_default( executing, lock_context );
 
@@ -26,11 +26,10 @@
 static void _Event_Satisfy(
   Thread_Control  *the_thread,
   Event_Control   *event,
-  rtems_event_set  pending_events,
   rtems_event_set  seized_events
 )
 {
-  event->pending_events = _Event_sets_Clear( pending_events, seized_events );
+  _Event_Clear_pending( event, seized_events );
   *(rtems_event_set *) the_thread->Wait.return_argument = seized_events;
 }
 
@@ -77,10 +76,30 @@ rtems_status_code _Event_Surrender(
   rtems_event_set seized_events;
   bool            unblock;
 
+#if defined(RTEMS_SMP)
+  /*
+   * Post the events without the thread wait lock.  This avoids a lock
+   * acquire and the related cache line transfers in the common case that the
+   * thread does not wait for events, e.g. if an interrupt service routine
+   * signals a busy worker thread on another processor.  The full fence pairs
+   * with the one in _Event_Seize().  Either we observe that the thread
+   * intends to block or the thread observes the posted events.
+   */
+  _Event_Post_pending( event, event_in );
+  _Atomic_Fence( ATOMIC_ORDER_SEQ_CST );
+
+  if ( !_Event_Is_blocking_on_event( the_thread, wait_class ) ) {
+    _ISR_lock_ISR_enable( lock_context );
+    return RTEMS_SUCCESSFUL;
+  }
+
   _Thread_Wait_acquire_default_critical( the_thread, lock_context );
+#else
+  _Thread_Wait_acquire_default_critical( the_thread, lock_context );
+  _Event_Post_pending( event, event_in );
+#endif
 
-  _Event_sets_Post( event_in, &event->pending_events );
-  pending_events = event->pending_events;
+  pending_events = _Event_Get_pending( event );
 
   if (
     _Event_Is_blocking_on_event( the_thread, wait_class )
@@ -89,7 +108,7 @@ rtems_status_code _Event_Surrender(
     Thread_Wait_flags ready_again;
     bool              success;
 
-    _Event_Satisfy( the_thread, event, pending_events, seized_events );
+    _Event_Satisfy( the_thread, event, seized_events );
 
     ready_again = wait_class | THREAD_WAIT_STATE_READY_AGAIN;
     success = _Thread_Wait_flags_try_change_release(
@@ -109,7 +109,8 @@ rtems_status_code rtems_message_queue_create(
            &the_message_queue->message_queue,
            discipline,
            count,
-           max_message_size
+           max_message_size,
+           false
          ) ) {
 #if defined(RTEMS_MULTIPROCESSING)
     if ( is_global )
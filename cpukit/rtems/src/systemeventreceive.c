@@ -61,7 +61,7 @@ rtems_status_code rtems_event_system_receive(
         &lock_context
       );
     } else {
-      *event_out = event->pending_events;
+      *event_out = _Event_Get_pending( event );
       _Thread_Wait_release_default( executing, &lock_context );
       sc = RTEMS_SUCCESSFUL;
     }
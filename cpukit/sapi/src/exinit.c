@@ -36,6 +36,7 @@
 #include <rtems/score/timecounter.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/todimpl.h>
+#include <rtems/score/watchdogimpl.h>
 #include <rtems/score/wkspace.h>
 
 RTEMS_SECTION(".rtemsroset.copyright") const char _Copyright_Notice[] =
@@ -92,6 +93,8 @@ static void rtems_initialize_data_structures(void)
 
   _Scheduler_Handler_initialization();
 
+  _Watchdog_Handler_initialization();
+
   _SMP_Handler_initialize();
 }
 
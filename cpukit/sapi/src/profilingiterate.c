@@ -20,6 +20,7 @@
 #include <rtems/counter.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smplock.h>
+#include <rtems/score/threadqimpl.h>
 #include <rtems.h>
 
 #include <string.h>
@@ -138,6 +139,55 @@ static void smp_lock_stats_iterate(
 #endif
 }
 
+static void thread_queue_stats_iterate(
+  rtems_profiling_visitor visitor,
+  void *visitor_arg,
+  rtems_profiling_data *data
+)
+{
+#ifdef RTEMS_PROFILING
+  size_t i;
+  char name[64];
+
+  memset(data, 0, sizeof(*data));
+  data->header.type = RTEMS_PROFILING_THREAD_QUEUE;
+
+  for (i = 0; i < THREAD_QUEUE_STATS_COUNT; ++i) {
+    Thread_queue_Stats snapshot;
+    rtems_profiling_thread_queue *thread_queue_data;
+
+    if (!_Thread_queue_Stats_get(i, &snapshot)) {
+      continue;
+    }
+
+    thread_queue_data = &data->thread_queue;
+    thread_queue_data->id = snapshot.id;
+
+    if (snapshot.id != 0) {
+      thread_queue_data->name =
+        rtems_object_get_name(snapshot.id, sizeof(name), &name[0]);
+    } else {
+      thread_queue_data->name = snapshot.name;
+    }
+
+    if (thread_queue_data->name == NULL) {
+      thread_queue_data->name = "";
+    }
+
+    thread_queue_data->max_wait_owner = snapshot.max_wait_owner;
+    thread_queue_data->block_count = snapshot.block_count;
+    thread_queue_data->max_wait_time = snapshot.max_wait_time;
+    thread_queue_data->total_wait_time = snapshot.total_wait_time;
+
+    (*visitor)(visitor_arg, data);
+  }
+#else
+  (void) visitor;
+  (void) visitor_arg;
+  (void) data;
+#endif
+}
+
 void rtems_profiling_iterate(
   rtems_profiling_visitor visitor,
   void *visitor_arg
@@ -147,4 +197,5 @@ void rtems_profiling_iterate(
 
   per_cpu_stats_iterate(visitor, visitor_arg, &data);
   smp_lock_stats_iterate(visitor, visitor_arg, &data);
+  thread_queue_stats_iterate(visitor, visitor_arg, &data);
 }
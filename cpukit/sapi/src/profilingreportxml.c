@@ -21,6 +21,8 @@
 #ifdef RTEMS_PROFILING
 
 #include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
 
 typedef struct {
   const rtems_printer *printer;
@@ -253,6 +255,67 @@ static void report_smp_lock(context *ctx, const rtems_profiling_smp_lock *smp_lo
   update_retval(ctx, rv);
 }
 
+static void report_thread_queue(
+  context *ctx,
+  const rtems_profiling_thread_queue *thread_queue
+)
+{
+  int rv;
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "<ThreadQueueProfilingReport id=\"0x%08" PRIx32 "\" name=\"%s\">\n",
+    thread_queue->id,
+    thread_queue->name
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxWaitTime unit=\"ns\" owner=\"0x%08" PRIx32 "\">%" PRIu64
+      "</MaxWaitTime>\n",
+    thread_queue->max_wait_owner,
+    thread_queue->max_wait_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MeanWaitTime unit=\"ns\">%" PRIu64 "</MeanWaitTime>\n",
+    arithmetic_mean(
+      thread_queue->total_wait_time,
+      thread_queue->block_count
+    )
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<TotalWaitTime unit=\"ns\">%" PRIu64 "</TotalWaitTime>\n",
+    thread_queue->total_wait_time
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<BlockCount>%" PRIu64 "</BlockCount>\n",
+    thread_queue->block_count
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "</ThreadQueueProfilingReport>\n"
+  );
+  update_retval(ctx, rv);
+}
+
 static void report(void *arg, const rtems_profiling_data *data)
 {
   context *ctx = arg;
@@ -264,9 +327,67 @@ static void report(void *arg, const rtems_profiling_data *data)
     case RTEMS_PROFILING_SMP_LOCK:
       report_smp_lock(ctx, &data->smp_lock);
       break;
+    case RTEMS_PROFILING_THREAD_QUEUE:
+      report_thread_queue(ctx, &data->thread_queue);
+      break;
+  }
+}
+
+typedef struct {
+  rtems_profiling_thread_queue data;
+  char name[64];
+} contention_item;
+
+typedef struct {
+  contention_item *items;
+  size_t count;
+  size_t capacity;
+} contention_context;
+
+static void count_thread_queues(void *arg, const rtems_profiling_data *data)
+{
+  contention_context *cctx = arg;
+
+  if (data->header.type == RTEMS_PROFILING_THREAD_QUEUE) {
+    ++cctx->capacity;
   }
 }
 
+static void collect_thread_queues(void *arg, const rtems_profiling_data *data)
+{
+  contention_context *cctx = arg;
+
+  if (
+    data->header.type == RTEMS_PROFILING_THREAD_QUEUE
+      && cctx->count < cctx->capacity
+  ) {
+    contention_item *item = &cctx->items[cctx->count];
+
+    item->data = data->thread_queue;
+    strlcpy(&item->name[0], data->thread_queue.name, sizeof(item->name));
+    item->data.name = &item->name[0];
+    ++cctx->count;
+  }
+}
+
+static int compare_thread_queues(const void *a, const void *b)
+{
+  const contention_item *item_a = a;
+  const contention_item *item_b = b;
+  uint64_t total_a = item_a->data.total_wait_time;
+  uint64_t total_b = item_b->data.total_wait_time;
+
+  if (total_a != total_b) {
+    return total_a < total_b ? 1 : -1;
+  }
+
+  if (item_a->data.block_count != item_b->data.block_count) {
+    return item_a->data.block_count < item_b->data.block_count ? 1 : -1;
+  }
+
+  return 0;
+}
+
 #endif /* RTEMS_PROFILING */
 
 int rtems_profiling_report_xml(
@@ -306,3 +427,79 @@ int rtems_profiling_report_xml(
   return 0;
 #endif /* RTEMS_PROFILING */
 }
+
+int rtems_profiling_report_contention_xml(
+  const char *name,
+  const rtems_printer *printer,
+  uint32_t indentation_level,
+  const char *indentation,
+  size_t max_count
+)
+{
+#ifdef RTEMS_PROFILING
+  context ctx_instance = {
+    .printer = printer,
+    .indentation_level = indentation_level,
+    .indentation = indentation,
+    .retval = 0
+  };
+  context *ctx = &ctx_instance;
+  contention_context cctx = {
+    .items = NULL,
+    .count = 0,
+    .capacity = 0
+  };
+  size_t i;
+  int rv;
+
+  rtems_profiling_iterate(count_thread_queues, &cctx);
+
+  if (cctx.capacity > 0) {
+    cctx.items = malloc(cctx.capacity * sizeof(*cctx.items));
+    if (cctx.items == NULL) {
+      return -1;
+    }
+
+    rtems_profiling_iterate(collect_thread_queues, &cctx);
+    qsort(
+      cctx.items,
+      cctx.count,
+      sizeof(*cctx.items),
+      compare_thread_queues
+    );
+  }
+
+  if (max_count == 0 || max_count > cctx.count) {
+    max_count = cctx.count;
+  }
+
+  indent(ctx, 0);
+  rv = rtems_printf(
+    printer,
+    "<ContentionReport name=\"%s\" threadQueueCount=\"%zu\">\n",
+    name,
+    cctx.count
+  );
+  update_retval(ctx, rv);
+
+  for (i = 0; i < max_count; ++i) {
+    report_thread_queue(ctx, &cctx.items[i].data);
+  }
+
+  indent(ctx, 0);
+  rv = rtems_printf(printer, "</ContentionReport>\n");
+  update_retval(ctx, rv);
+
+  free(cctx.items);
+
+  return ctx->retval;
+#else /* RTEMS_PROFILING */
+  (void) name;
+  (void) printer;
+  (void) indentation_level;
+  (void) indentation;
+  (void) max_count;
+
+  return 0;
+#endif /* RTEMS_PROFILING */
+}
@@ -46,12 +46,16 @@ bool _CORE_message_queue_Initialize(
   CORE_message_queue_Control     *the_message_queue,
   CORE_message_queue_Disciplines  discipline,
   uint32_t                        maximum_pending_messages,
-  size_t                          maximum_message_size
+  size_t                          maximum_message_size,
+  bool                            prioritized
 )
 {
   size_t message_buffering_required = 0;
   size_t aligned_message_size;
   size_t align_mask;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  size_t i;
+#endif
 
   the_message_queue->maximum_pending_messages   = maximum_pending_messages;
   the_message_queue->number_of_pending_messages = 0;
@@ -104,6 +108,31 @@ bool _CORE_message_queue_Initialize(
 
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  if ( prioritized ) {
+    CORE_message_queue_Pending_buckets *pending_buckets;
+
+    pending_buckets = _Workspace_Allocate( sizeof( *pending_buckets ) );
+
+    if ( pending_buckets == NULL ) {
+      _Workspace_Free( the_message_queue->message_buffers );
+      return false;
+    }
+
+    _Priority_bit_map_Initialize( &pending_buckets->Bit_map );
+
+    for ( i = 0; i < CORE_MESSAGE_QUEUE_PENDING_BUCKETS; ++i ) {
+      _Chain_Initialize_empty( &pending_buckets->Buckets[ i ] );
+    }
+
+    the_message_queue->Pending_buckets = pending_buckets;
+  } else {
+    the_message_queue->Pending_buckets = NULL;
+  }
+#else
+  (void) prioritized;
+#endif
+
   _Thread_queue_Object_initialize( &the_message_queue->Wait_queue );
 
   if ( discipline == CORE_MESSAGE_QUEUE_DISCIPLINES_PRIORITY ) {
@@ -52,5 +52,9 @@ void _CORE_message_queue_Close(
 
   (void) _Workspace_Free( the_message_queue->message_buffers );
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  (void) _Workspace_Free( the_message_queue->Pending_buckets );
+#endif
+
   _Thread_queue_Destroy( &the_message_queue->Wait_queue );
 }
@@ -0,0 +1,123 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief Commit a Message to the Message Queue
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+
+Status_Control _CORE_message_queue_Commit(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  size_t                             size,
+  CORE_message_queue_Submit_types    submit_type,
+  Thread_queue_Context              *queue_context
+)
+{
+  Thread_Control *the_thread;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  the_message->Contents.size = size;
+
+  /*
+   *  The zero-copy operations are only used by message queues without
+   *  blocking senders, so a waiting thread is a receiver if there are no
+   *  pending messages, see also _CORE_message_queue_Dequeue_receiver().
+   */
+  if ( the_message_queue->number_of_pending_messages == 0 ) {
+    the_thread = _Thread_queue_First_locked(
+      &the_message_queue->Wait_queue,
+      the_message_queue->operations
+    );
+  } else {
+    the_thread = NULL;
+  }
+
+  if ( the_thread != NULL ) {
+    if ( the_thread->Wait.return_argument_second.mutable_object == NULL ) {
+      #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+        the_message->priority = submit_type;
+      #endif
+      the_thread->Wait.return_argument_second.mutable_object = the_message;
+    } else {
+      _CORE_message_queue_Copy_buffer(
+        the_message->Contents.buffer,
+        the_thread->Wait.return_argument_second.mutable_object,
+        size
+      );
+      _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+    }
+
+    *(size_t *) the_thread->Wait.return_argument = size;
+    the_thread->Wait.count = (uint32_t) submit_type;
+
+    _Thread_queue_Extract_critical(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      the_thread,
+      queue_context
+    );
+    return STATUS_SUCCESSFUL;
+  }
+
+  _CORE_message_queue_Insert_pending_message(
+    the_message_queue,
+    the_message,
+    submit_type
+  );
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  if (
+    the_message_queue->number_of_pending_messages == 1
+      && the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+  return STATUS_SUCCESSFUL;
+}
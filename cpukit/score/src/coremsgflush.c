@@ -21,16 +21,38 @@
 
 #include <rtems/score/coremsgimpl.h>
 
-uint32_t   _CORE_message_queue_Flush(
+static void _CORE_message_queue_Flush_pending(
   CORE_message_queue_Control *the_message_queue,
-  Thread_queue_Context       *queue_context
+  Chain_Control              *pending_messages
 )
 {
   Chain_Node *inactive_head;
   Chain_Node *inactive_first;
   Chain_Node *message_queue_first;
   Chain_Node *message_queue_last;
+
+  inactive_head = _Chain_Head( &the_message_queue->Inactive_messages );
+  inactive_first = inactive_head->next;
+  message_queue_first = _Chain_First( pending_messages );
+  message_queue_last = _Chain_Last( pending_messages );
+
+  inactive_head->next = message_queue_first;
+  message_queue_last->next = inactive_first;
+  inactive_first->previous = message_queue_last;
+  message_queue_first->previous = inactive_head;
+
+  _Chain_Initialize_empty( pending_messages );
+}
+
+uint32_t   _CORE_message_queue_Flush(
+  CORE_message_queue_Control *the_message_queue,
+  Thread_queue_Context       *queue_context
+)
+{
   uint32_t    count;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  CORE_message_queue_Pending_buckets *pending_buckets;
+#endif
 
   /*
    *  Currently, RTEMS supports no API that has both flush and blocking
@@ -65,17 +87,39 @@ uint32_t   _CORE_message_queue_Flush(
   if ( count != 0 ) {
     the_message_queue->number_of_pending_messages = 0;
 
-    inactive_head = _Chain_Head( &the_message_queue->Inactive_messages );
-    inactive_first = inactive_head->next;
-    message_queue_first = _Chain_First( &the_message_queue->Pending_messages );
-    message_queue_last = _Chain_Last( &the_message_queue->Pending_messages );
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    pending_buckets = the_message_queue->Pending_buckets;
 
-    inactive_head->next = message_queue_first;
-    message_queue_last->next = inactive_first;
-    inactive_first->previous = message_queue_last;
-    message_queue_first->previous = inactive_head;
+    if ( pending_buckets != NULL ) {
+      /*
+       *  The count of non-empty buckets is bounded by
+       *  CORE_MESSAGE_QUEUE_PENDING_BUCKETS, so the execution time is still
+       *  independent of the count of pending messages.
+       */
+      do {
+        Priority_bit_map_Information bit_map_info;
+        unsigned int                 index;
 
-    _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+        index = _Priority_bit_map_Get_highest( &pending_buckets->Bit_map );
+        _CORE_message_queue_Flush_pending(
+          the_message_queue,
+          &pending_buckets->Buckets[ index ]
+        );
+        _Priority_bit_map_Initialize_information(
+          &pending_buckets->Bit_map,
+          &bit_map_info,
+          index
+        );
+        _Priority_bit_map_Remove( &pending_buckets->Bit_map, &bit_map_info );
+      } while ( !_Priority_bit_map_Is_empty( &pending_buckets->Bit_map ) );
+    } else
+#endif
+    {
+      _CORE_message_queue_Flush_pending(
+        the_message_queue,
+        &the_message_queue->Pending_messages
+      );
+    }
   }
 
   _CORE_message_queue_Release( the_message_queue, queue_context );
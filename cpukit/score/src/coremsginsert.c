@@ -21,23 +21,6 @@
 
 #include <rtems/score/coremsgimpl.h>
 
-#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
-static bool _CORE_message_queue_Order(
-  const void       *left,
-  const Chain_Node *right
-)
-{
-   const int                               *left_priority;
-   const CORE_message_queue_Buffer_control *right_message;
-
-   left_priority = (const int *) left;
-   right_message = (const CORE_message_queue_Buffer_control *) right;
-
-   return *left_priority <
-     _CORE_message_queue_Get_message_priority( right_message );
-}
-#endif
-
 void _CORE_message_queue_Insert_message(
   CORE_message_queue_Control        *the_message_queue,
   CORE_message_queue_Buffer_control *the_message,
@@ -46,8 +29,6 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 )
 {
-  Chain_Control *pending_messages;
-
   the_message->Contents.size = content_size;
 
   _CORE_message_queue_Copy_buffer(
@@ -56,28 +37,54 @@ void _CORE_message_queue_Insert_message(
     content_size
   );
 
+  _CORE_message_queue_Insert_pending_message(
+    the_message_queue,
+    the_message,
+    submit_type
+  );
+}
+
+void _CORE_message_queue_Insert_pending_message(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  CORE_message_queue_Submit_types    submit_type
+)
+{
+  Chain_Control                      *pending_messages;
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  CORE_message_queue_Pending_buckets *pending_buckets;
+
   the_message->priority = submit_type;
 #endif
 
-  pending_messages = &the_message_queue->Pending_messages;
   ++the_message_queue->number_of_pending_messages;
+  pending_messages = &the_message_queue->Pending_messages;
 
-  if ( submit_type == CORE_MESSAGE_QUEUE_SEND_REQUEST ) {
-    _Chain_Append_unprotected( pending_messages, &the_message->Node );
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
-  } else  if ( submit_type != CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
-    int priority;
+  pending_buckets = the_message_queue->Pending_buckets;
+
+  if ( pending_buckets != NULL ) {
+    unsigned int index;
 
-    priority = _CORE_message_queue_Get_message_priority( the_message );
-    _Chain_Insert_ordered_unprotected(
-      pending_messages,
-      &the_message->Node,
-      &priority,
-      _CORE_message_queue_Order
-    );
+    index = _CORE_message_queue_Get_bucket_index( submit_type );
+    pending_messages = &pending_buckets->Buckets[ index ];
+
+    if ( _Chain_Is_empty( pending_messages ) ) {
+      Priority_bit_map_Information bit_map_info;
+
+      _Priority_bit_map_Initialize_information(
+        &pending_buckets->Bit_map,
+        &bit_map_info,
+        index
+      );
+      _Priority_bit_map_Add( &pending_buckets->Bit_map, &bit_map_info );
+    }
+  }
 #endif
-  } else {
+
+  if ( submit_type == CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
     _Chain_Prepend_unprotected( pending_messages, &the_message->Node );
+  } else {
+    _Chain_Append_unprotected( pending_messages, &the_message->Node );
   }
 }
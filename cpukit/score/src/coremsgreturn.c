@@ -0,0 +1,82 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMessageQueue
+ *
+ * @brief Return a Message to the Message Queue
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+
+void _CORE_message_queue_Return_message(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  Thread_queue_Context              *queue_context
+)
+{
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+  Thread_Control *the_thread;
+
+  /*
+   *  If there are pending messages, then a waiting thread waits to send a
+   *  message.  It can use the returned message buffer.
+   */
+  if ( the_message_queue->number_of_pending_messages != 0 ) {
+    the_thread = _Thread_queue_First_locked(
+      &the_message_queue->Wait_queue,
+      the_message_queue->operations
+    );
+
+    if ( the_thread != NULL ) {
+      _CORE_message_queue_Insert_message(
+        the_message_queue,
+        the_message,
+        the_thread->Wait.return_argument_second.immutable_object,
+        (size_t) the_thread->Wait.option,
+        (CORE_message_queue_Submit_types) the_thread->Wait.count
+      );
+      _Thread_queue_Extract_critical(
+        &the_message_queue->Wait_queue.Queue,
+        the_message_queue->operations,
+        the_thread,
+        queue_context
+      );
+      return;
+    }
+  }
+#endif
+
+  _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+}
@@ -25,7 +25,11 @@ void _CORE_semaphore_Initialize(
   uint32_t                initial_value
 )
 {
+#if defined(RTEMS_SMP)
+  _Atomic_Init_uint( &the_semaphore->count, initial_value );
+#else
   the_semaphore->count = initial_value;
+#endif
 
   _Thread_queue_Object_initialize( &the_semaphore->Wait_queue );
 }
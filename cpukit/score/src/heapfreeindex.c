@@ -0,0 +1,189 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief Heap Handler Free List Index Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+static void _Heap_Free_index_set_bit(
+  Heap_Free_index *index,
+  unsigned int     size_class
+)
+{
+  unsigned int fl = size_class / HEAP_FREE_INDEX_SL_COUNT;
+  unsigned int sl = size_class % HEAP_FREE_INDEX_SL_COUNT;
+
+  index->sl_bitmap[ fl ] |= UINT32_C( 1 ) << sl;
+  index->fl_bitmap |= (uintptr_t) 1 << fl;
+}
+
+static void _Heap_Free_index_clear_bit(
+  Heap_Free_index *index,
+  unsigned int     size_class
+)
+{
+  unsigned int fl = size_class / HEAP_FREE_INDEX_SL_COUNT;
+  unsigned int sl = size_class % HEAP_FREE_INDEX_SL_COUNT;
+
+  index->sl_bitmap[ fl ] &= ~( UINT32_C( 1 ) << sl );
+
+  if ( index->sl_bitmap[ fl ] == 0 ) {
+    index->fl_bitmap &= ~( (uintptr_t) 1 << fl );
+  }
+}
+
+Heap_Block *_Heap_Free_index_find(
+  Heap_Control *heap,
+  unsigned int  size_class
+)
+{
+  const Heap_Free_index *index = heap->free_index;
+  unsigned int           fl;
+  unsigned int           sl;
+  uint32_t               sl_bits;
+
+  if ( size_class >= HEAP_FREE_INDEX_CLASS_COUNT ) {
+    return _Heap_Free_list_tail( heap );
+  }
+
+  fl = size_class / HEAP_FREE_INDEX_SL_COUNT;
+  sl = size_class % HEAP_FREE_INDEX_SL_COUNT;
+  sl_bits = index->sl_bitmap[ fl ] & ( UINT32_MAX << sl );
+
+  if ( sl_bits == 0 ) {
+    uintptr_t fl_bits;
+
+    /* The shift is valid, since the count of first level classes is less
+       than the bit width of the bitmap */
+    fl_bits = index->fl_bitmap & ( UINTPTR_MAX << ( fl + 1 ) );
+
+    if ( fl_bits == 0 ) {
+      return _Heap_Free_list_tail( heap );
+    }
+
+    fl = (unsigned int) __builtin_ctzl( (unsigned long) fl_bits );
+    sl_bits = index->sl_bitmap[ fl ];
+  }
+
+  sl = (unsigned int) __builtin_ctz( (unsigned int) sl_bits );
+
+  return index->first[ fl * HEAP_FREE_INDEX_SL_COUNT + sl ];
+}
+
+void _Heap_Free_index_insert( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Free_index *index;
+  unsigned int     size_class;
+  Heap_Block      *next;
+
+  index = heap->free_index;
+  size_class = _Heap_Free_index_class( _Heap_Block_size( block ) );
+  next = index->first[ size_class ];
+
+  if ( next == NULL ) {
+    next = _Heap_Free_index_find( heap, size_class + 1 );
+    _Heap_Free_index_set_bit( index, size_class );
+  }
+
+  _Heap_Free_list_insert_before( next, block );
+  index->first[ size_class ] = block;
+}
+
+void _Heap_Free_index_extract( Heap_Control *heap, Heap_Block *block )
+{
+  Heap_Free_index *index;
+  unsigned int     size_class;
+
+  index = heap->free_index;
+  size_class = _Heap_Free_index_class( _Heap_Block_size( block ) );
+
+  if ( index->first[ size_class ] == block ) {
+    Heap_Block *next = block->next;
+
+    if (
+      next != _Heap_Free_list_tail( heap )
+        && _Heap_Free_index_class( _Heap_Block_size( next ) ) == size_class
+    ) {
+      index->first[ size_class ] = next;
+    } else {
+      index->first[ size_class ] = NULL;
+      _Heap_Free_index_clear_bit( index, size_class );
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+bool _Heap_Free_index_enable( Heap_Control *heap )
+{
+  Heap_Free_index *index;
+  Heap_Block      *free_list_tail;
+  Heap_Block      *block;
+
+  if ( heap->free_index != NULL ) {
+    return true;
+  }
+
+  _Heap_Protection_free_all_delayed_blocks( heap );
+
+  index = _Heap_Allocate( heap, sizeof( *index ) );
+  if ( index == NULL ) {
+    return false;
+  }
+
+  memset( index, 0, sizeof( *index ) );
+
+  free_list_tail = _Heap_Free_list_tail( heap );
+  block = _Heap_Free_list_first( heap );
+
+  /* The head and tail of the free list are the same block */
+  free_list_tail->next = free_list_tail;
+  free_list_tail->prev = free_list_tail;
+
+  heap->free_index = index;
+
+  while ( block != free_list_tail ) {
+    Heap_Block *next = block->next;
+
+    _Heap_Free_index_insert( heap, block );
+    block = next;
+  }
+
+  return true;
+}
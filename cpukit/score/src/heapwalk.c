@@ -52,6 +52,57 @@ static void _Heap_Walk_print( int source, bool error, const char *fmt, ... )
   va_end( ap );
 }
 
+static bool _Heap_Walk_check_free_index(
+  int source,
+  Heap_Walk_printer printer,
+  const Heap_Free_index *index,
+  unsigned int size_class_count
+)
+{
+  unsigned int size_class;
+
+  for (
+    size_class = 0;
+    size_class < HEAP_FREE_INDEX_CLASS_COUNT;
+    ++size_class
+  ) {
+    unsigned int const fl = size_class / HEAP_FREE_INDEX_SL_COUNT;
+    unsigned int const sl = size_class % HEAP_FREE_INDEX_SL_COUNT;
+    bool const is_non_empty = index->first[ size_class ] != NULL;
+    bool const sl_bit = ( index->sl_bitmap[ fl ] & ( UINT32_C( 1 ) << sl ) )
+      != 0;
+    bool const fl_bit = ( index->fl_bitmap & ( (uintptr_t) 1 << fl ) ) != 0;
+
+    if ( is_non_empty != sl_bit || ( sl_bit && !fl_bit ) ) {
+      (*printer)(
+        source,
+        true,
+        "free list index: inconsistent bitmap for size class %u\n",
+        size_class
+      );
+
+      return false;
+    }
+
+    if ( is_non_empty ) {
+      if ( size_class_count == 0 ) {
+        (*printer)(
+          source,
+          true,
+          "free list index: size class %u not in free list\n",
+          size_class
+        );
+
+        return false;
+      }
+
+      --size_class_count;
+    }
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_check_free_list(
   int source,
   Heap_Walk_printer printer,
@@ -63,6 +114,9 @@ static bool _Heap_Walk_check_free_list(
   const Heap_Block *const first_free_block = _Heap_Free_list_first( heap );
   const Heap_Block *prev_block = free_list_tail;
   const Heap_Block *free_block = first_free_block;
+  const Heap_Free_index *const index = heap->free_index;
+  unsigned int prev_size_class = 0;
+  unsigned int size_class_count = 0;
 
   while ( free_block != free_list_tail ) {
     if ( !_Heap_Is_block_in_heap( heap, free_block ) ) {
@@ -112,10 +166,54 @@ static bool _Heap_Walk_check_free_list(
       return false;
     }
 
+    if ( index != NULL ) {
+      unsigned int const size_class =
+        _Heap_Free_index_class( _Heap_Block_size( free_block ) );
+
+      if ( prev_block == free_list_tail || size_class != prev_size_class ) {
+        if ( prev_block != free_list_tail && size_class < prev_size_class ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: size class %u out of order\n",
+            free_block,
+            size_class
+          );
+
+          return false;
+        }
+
+        if ( index->first[ size_class ] != free_block ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: not first block of size class %u\n",
+            free_block,
+            size_class
+          );
+
+          return false;
+        }
+
+        ++size_class_count;
+      }
+
+      prev_size_class = size_class;
+    }
+
     prev_block = free_block;
     free_block = free_block->next;
   }
 
+  if ( index != NULL ) {
+    return _Heap_Walk_check_free_index(
+      source,
+      printer,
+      index,
+      size_class_count
+    );
+  }
+
   return true;
 }
 
@@ -2138,6 +2138,18 @@ _Timecounter_Tick(void)
 	_Watchdog_Tick(cpu_self);
 }
 
+void
+_Timecounter_Tick_catch_up(uint32_t ticks)
+{
+	Per_CPU_Control *cpu_self = _Per_CPU_Get();
+
+	if (_Per_CPU_Is_boot_processor(cpu_self)) {
+		tc_windup(NULL);
+	}
+
+	_Watchdog_Tick_catch_up(cpu_self, ticks);
+}
+
 void
 _Timecounter_Tick_simple(uint32_t delta, uint32_t offset,
     ISR_lock_Context *lock_context)
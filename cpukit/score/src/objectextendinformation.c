@@ -109,7 +109,9 @@ Objects_Maximum _Objects_Extend_information(
     Objects_Control **object_blocks;
     Objects_Control **local_table;
     Objects_Maximum  *inactive_per_block;
+    Objects_Name_hash *name_hash;
     void             *old_tables;
+    void             *old_name_hash;
     size_t            table_size;
     uintptr_t         object_blocks_size;
     uintptr_t         local_table_size;
@@ -201,6 +203,25 @@ Objects_Maximum _Objects_Extend_information(
       local_table[ index ] = NULL;
     }
 
+    /*
+     *  The object name hash index depends on the local table size, so
+     *  rebuild it for the new table.
+     */
+    if ( information->name_hash != NULL ) {
+      name_hash = _Objects_Name_hash_Create(
+        information,
+        local_table,
+        (Objects_Maximum) new_maximum
+      );
+      if ( name_hash == NULL ) {
+        _Workspace_Free( object_blocks );
+        _Workspace_Free( new_object_block );
+        return 0;
+      }
+    } else {
+      name_hash = NULL;
+    }
+
     /* FIXME: https://devel.rtems.org/ticket/2280 */
     _ISR_lock_ISR_disable( &lock_context );
 
@@ -209,12 +230,15 @@ Objects_Maximum _Objects_Extend_information(
     information->object_blocks = object_blocks;
     information->inactive_per_block = inactive_per_block;
     information->local_table = local_table;
+    old_name_hash = information->name_hash;
+    information->name_hash = name_hash;
     information->maximum_id = api_class_and_node
       | (new_maximum << OBJECTS_INDEX_START_BIT);
 
     _ISR_lock_ISR_enable( &lock_context );
 
     _Workspace_Free( old_tables );
+    _Workspace_Free( old_name_hash );
 
     block_count++;
   }
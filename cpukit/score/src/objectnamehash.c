@@ -0,0 +1,340 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreObject
+ *
+ * @brief Object Name Hash Index
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+static uint32_t _Objects_Name_hash_Of_u32( uint32_t name )
+{
+  name ^= name >> 16;
+  name *= 0x7feb352dU;
+  name ^= name >> 15;
+  name *= 0x846ca68bU;
+  name ^= name >> 16;
+  return name;
+}
+
+static uint32_t _Objects_Name_hash_Of_string(
+  const char *name,
+  size_t      max_name_length
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  /* FNV-1a */
+  hash = 2166136261U;
+
+  for ( i = 0; i < max_name_length && name[ i ] != '\0'; ++i ) {
+    hash ^= (unsigned char) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+static Objects_Maximum *_Objects_Name_hash_Bucket(
+  const Objects_Information *information,
+  Objects_Name_hash         *name_hash,
+  const Objects_Control     *the_object
+)
+{
+  uint32_t hash;
+
+  if ( _Objects_Has_string_name( information ) ) {
+    if ( the_object->name.name_p == NULL ) {
+      return NULL;
+    }
+
+    hash = _Objects_Name_hash_Of_string(
+      the_object->name.name_p,
+      information->name_length
+    );
+  } else {
+    if ( the_object->name.name_u32 == 0 ) {
+      return NULL;
+    }
+
+    hash = _Objects_Name_hash_Of_u32( the_object->name.name_u32 );
+  }
+
+  return &name_hash->buckets[ hash % name_hash->bucket_count ];
+}
+
+static void _Objects_Name_hash_Insert_index(
+  Objects_Name_hash *name_hash,
+  Objects_Maximum   *bucket,
+  Objects_Maximum    index
+)
+{
+  Objects_Maximum *link;
+  Objects_Maximum  key;
+
+  /*
+   * The buckets are sorted by index, so that the first match of a lookup is
+   * the object with the lowest index just like in the linear search.
+   */
+  key = index + 1;
+  link = bucket;
+
+  while ( *link != 0 && *link < key ) {
+    link = &name_hash->next[ *link - 1 ];
+  }
+
+  if ( *link != key ) {
+    name_hash->next[ index ] = *link;
+    *link = key;
+  }
+}
+
+Objects_Name_hash *_Objects_Name_hash_Create(
+  const Objects_Information *information,
+  Objects_Control          **local_table,
+  Objects_Maximum            maximum
+)
+{
+  Objects_Name_hash *name_hash;
+  size_t             size;
+  Objects_Maximum    index;
+
+  _Assert( maximum > 0 );
+
+  size = sizeof( *name_hash ) + 2 * maximum * sizeof( name_hash->buckets[ 0 ] );
+  name_hash = _Workspace_Allocate( size );
+  if ( name_hash == NULL ) {
+    return NULL;
+  }
+
+  memset( name_hash, 0, size );
+  name_hash->bucket_count = maximum;
+  name_hash->next = &name_hash->buckets[ maximum ];
+
+  for ( index = 0; index < maximum; ++index ) {
+    Objects_Control *the_object;
+    Objects_Maximum *bucket;
+
+    the_object = local_table[ index ];
+    if ( the_object == NULL ) {
+      continue;
+    }
+
+    bucket = _Objects_Name_hash_Bucket( information, name_hash, the_object );
+    if ( bucket != NULL ) {
+      _Objects_Name_hash_Insert_index( name_hash, bucket, index );
+    }
+  }
+
+  return name_hash;
+}
+
+void _Objects_Name_hash_Initialize( void )
+{
+  uint32_t api;
+
+  for ( api = OBJECTS_CLASSIC_API ; api <= OBJECTS_APIS_LAST ; ++api ) {
+    uint32_t the_class;
+    uint32_t maximum_class;
+
+    maximum_class = _Objects_API_maximum_class( api );
+
+    for ( the_class = 1 ; the_class <= maximum_class ; ++the_class ) {
+      Objects_Information *information;
+      Objects_Maximum      maximum;
+
+      information = _Objects_Get_information( api, the_class );
+      if ( information == NULL ) {
+        continue;
+      }
+
+      /*
+       * Only the Classic API and the POSIX API object classes with string
+       * names provide a lookup by name.
+       */
+      if (
+        api != OBJECTS_CLASSIC_API
+          && !_Objects_Has_string_name( information )
+      ) {
+        continue;
+      }
+
+      maximum = _Objects_Get_maximum_index( information );
+      if ( maximum == 0 ) {
+        continue;
+      }
+
+      /*
+       * Without an index the lookup uses the linear search, so a failed
+       * allocation is not fatal.
+       */
+      information->name_hash = _Objects_Name_hash_Create(
+        information,
+        information->local_table,
+        maximum
+      );
+    }
+  }
+}
+
+void _Objects_Name_hash_Do_insert(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+)
+{
+  Objects_Name_hash *name_hash;
+  Objects_Maximum   *bucket;
+
+  name_hash = information->name_hash;
+  bucket = _Objects_Name_hash_Bucket( information, name_hash, the_object );
+  if ( bucket == NULL ) {
+    return;
+  }
+
+  _Objects_Name_hash_Insert_index(
+    name_hash,
+    bucket,
+    _Objects_Get_index( the_object->id ) - OBJECTS_INDEX_MINIMUM
+  );
+}
+
+void _Objects_Name_hash_Do_extract(
+  const Objects_Information *information,
+  Objects_Control           *the_object
+)
+{
+  Objects_Name_hash *name_hash;
+  Objects_Maximum   *link;
+  Objects_Maximum    key;
+
+  name_hash = information->name_hash;
+  link = _Objects_Name_hash_Bucket( information, name_hash, the_object );
+  if ( link == NULL ) {
+    return;
+  }
+
+  key = _Objects_Get_index( the_object->id ) - OBJECTS_INDEX_MINIMUM + 1;
+
+  while ( *link != 0 && *link < key ) {
+    link = &name_hash->next[ *link - 1 ];
+  }
+
+  if ( *link == key ) {
+    *link = name_hash->next[ key - 1 ];
+    name_hash->next[ key - 1 ] = 0;
+  }
+}
+
+bool _Objects_Name_hash_Find_u32(
+  const Objects_Information *information,
+  uint32_t                   name,
+  Objects_Id                *id
+)
+{
+  Objects_Name_hash *name_hash;
+  Objects_Maximum    key;
+
+  /*
+   * The owner of the allocator lock is the only one to change or replace the
+   * index, so the chain walk needs no interrupt lock, see
+   * _Objects_Name_to_id_u32().
+   */
+  _Assert( _Objects_Allocator_is_owner() );
+
+  name_hash = information->name_hash;
+  key = name_hash->buckets[
+    _Objects_Name_hash_Of_u32( name ) % name_hash->bucket_count
+  ];
+
+  while ( key != 0 ) {
+    const Objects_Control *the_object;
+
+    the_object = information->local_table[ key - 1 ];
+
+    if ( the_object != NULL && the_object->name.name_u32 == name ) {
+      *id = the_object->id;
+      return true;
+    }
+
+    key = name_hash->next[ key - 1 ];
+  }
+
+  return false;
+}
+
+Objects_Control *_Objects_Name_hash_Find_string(
+  const Objects_Information *information,
+  const char                *name
+)
+{
+  Objects_Name_hash *name_hash;
+  Objects_Control   *the_object;
+  size_t             max_name_length;
+  Objects_Maximum    key;
+
+  /*
+   * The owner of the allocator lock is the only one to change the index, so
+   * there is no need to acquire the index lock.
+   */
+  _Assert( _Objects_Allocator_is_owner() );
+
+  name_hash = information->name_hash;
+  max_name_length = information->name_length;
+  key = name_hash->buckets[
+    _Objects_Name_hash_Of_string( name, max_name_length )
+      % name_hash->bucket_count
+  ];
+
+  while ( key != 0 ) {
+    the_object = information->local_table[ key - 1 ];
+
+    if (
+      the_object != NULL
+        && the_object->name.name_p != NULL
+        && strncmp( name, the_object->name.name_p, max_name_length ) == 0
+    ) {
+      return the_object;
+    }
+
+    key = name_hash->next[ key - 1 ];
+  }
+
+  return NULL;
+}
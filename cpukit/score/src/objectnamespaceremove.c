@@ -30,6 +30,7 @@ void _Objects_Namespace_remove_string(
   char *name;
 
   _Assert( _Objects_Has_string_name( information ) );
+  _Objects_Name_hash_Extract( information, the_object );
   name = RTEMS_DECONST( char *, the_object->name.name_p );
   the_object->name.name_p = NULL;
   _Workspace_Free( name );
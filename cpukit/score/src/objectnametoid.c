@@ -19,6 +19,7 @@
 #endif
 
 #include <rtems/score/objectimpl.h>
+#include <rtems/score/threaddispatch.h>
 
 Objects_Name_or_id_lookup_errors _Objects_Name_to_id_u32(
   Objects_Information *information,
@@ -53,7 +54,26 @@ Objects_Name_or_id_lookup_errors _Objects_Name_to_id_u32(
       ))
    search_local_node = true;
 
-  if ( search_local_node ) {
+  /*
+   * The name hash index is protected by the allocator lock.  This lock cannot
+   * be obtained in interrupt context and while thread dispatching is
+   * disabled, so use the linear search of the local table in these cases.
+   */
+  if (
+    search_local_node
+      && information->name_hash != NULL
+      && _Thread_Dispatch_is_enabled()
+  ) {
+    bool found;
+
+    _Objects_Allocator_lock();
+    found = _Objects_Name_hash_Find_u32( information, name, id );
+    _Objects_Allocator_unlock();
+
+    if ( found ) {
+      return OBJECTS_NAME_OR_ID_LOOKUP_SUCCESSFUL;
+    }
+  } else if ( search_local_node ) {
     for ( index = 0; index < maximum; ++index ) {
       the_object = information->local_table[ index ];
       if ( !the_object )
@@ -40,6 +40,7 @@ bool _Objects_Set_name(
       return false;
     }
 
+    _Objects_Name_hash_Extract( information, the_object );
     the_object->name.name_p = dup;
   } else {
     char c[ 4 ];
@@ -55,9 +56,11 @@ bool _Objects_Set_name(
       c[ i ] = name[ i ];
     }
 
+    _Objects_Name_hash_Extract( information, the_object );
     the_object->name.name_u32 =
       _Objects_Build_name( c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ] );
   }
 
+  _Objects_Name_hash_Insert( information, the_object );
   return true;
 }
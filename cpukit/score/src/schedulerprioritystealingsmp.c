@@ -0,0 +1,814 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerPriorityStealingSMP
+ *
+ * @brief Work Stealing Priority SMP Scheduler Implementation
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/schedulerprioritystealingsmp.h>
+#include <rtems/score/schedulerpriorityimpl.h>
+#include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/smpimpl.h>
+
+#include <limits.h>
+
+static Scheduler_priority_stealing_SMP_Context *
+_Scheduler_priority_stealing_SMP_Get_self( Scheduler_Context *context )
+{
+  return (Scheduler_priority_stealing_SMP_Context *) context;
+}
+
+static Scheduler_priority_stealing_SMP_Context *
+_Scheduler_priority_stealing_SMP_Get_context(
+  const Scheduler_Control *scheduler
+)
+{
+  return (Scheduler_priority_stealing_SMP_Context *)
+    _Scheduler_Get_context( scheduler );
+}
+
+static Scheduler_priority_stealing_SMP_Node *
+_Scheduler_priority_stealing_SMP_Node_downcast( Scheduler_Node *node )
+{
+  return (Scheduler_priority_stealing_SMP_Node *) node;
+}
+
+static bool _Scheduler_priority_stealing_SMP_Priority_less_equal(
+  const void       *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Priority_less_equal( to_insert, next );
+}
+
+static uint32_t _Scheduler_priority_stealing_SMP_Get_CPU_index(
+  const Scheduler_Node *node
+)
+{
+  return _Per_CPU_Get_index(
+    _Thread_Get_CPU( _Scheduler_Node_get_user( node ) )
+  );
+}
+
+void _Scheduler_priority_stealing_SMP_Initialize(
+  const Scheduler_Control *scheduler
+)
+{
+  Scheduler_priority_stealing_SMP_Context *self;
+  uint32_t                                 cpu_index;
+
+  self = _Scheduler_priority_stealing_SMP_Get_context( scheduler );
+  _Scheduler_SMP_Initialize( &self->Base );
+
+  /*
+   * The size of a chain control is a multiple of the pointer size, so there
+   * is no padding between the ready chains and the ready queues.
+   */
+  RTEMS_STATIC_ASSERT(
+    sizeof( Chain_Control ) % sizeof( void * ) == 0,
+    SCHEDULER_PRIORITY_STEALING_SMP_QUEUE_ALIGNMENT
+  );
+  self->Queues = (Scheduler_priority_stealing_SMP_Queue *) &self->Ready[
+    _SMP_Processor_configured_maximum * ( scheduler->maximum_priority + 1 )
+  ];
+
+  for (
+    cpu_index = 0 ;
+    cpu_index < _SMP_Processor_configured_maximum ;
+    ++cpu_index
+  ) {
+    Scheduler_priority_stealing_SMP_Queue *queue;
+
+    queue = &self->Queues[ cpu_index ];
+    queue->Ready = &self->Ready[
+      cpu_index * ( scheduler->maximum_priority + 1 )
+    ];
+    _Priority_bit_map_Initialize( &queue->Bit_map );
+    _Scheduler_priority_Ready_queue_initialize(
+      queue->Ready,
+      scheduler->maximum_priority
+    );
+  }
+}
+
+void _Scheduler_priority_stealing_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_priority_stealing_SMP_Context *self;
+  Scheduler_priority_stealing_SMP_Node    *the_node;
+
+  the_node = _Scheduler_priority_stealing_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_initialize(
+    scheduler,
+    &the_node->Base,
+    the_thread,
+    priority
+  );
+
+  self = _Scheduler_priority_stealing_SMP_Get_context( scheduler );
+  the_node->generation = 0;
+  the_node->ready_queue_index = 0;
+  _Scheduler_priority_Ready_queue_update(
+    &the_node->Ready_queue,
+    SCHEDULER_PRIORITY_UNMAP( priority ),
+    &self->Queues[ 0 ].Bit_map,
+    self->Queues[ 0 ].Ready
+  );
+  _Processor_mask_Assign( &the_node->Affinity, _SMP_Get_online_processors() );
+}
+
+/*
+ * Returns the index of the processor of the ready queue for the node.  This is
+ * the processor the node executed on last, if it is in the affinity set of the
+ * node and owned by the scheduler instance, otherwise some other processor of
+ * the affinity set owned by the scheduler instance.
+ */
+static uint32_t _Scheduler_priority_stealing_SMP_Select_queue(
+  const Scheduler_Context                    *context,
+  const Scheduler_priority_stealing_SMP_Node *node
+)
+{
+  uint32_t       cpu_index;
+  Processor_mask eligible;
+  uint32_t       last;
+
+  cpu_index = _Scheduler_priority_stealing_SMP_Get_CPU_index(
+    &node->Base.Base
+  );
+
+  if (
+    _Processor_mask_Is_set( &node->Affinity, cpu_index )
+      && _Processor_mask_Is_set( &context->Processors, cpu_index )
+  ) {
+    return cpu_index;
+  }
+
+  _Processor_mask_And( &eligible, &node->Affinity, &context->Processors );
+  last = _Processor_mask_Find_last_set( &eligible );
+
+  if ( last != 0 ) {
+    cpu_index = last - 1;
+  }
+
+  return cpu_index;
+}
+
+static void _Scheduler_priority_stealing_SMP_Insert_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  Priority_Control   insert_priority
+)
+{
+  Scheduler_priority_stealing_SMP_Context *self;
+  Scheduler_priority_stealing_SMP_Node    *node;
+  Scheduler_priority_stealing_SMP_Queue   *queue;
+  uint32_t                                 queue_index;
+  int                                      generation_index;
+  int                                      increment;
+  int64_t                                  generation;
+
+  self = _Scheduler_priority_stealing_SMP_Get_self( context );
+  node = _Scheduler_priority_stealing_SMP_Node_downcast( node_base );
+  queue_index = _Scheduler_priority_stealing_SMP_Select_queue( context, node );
+  queue = &self->Queues[ queue_index ];
+  generation_index = SCHEDULER_PRIORITY_IS_APPEND( insert_priority );
+  increment = ( generation_index << 1 ) - 1;
+
+  generation = self->generations[ generation_index ];
+  node->generation = generation;
+  self->generations[ generation_index ] = generation + increment;
+
+  node->ready_queue_index = queue_index;
+  _Scheduler_priority_Ready_queue_update(
+    &node->Ready_queue,
+    SCHEDULER_PRIORITY_UNMAP( _Scheduler_SMP_Node_priority( node_base ) ),
+    &queue->Bit_map,
+    queue->Ready
+  );
+
+  if ( SCHEDULER_PRIORITY_IS_APPEND( insert_priority ) ) {
+    _Scheduler_priority_Ready_queue_enqueue(
+      &node->Base.Base.Node.Chain,
+      &node->Ready_queue,
+      &queue->Bit_map
+    );
+  } else {
+    _Scheduler_priority_Ready_queue_enqueue_first(
+      &node->Base.Base.Node.Chain,
+      &node->Ready_queue,
+      &queue->Bit_map
+    );
+  }
+}
+
+static void _Scheduler_priority_stealing_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  Scheduler_priority_stealing_SMP_Context *self;
+  Scheduler_priority_stealing_SMP_Node    *node;
+
+  self = _Scheduler_priority_stealing_SMP_Get_self( context );
+  node = _Scheduler_priority_stealing_SMP_Node_downcast( node_to_extract );
+
+  _Scheduler_priority_Ready_queue_extract(
+    &node->Base.Base.Node.Chain,
+    &node->Ready_queue,
+    &self->Queues[ node->ready_queue_index ].Bit_map
+  );
+}
+
+static void _Scheduler_priority_stealing_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  Priority_Control insert_priority;
+
+  _Chain_Extract_unprotected( &scheduled_to_ready->Node.Chain );
+  insert_priority = _Scheduler_SMP_Node_priority( scheduled_to_ready );
+  _Scheduler_priority_stealing_SMP_Insert_ready(
+    context,
+    scheduled_to_ready,
+    insert_priority
+  );
+}
+
+static void _Scheduler_priority_stealing_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Scheduler_SMP_Context *self;
+  Priority_Control       insert_priority;
+
+  self = _Scheduler_SMP_Get_self( context );
+  _Scheduler_priority_stealing_SMP_Extract_from_ready(
+    context,
+    ready_to_scheduled
+  );
+  insert_priority = _Scheduler_SMP_Node_priority( ready_to_scheduled );
+  insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+  _Chain_Insert_ordered_unprotected(
+    &self->Scheduled,
+    &ready_to_scheduled->Node.Chain,
+    &insert_priority,
+    _Scheduler_SMP_Priority_less_equal
+  );
+}
+
+static void _Scheduler_priority_stealing_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_update,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_SMP_Node *node;
+
+  (void) context;
+
+  /* The ready queue is selected by the insert ready operation */
+  node = _Scheduler_SMP_Node_downcast( node_to_update );
+  _Scheduler_SMP_Node_update_priority( node, new_priority );
+}
+
+static bool _Scheduler_priority_stealing_SMP_Has_ready(
+  Scheduler_Context *context
+)
+{
+  Scheduler_priority_stealing_SMP_Context *self;
+  uint32_t                                 cpu_max;
+  uint32_t                                 cpu_index;
+
+  self = _Scheduler_priority_stealing_SMP_Get_self( context );
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if ( !_Priority_bit_map_Is_empty( &self->Queues[ cpu_index ].Bit_map ) ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/*
+ * Returns the first node of the ready queue in priority order which has an
+ * affinity to the processor.  Only ready chains with a priority less than or
+ * equal to the priority limit are considered.  Returns NULL if there is no such
+ * node.
+ */
+static Scheduler_priority_stealing_SMP_Node *
+_Scheduler_priority_stealing_SMP_First_eligible(
+  const Scheduler_priority_stealing_SMP_Queue *queue,
+  uint32_t                                     cpu_index,
+  unsigned int                                 priority_limit
+)
+{
+  uint32_t major_bit_map;
+
+  major_bit_map = queue->Bit_map.major_bit_map;
+
+  while ( major_bit_map != 0 ) {
+    unsigned int major;
+    uint32_t     minor_bit_map;
+
+    major = _Bitfield_Find_first_bit( major_bit_map );
+    major_bit_map &= ~_Priority_Mask( major );
+    minor_bit_map = queue->Bit_map.bit_map[ _Priority_Bits_index( major ) ];
+
+    while ( minor_bit_map != 0 ) {
+      unsigned int      minor;
+      unsigned int      priority;
+      Chain_Control    *ready_chain;
+      const Chain_Node *tail;
+      Chain_Node       *next;
+
+      minor = _Bitfield_Find_first_bit( minor_bit_map );
+      minor_bit_map &= ~_Priority_Mask( minor );
+      priority = ( _Priority_Bits_index( major ) << 4 )
+        + _Priority_Bits_index( minor );
+
+      if ( priority > priority_limit ) {
+        return NULL;
+      }
+
+      ready_chain = &queue->Ready[ priority ];
+      tail = _Chain_Immutable_tail( ready_chain );
+      next = _Chain_First( ready_chain );
+
+      while ( next != tail ) {
+        Scheduler_priority_stealing_SMP_Node *node;
+
+        node = (Scheduler_priority_stealing_SMP_Node *) next;
+
+        if ( _Processor_mask_Is_set( &node->Affinity, cpu_index ) ) {
+          return node;
+        }
+
+        next = _Chain_Next( next );
+      }
+    }
+  }
+
+  return NULL;
+}
+
+/*
+ * Returns the highest priority ready node which can be allocated to the
+ * processor of the filter node.  The ready queue of this processor is looked
+ * at first.  Afterwards the ready queues of the other processors are searched
+ * for a node to steal.  A remote node of higher priority is always stolen.  A
+ * remote node of equal priority is only stolen if it is older than the local
+ * node by more than the generation window, this bounds the priority inversion
+ * among nodes of equal priority.  The idle nodes have an affinity to all
+ * online processors, so a node is found at the latest at the idle priority.
+ */
+static Scheduler_Node *_Scheduler_priority_stealing_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_priority_stealing_SMP_Context *self;
+  Scheduler_priority_stealing_SMP_Node    *highest_ready;
+  Scheduler_priority_stealing_SMP_Node    *local;
+  uint32_t                                 local_index;
+  uint32_t                                 cpu_max;
+  uint32_t                                 cpu_index;
+
+  self = _Scheduler_priority_stealing_SMP_Get_self( context );
+  cpu_max = _SMP_Get_processor_maximum();
+  local_index = _Scheduler_priority_stealing_SMP_Get_CPU_index( filter );
+  local = _Scheduler_priority_stealing_SMP_First_eligible(
+    &self->Queues[ local_index ],
+    local_index,
+    UINT_MAX
+  );
+  highest_ready = local;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    const Scheduler_priority_stealing_SMP_Queue *queue;
+    Scheduler_priority_stealing_SMP_Node        *candidate;
+    unsigned int                                 priority_limit;
+    Priority_Control                             candidate_priority;
+    Priority_Control                             highest_priority;
+    int64_t                                      window;
+
+    queue = &self->Queues[ cpu_index ];
+
+    if (
+      cpu_index == local_index
+        || _Priority_bit_map_Is_empty( &queue->Bit_map )
+    ) {
+      continue;
+    }
+
+    if ( highest_ready != NULL ) {
+      highest_priority = _Scheduler_SMP_Node_priority(
+        &highest_ready->Base.Base
+      );
+      priority_limit = (unsigned int) SCHEDULER_PRIORITY_UNMAP(
+        highest_priority
+      );
+    } else {
+      highest_priority = 0;
+      priority_limit = UINT_MAX;
+    }
+
+    candidate = _Scheduler_priority_stealing_SMP_First_eligible(
+      queue,
+      local_index,
+      priority_limit
+    );
+
+    if ( candidate == NULL ) {
+      continue;
+    }
+
+    if ( highest_ready == NULL ) {
+      highest_ready = candidate;
+      continue;
+    }
+
+    candidate_priority = _Scheduler_SMP_Node_priority( &candidate->Base.Base );
+    window = highest_ready == local ?
+      SCHEDULER_PRIORITY_STEALING_SMP_GENERATION_WINDOW : 0;
+
+    if (
+      candidate_priority < highest_priority
+        || candidate->generation + window < highest_ready->generation
+    ) {
+      highest_ready = candidate;
+    }
+  }
+
+  _Assert( highest_ready != NULL );
+  return &highest_ready->Base.Base;
+}
+
+/*
+ * Returns the lowest priority scheduled node executing on a processor of the
+ * affinity set of the filter node.  Among scheduled nodes of equal priority,
+ * the one executing on the processor of the filter node is preferred to avoid
+ * a migration.  In case no processor of the affinity set is owned by the
+ * scheduler instance, NULL is returned.
+ */
+static Scheduler_Node *_Scheduler_priority_stealing_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_SMP_Context                *self;
+  Scheduler_priority_stealing_SMP_Node *node;
+  Scheduler_Node                       *lowest;
+  uint32_t                              filter_index;
+  const Chain_Node                     *head;
+  Chain_Node                           *previous;
+
+  self = _Scheduler_SMP_Get_self( context );
+  node = _Scheduler_priority_stealing_SMP_Node_downcast( filter );
+  filter_index = _Scheduler_priority_stealing_SMP_Get_CPU_index( filter );
+  lowest = NULL;
+  head = _Chain_Immutable_head( &self->Scheduled );
+  previous = _Chain_Last( &self->Scheduled );
+
+  while ( previous != head ) {
+    Scheduler_Node *scheduled;
+    uint32_t        cpu_index;
+
+    scheduled = (Scheduler_Node *) previous;
+
+    if (
+      lowest != NULL
+        && _Scheduler_SMP_Node_priority( scheduled )
+          != _Scheduler_SMP_Node_priority( lowest )
+    ) {
+      break;
+    }
+
+    cpu_index = _Scheduler_priority_stealing_SMP_Get_CPU_index( scheduled );
+
+    if ( _Processor_mask_Is_set( &node->Affinity, cpu_index ) ) {
+      if ( lowest == NULL ) {
+        lowest = scheduled;
+      }
+
+      if ( cpu_index == filter_index ) {
+        lowest = scheduled;
+        break;
+      }
+    }
+
+    previous = _Chain_Previous( previous );
+  }
+
+  return lowest;
+}
+
+void _Scheduler_priority_stealing_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_priority_stealing_SMP_Extract_from_ready,
+    _Scheduler_priority_stealing_SMP_Get_highest_ready,
+    _Scheduler_priority_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static bool _Scheduler_priority_stealing_SMP_Enqueue(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_priority_stealing_SMP_Priority_less_equal,
+    _Scheduler_priority_stealing_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_priority_stealing_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_priority_stealing_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+static bool _Scheduler_priority_stealing_SMP_Enqueue_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue_scheduled(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_priority_stealing_SMP_Extract_from_ready,
+    _Scheduler_priority_stealing_SMP_Get_highest_ready,
+    _Scheduler_priority_stealing_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_priority_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+void _Scheduler_priority_stealing_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    node,
+    _Scheduler_priority_stealing_SMP_Do_update,
+    _Scheduler_priority_stealing_SMP_Enqueue
+  );
+}
+
+static bool _Scheduler_priority_stealing_SMP_Do_ask_for_help(
+  Scheduler_Context *context,
+  Thread_Control    *the_thread,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_SMP_Ask_for_help(
+    context,
+    the_thread,
+    node,
+    _Scheduler_priority_stealing_SMP_Priority_less_equal,
+    _Scheduler_priority_stealing_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_priority_stealing_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_priority_stealing_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+void _Scheduler_priority_stealing_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Update_priority(
+    context,
+    thread,
+    node,
+    _Scheduler_priority_stealing_SMP_Extract_from_ready,
+    _Scheduler_priority_stealing_SMP_Do_update,
+    _Scheduler_priority_stealing_SMP_Enqueue,
+    _Scheduler_priority_stealing_SMP_Enqueue_scheduled,
+    _Scheduler_priority_stealing_SMP_Do_ask_for_help
+  );
+}
+
+bool _Scheduler_priority_stealing_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_priority_stealing_SMP_Do_ask_for_help(
+    context,
+    the_thread,
+    node
+  );
+}
+
+void _Scheduler_priority_stealing_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Reconsider_help_request(
+    context,
+    the_thread,
+    node,
+    _Scheduler_priority_stealing_SMP_Extract_from_ready
+  );
+}
+
+void _Scheduler_priority_stealing_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Withdraw_node(
+    context,
+    the_thread,
+    node,
+    next_state,
+    _Scheduler_priority_stealing_SMP_Extract_from_ready,
+    _Scheduler_priority_stealing_SMP_Get_highest_ready,
+    _Scheduler_priority_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+}
+
+void _Scheduler_priority_stealing_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Add_processor(
+    context,
+    idle,
+    _Scheduler_priority_stealing_SMP_Has_ready,
+    _Scheduler_priority_stealing_SMP_Enqueue_scheduled,
+    _Scheduler_SMP_Do_nothing_register_idle
+  );
+}
+
+Thread_Control *_Scheduler_priority_stealing_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_SMP_Remove_processor(
+    context,
+    cpu,
+    _Scheduler_priority_stealing_SMP_Extract_from_ready,
+    _Scheduler_priority_stealing_SMP_Enqueue
+  );
+}
+
+void _Scheduler_priority_stealing_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    node,
+    _Scheduler_priority_stealing_SMP_Extract_from_ready,
+    _Scheduler_priority_stealing_SMP_Enqueue,
+    _Scheduler_priority_stealing_SMP_Enqueue_scheduled
+  );
+}
+
+static void _Scheduler_priority_stealing_SMP_Do_set_affinity(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  void              *arg
+)
+{
+  Scheduler_priority_stealing_SMP_Node *node;
+
+  (void) context;
+
+  node = _Scheduler_priority_stealing_SMP_Node_downcast( node_base );
+  _Processor_mask_Assign( &node->Affinity, arg );
+}
+
+bool _Scheduler_priority_stealing_SMP_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node_base,
+  const Processor_mask    *affinity
+)
+{
+  Scheduler_Context                    *context;
+  Scheduler_priority_stealing_SMP_Node *node;
+  Processor_mask                        local_affinity;
+
+  context = _Scheduler_Get_context( scheduler );
+  _Processor_mask_And( &local_affinity, &context->Processors, affinity );
+
+  if ( _Processor_mask_Is_zero( &local_affinity ) ) {
+    return false;
+  }
+
+  node = _Scheduler_priority_stealing_SMP_Node_downcast( node_base );
+
+  if ( _Processor_mask_Is_equal( &node->Affinity, affinity ) ) {
+    return true;
+  }
+
+  _Scheduler_SMP_Set_affinity(
+    context,
+    thread,
+    node_base,
+    RTEMS_DECONST( Processor_mask *, affinity ),
+    _Scheduler_priority_stealing_SMP_Do_set_affinity,
+    _Scheduler_priority_stealing_SMP_Extract_from_ready,
+    _Scheduler_priority_stealing_SMP_Get_highest_ready,
+    _Scheduler_priority_stealing_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_priority_stealing_SMP_Enqueue,
+    _Scheduler_SMP_Allocate_processor_exact
+  );
+
+  return true;
+}
@@ -27,6 +27,7 @@
 #include <rtems/score/schedulerstrongapa.h>
 #include <rtems/score/schedulerpriorityimpl.h>
 #include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/smpimpl.h>
 
 static Scheduler_strong_APA_Context *_Scheduler_strong_APA_Get_self(
   Scheduler_Context *context
@@ -41,6 +42,58 @@ _Scheduler_strong_APA_Node_downcast( Scheduler_Node *node )
   return (Scheduler_strong_APA_Node *) node;
 }
 
+static bool _Scheduler_strong_APA_Priority_less_equal(
+  const void       *to_insert,
+  const Chain_Node *next
+)
+{
+  return next != NULL
+    && _Scheduler_SMP_Priority_less_equal( to_insert, next );
+}
+
+static Scheduler_strong_APA_CPU *_Scheduler_strong_APA_Get_CPU(
+  Scheduler_strong_APA_Context *self,
+  const Per_CPU_Control        *cpu
+)
+{
+  return &self->CPU[ _Per_CPU_Get_index( cpu ) ];
+}
+
+/*
+ * Records for each processor owned by the scheduler instance the node
+ * currently scheduled on it.  The search functions use this snapshot to get
+ * from a processor to the affinity set of the node executing on it.
+ */
+static void _Scheduler_strong_APA_Take_snapshot(
+  Scheduler_strong_APA_Context *self
+)
+{
+  uint32_t          cpu_max;
+  uint32_t          cpu_index;
+  const Chain_Node *tail;
+  Chain_Node       *next;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    self->CPU[ cpu_index ].scheduled = NULL;
+  }
+
+  tail = _Chain_Immutable_tail( &self->Base.Scheduled );
+  next = _Chain_First( &self->Base.Scheduled );
+
+  while ( next != tail ) {
+    Scheduler_Node  *node;
+    Per_CPU_Control *cpu;
+
+    node = (Scheduler_Node *) next;
+    cpu = _Thread_Get_CPU( _Scheduler_Node_get_user( node ) );
+    _Scheduler_strong_APA_Get_CPU( self, cpu )->scheduled = node;
+
+    next = _Chain_Next( next );
+  }
+}
+
 static void _Scheduler_strong_APA_Move_from_scheduled_to_ready(
   Scheduler_Context *context,
   Scheduler_Node    *scheduled_to_ready
@@ -167,6 +220,17 @@ void _Scheduler_strong_APA_Initialize( const Scheduler_Control *scheduler )
     &self->Ready[ 0 ],
     scheduler->maximum_priority
   );
+
+  /*
+   * The size of a chain control is a multiple of the pointer size, so there
+   * is no padding between the ready chains and the processor search states.
+   */
+  RTEMS_STATIC_ASSERT(
+    sizeof( Chain_Control ) % sizeof( void * ) == 0,
+    SCHEDULER_STRONG_APA_CPU_ALIGNMENT
+  );
+  self->CPU = (Scheduler_strong_APA_CPU *)
+    &self->Ready[ scheduler->maximum_priority + 1 ];
 }
 
 void _Scheduler_strong_APA_Node_initialize(
@@ -196,6 +260,7 @@ void _Scheduler_strong_APA_Node_initialize(
     &self->Bit_map,
     &self->Ready[ 0 ]
   );
+  _Processor_mask_Assign( &the_node->Affinity, _SMP_Get_online_processors() );
 }
 
 static bool _Scheduler_strong_APA_Has_ready( Scheduler_Context *context )
@@ -206,20 +271,271 @@ static bool _Scheduler_strong_APA_Has_ready( Scheduler_Context *context )
   return !_Priority_bit_map_Is_empty( &self->Bit_map );
 }
 
+/*
+ * Returns the highest priority ready node which can be allocated to the
+ * processor of the filter node.  The breadth-first search starts at this
+ * processor and visits all processors whose scheduled node could move to an
+ * already visited processor.  The first ready node in priority order with an
+ * affinity to a visited processor is selected.  The path from the processor
+ * of the selected node back to the start processor is recorded in the source
+ * members for _Scheduler_strong_APA_Allocate_processor().
+ */
 static Scheduler_Node *_Scheduler_strong_APA_Get_highest_ready(
   Scheduler_Context *context,
-  Scheduler_Node    *node
+  Scheduler_Node    *filter
 )
 {
-  Scheduler_strong_APA_Context *self =
-    _Scheduler_strong_APA_Get_self( context );
-
-  (void) node;
+  Scheduler_strong_APA_Context *self;
+  Scheduler_strong_APA_CPU     *cpu_data;
+  uint32_t                      filter_index;
+  Processor_mask                visited;
+  uint32_t                      cpu_max;
+  uint32_t                      front;
+  uint32_t                      rear;
+  uint32_t                      major_bit_map;
 
-  return (Scheduler_Node *) _Scheduler_priority_Ready_queue_first(
-    &self->Bit_map,
-    &self->Ready[ 0 ]
+  self = _Scheduler_strong_APA_Get_self( context );
+  cpu_data = self->CPU;
+  cpu_max = _SMP_Get_processor_maximum();
+  filter_index = _Per_CPU_Get_index(
+    _Thread_Get_CPU( _Scheduler_Node_get_user( filter ) )
   );
+
+  _Scheduler_strong_APA_Take_snapshot( self );
+
+  _Processor_mask_Zero( &visited );
+  _Processor_mask_Set( &visited, filter_index );
+  cpu_data[ filter_index ].source = NULL;
+  cpu_data[ filter_index ].target = NULL;
+  cpu_data[ 0 ].queue = filter_index;
+  front = 0;
+  rear = 1;
+
+  while ( front < rear ) {
+    uint32_t front_index;
+    uint32_t cpu_index;
+
+    front_index = cpu_data[ front ].queue;
+    ++front;
+
+    for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+      Scheduler_strong_APA_Node *node;
+
+      node = _Scheduler_strong_APA_Node_downcast(
+        cpu_data[ cpu_index ].scheduled
+      );
+
+      if (
+        node != NULL
+          && !_Processor_mask_Is_set( &visited, cpu_index )
+          && _Processor_mask_Is_set( &node->Affinity, front_index )
+      ) {
+        _Processor_mask_Set( &visited, cpu_index );
+        cpu_data[ cpu_index ].target = _Per_CPU_Get_by_index( front_index );
+        cpu_data[ rear ].queue = cpu_index;
+        ++rear;
+      }
+    }
+  }
+
+  /*
+   * Walk through the non-empty ready chains in priority order.  The idle
+   * nodes have an affinity to all online processors, so the walk ends at the
+   * latest at the idle priority.
+   */
+  major_bit_map = self->Bit_map.major_bit_map;
+
+  while ( major_bit_map != 0 ) {
+    unsigned int major;
+    uint32_t     minor_bit_map;
+
+    major = _Bitfield_Find_first_bit( major_bit_map );
+    major_bit_map &= ~_Priority_Mask( major );
+    minor_bit_map = self->Bit_map.bit_map[ _Priority_Bits_index( major ) ];
+
+    while ( minor_bit_map != 0 ) {
+      unsigned int      minor;
+      Chain_Control    *ready_chain;
+      const Chain_Node *tail;
+      Chain_Node       *next;
+
+      minor = _Bitfield_Find_first_bit( minor_bit_map );
+      minor_bit_map &= ~_Priority_Mask( minor );
+      ready_chain = &self->Ready[
+        ( _Priority_Bits_index( major ) << 4 ) + _Priority_Bits_index( minor )
+      ];
+      tail = _Chain_Immutable_tail( ready_chain );
+      next = _Chain_First( ready_chain );
+
+      while ( next != tail ) {
+        Scheduler_strong_APA_Node *node;
+
+        node = (Scheduler_strong_APA_Node *) next;
+
+        if ( _Processor_mask_Has_overlap( &node->Affinity, &visited ) ) {
+          uint32_t         queue_index;
+          uint32_t         cpu_index;
+          Per_CPU_Control *target;
+
+          /* Use the visited processor closest to the start processor */
+          queue_index = 0;
+
+          while (
+            !_Processor_mask_Is_set(
+              &node->Affinity,
+              cpu_data[ queue_index ].queue
+            )
+          ) {
+            ++queue_index;
+          }
+
+          cpu_index = cpu_data[ queue_index ].queue;
+          cpu_data[ cpu_index ].source = NULL;
+          target = cpu_data[ cpu_index ].target;
+
+          while ( target != NULL ) {
+            Scheduler_strong_APA_CPU *target_data;
+
+            target_data = _Scheduler_strong_APA_Get_CPU( self, target );
+            target_data->source = _Per_CPU_Get_by_index( cpu_index );
+            cpu_index = _Per_CPU_Get_index( target );
+            target = target_data->target;
+          }
+
+          return &node->Base.Base;
+        }
+
+        next = _Chain_Next( next );
+      }
+    }
+  }
+
+  _Assert_Unreachable();
+  return NULL;
+}
+
+/*
+ * Returns the lowest priority scheduled node which can be replaced by the
+ * filter node.  The breadth-first search starts at the processors of the
+ * affinity set of the filter node and continues with the processors to which
+ * the nodes scheduled on visited processors could move.  The path from an
+ * affinity processor of the filter node to the processor of the returned node
+ * is recorded in the source members for
+ * _Scheduler_strong_APA_Allocate_processor().  In case no processor of the
+ * affinity set is owned by the scheduler instance, NULL is returned.
+ */
+static Scheduler_Node *_Scheduler_strong_APA_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_strong_APA_Context *self;
+  Scheduler_strong_APA_CPU     *cpu_data;
+  Scheduler_strong_APA_Node    *node;
+  Scheduler_Node               *lowest;
+  Priority_Control              lowest_priority;
+  Processor_mask                visited;
+  uint32_t                      cpu_max;
+  uint32_t                      cpu_index;
+  uint32_t                      front;
+  uint32_t                      rear;
+
+  self = _Scheduler_strong_APA_Get_self( context );
+  cpu_data = self->CPU;
+  cpu_max = _SMP_Get_processor_maximum();
+  node = _Scheduler_strong_APA_Node_downcast( filter );
+
+  _Scheduler_strong_APA_Take_snapshot( self );
+
+  _Processor_mask_Zero( &visited );
+  front = 0;
+  rear = 0;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+    if (
+      cpu_data[ cpu_index ].scheduled != NULL
+        && _Processor_mask_Is_set( &node->Affinity, cpu_index )
+    ) {
+      _Processor_mask_Set( &visited, cpu_index );
+      cpu_data[ cpu_index ].source = NULL;
+      cpu_data[ rear ].queue = cpu_index;
+      ++rear;
+    }
+  }
+
+  lowest = NULL;
+  lowest_priority = 0;
+
+  while ( front < rear ) {
+    uint32_t          front_index;
+    Scheduler_Node   *scheduled;
+    Priority_Control  priority;
+
+    front_index = cpu_data[ front ].queue;
+    ++front;
+
+    scheduled = cpu_data[ front_index ].scheduled;
+    priority = _Scheduler_SMP_Node_priority( scheduled );
+
+    if ( lowest == NULL || priority > lowest_priority ) {
+      lowest = scheduled;
+      lowest_priority = priority;
+    }
+
+    node = _Scheduler_strong_APA_Node_downcast( scheduled );
+
+    for ( cpu_index = 0 ; cpu_index < cpu_max ; ++cpu_index ) {
+      if (
+        cpu_data[ cpu_index ].scheduled != NULL
+          && !_Processor_mask_Is_set( &visited, cpu_index )
+          && _Processor_mask_Is_set( &node->Affinity, cpu_index )
+      ) {
+        _Processor_mask_Set( &visited, cpu_index );
+        cpu_data[ cpu_index ].source = _Per_CPU_Get_by_index( front_index );
+        cpu_data[ rear ].queue = cpu_index;
+        ++rear;
+      }
+    }
+  }
+
+  return lowest;
+}
+
+/*
+ * Allocates the victim processor along the path recorded by the last search.
+ * Each scheduled node on the path moves to the next processor of the path
+ * and the scheduled node is allocated to the first processor of the path.
+ */
+static void _Scheduler_strong_APA_Allocate_processor(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled,
+  Scheduler_Node    *victim,
+  Per_CPU_Control   *victim_cpu
+)
+{
+  Scheduler_strong_APA_Context *self;
+  Per_CPU_Control              *cpu;
+  Per_CPU_Control              *source;
+
+  self = _Scheduler_strong_APA_Get_self( context );
+  cpu = victim_cpu;
+  source = _Scheduler_strong_APA_Get_CPU( self, cpu )->source;
+
+  while ( source != NULL ) {
+    Scheduler_strong_APA_CPU *source_data;
+
+    source_data = _Scheduler_strong_APA_Get_CPU( self, source );
+    _Scheduler_SMP_Allocate_processor_exact(
+      context,
+      source_data->scheduled,
+      NULL,
+      cpu
+    );
+    cpu = source;
+    source = source_data->source;
+  }
+
+  _Scheduler_SMP_Allocate_processor_exact( context, scheduled, victim, cpu );
 }
 
 void _Scheduler_strong_APA_Block(
@@ -238,7 +554,7 @@ void _Scheduler_strong_APA_Block(
     _Scheduler_strong_APA_Extract_from_ready,
     _Scheduler_strong_APA_Get_highest_ready,
     _Scheduler_strong_APA_Move_from_ready_to_scheduled,
-    _Scheduler_SMP_Allocate_processor_exact
+    _Scheduler_strong_APA_Allocate_processor
   );
 }
 
@@ -252,12 +568,12 @@ static bool _Scheduler_strong_APA_Enqueue(
     context,
     node,
     insert_priority,
-    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_strong_APA_Priority_less_equal,
     _Scheduler_strong_APA_Insert_ready,
     _Scheduler_SMP_Insert_scheduled,
     _Scheduler_strong_APA_Move_from_scheduled_to_ready,
-    _Scheduler_SMP_Get_lowest_scheduled,
-    _Scheduler_SMP_Allocate_processor_exact
+    _Scheduler_strong_APA_Get_lowest_scheduled,
+    _Scheduler_strong_APA_Allocate_processor
   );
 }
 
@@ -277,7 +593,7 @@ static bool _Scheduler_strong_APA_Enqueue_scheduled(
     _Scheduler_strong_APA_Insert_ready,
     _Scheduler_SMP_Insert_scheduled,
     _Scheduler_strong_APA_Move_from_ready_to_scheduled,
-    _Scheduler_SMP_Allocate_processor_exact
+    _Scheduler_strong_APA_Allocate_processor
   );
 }
 
@@ -308,12 +624,12 @@ static bool _Scheduler_strong_APA_Do_ask_for_help(
     context,
     the_thread,
     node,
-    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_strong_APA_Priority_less_equal,
     _Scheduler_strong_APA_Insert_ready,
     _Scheduler_SMP_Insert_scheduled,
     _Scheduler_strong_APA_Move_from_scheduled_to_ready,
-    _Scheduler_SMP_Get_lowest_scheduled,
-    _Scheduler_SMP_Allocate_processor_lazy
+    _Scheduler_strong_APA_Get_lowest_scheduled,
+    _Scheduler_strong_APA_Allocate_processor
   );
 }
 
@@ -381,7 +697,7 @@ void _Scheduler_strong_APA_Withdraw_node(
     _Scheduler_strong_APA_Extract_from_ready,
     _Scheduler_strong_APA_Get_highest_ready,
     _Scheduler_strong_APA_Move_from_ready_to_scheduled,
-    _Scheduler_SMP_Allocate_processor_lazy
+    _Scheduler_strong_APA_Allocate_processor
   );
 }
 
@@ -433,3 +749,57 @@ void _Scheduler_strong_APA_Yield(
     _Scheduler_strong_APA_Enqueue_scheduled
   );
 }
+
+static void _Scheduler_strong_APA_Do_set_affinity(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  void              *arg
+)
+{
+  Scheduler_strong_APA_Node *node;
+
+  (void) context;
+
+  node = _Scheduler_strong_APA_Node_downcast( node_base );
+  _Processor_mask_Assign( &node->Affinity, arg );
+}
+
+bool _Scheduler_strong_APA_Set_affinity(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node_base,
+  const Processor_mask    *affinity
+)
+{
+  Scheduler_Context         *context;
+  Scheduler_strong_APA_Node *node;
+  Processor_mask             local_affinity;
+
+  context = _Scheduler_Get_context( scheduler );
+  _Processor_mask_And( &local_affinity, &context->Processors, affinity );
+
+  if ( _Processor_mask_Is_zero( &local_affinity ) ) {
+    return false;
+  }
+
+  node = _Scheduler_strong_APA_Node_downcast( node_base );
+
+  if ( _Processor_mask_Is_equal( &node->Affinity, affinity ) ) {
+    return true;
+  }
+
+  _Scheduler_SMP_Set_affinity(
+    context,
+    thread,
+    node_base,
+    RTEMS_DECONST( Processor_mask *, affinity ),
+    _Scheduler_strong_APA_Do_set_affinity,
+    _Scheduler_strong_APA_Extract_from_ready,
+    _Scheduler_strong_APA_Get_highest_ready,
+    _Scheduler_strong_APA_Move_from_ready_to_scheduled,
+    _Scheduler_strong_APA_Enqueue,
+    _Scheduler_strong_APA_Allocate_processor
+  );
+
+  return true;
+}
@@ -384,8 +384,11 @@ void _Thread_queue_Enqueue(
   Thread_queue_Context          *queue_context
 )
 {
-  Per_CPU_Control *cpu_self;
-  bool             success;
+  Per_CPU_Control           *cpu_self;
+  bool                       success;
+#if defined(RTEMS_PROFILING)
+  Thread_queue_Stats_sample  stats_sample;
+#endif
 
   _Assert( queue_context->enqueue_callout != NULL );
 
@@ -415,6 +418,9 @@ void _Thread_queue_Enqueue(
 
   the_thread->Wait.return_code = STATUS_SUCCESSFUL;
   _Thread_Wait_flags_set( the_thread, THREAD_QUEUE_INTEND_TO_BLOCK );
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_begin( &stats_sample, queue, the_thread );
+#endif
   cpu_self = _Thread_queue_Dispatch_disable( queue_context );
   _Thread_queue_Queue_release( queue, &queue_context->Lock_context.Lock_context );
 
@@ -450,6 +456,10 @@ void _Thread_queue_Enqueue(
 
   _Thread_Priority_update( queue_context );
   _Thread_Dispatch_direct( cpu_self );
+
+#if defined(RTEMS_PROFILING)
+  _Thread_queue_Stats_end( &stats_sample );
+#endif
 }
 
 #if defined(RTEMS_SMP)
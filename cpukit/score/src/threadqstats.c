@@ -0,0 +1,180 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreThreadQueue
+ *
+ * @brief Thread Queue Contention Statistics
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/threadqimpl.h>
+
+#if defined(RTEMS_PROFILING)
+
+#include <rtems/score/assert.h>
+#include <rtems/score/timecounter.h>
+#include <rtems/score/timespec.h>
+
+static Thread_queue_Stats _Thread_queue_Stats_table[ THREAD_QUEUE_STATS_COUNT ];
+
+ISR_LOCK_DEFINE( static, _Thread_queue_Stats_lock, "Thread Queue Stats" )
+
+static uint64_t _Thread_queue_Stats_uptime( void )
+{
+  struct timespec now;
+
+  _Timecounter_Nanouptime( &now );
+  return _Timespec_Get_as_nanoseconds( &now );
+}
+
+static Thread_queue_Stats *_Thread_queue_Stats_find(
+  const Thread_queue_Queue *queue
+)
+{
+  size_t index;
+  size_t i;
+
+  index = ( (uintptr_t) queue / sizeof( *queue ) ) % THREAD_QUEUE_STATS_COUNT;
+
+  /*
+   * Use open addressing with linear probing.  Entries are never removed, so an
+   * unused entry terminates the search.
+   */
+  for ( i = 0; i < THREAD_QUEUE_STATS_COUNT; ++i ) {
+    Thread_queue_Stats *stats;
+
+    stats = &_Thread_queue_Stats_table[ index ];
+
+    if ( stats->queue == queue ) {
+      return stats;
+    }
+
+    if ( stats->queue == NULL ) {
+      stats->queue = queue;
+      return stats;
+    }
+
+    index = ( index + 1 ) % THREAD_QUEUE_STATS_COUNT;
+  }
+
+  return NULL;
+}
+
+void _Thread_queue_Stats_begin(
+  Thread_queue_Stats_sample *sample,
+  const Thread_queue_Queue  *queue,
+  const Thread_Control      *the_thread
+)
+{
+  const Thread_Control *owner;
+
+  if ( the_thread != _Thread_Get_executing() ) {
+    sample->queue = NULL;
+    return;
+  }
+
+  sample->queue = queue;
+
+  if ( queue->name == _Thread_queue_Object_name ) {
+    sample->id = THREAD_QUEUE_QUEUE_TO_OBJECT( queue )->Object.id;
+    sample->name = NULL;
+  } else {
+    sample->id = 0;
+    sample->name = queue->name;
+  }
+
+  owner = queue->owner;
+  sample->owner = owner != NULL ? owner->Object.id : 0;
+  sample->begin = _Thread_queue_Stats_uptime();
+}
+
+void _Thread_queue_Stats_end( const Thread_queue_Stats_sample *sample )
+{
+  Thread_queue_Stats *stats;
+  uint64_t            wait_time;
+  ISR_lock_Context    lock_context;
+
+  if ( sample->queue == NULL ) {
+    return;
+  }
+
+  wait_time = _Thread_queue_Stats_uptime() - sample->begin;
+
+  _ISR_lock_ISR_disable_and_acquire( &_Thread_queue_Stats_lock, &lock_context );
+
+  stats = _Thread_queue_Stats_find( sample->queue );
+
+  if ( stats != NULL ) {
+    /*
+     * The storage of a deleted object may be re-used by a new object.  Do not
+     * mix the statistics of both objects.
+     */
+    if ( stats->id != sample->id || stats->name != sample->name ) {
+      stats->id = sample->id;
+      stats->name = sample->name;
+      stats->max_wait_owner = 0;
+      stats->block_count = 0;
+      stats->max_wait_time = 0;
+      stats->total_wait_time = 0;
+    }
+
+    ++stats->block_count;
+    stats->total_wait_time += wait_time;
+
+    if ( wait_time >= stats->max_wait_time ) {
+      stats->max_wait_time = wait_time;
+      stats->max_wait_owner = sample->owner;
+    }
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &_Thread_queue_Stats_lock, &lock_context );
+}
+
+bool _Thread_queue_Stats_get( size_t index, Thread_queue_Stats *snapshot )
+{
+  const Thread_queue_Stats *stats;
+  ISR_lock_Context          lock_context;
+  bool                      used;
+
+  _Assert( index < THREAD_QUEUE_STATS_COUNT );
+  stats = &_Thread_queue_Stats_table[ index ];
+
+  _ISR_lock_ISR_disable_and_acquire( &_Thread_queue_Stats_lock, &lock_context );
+  *snapshot = *stats;
+  used = stats->queue != NULL && stats->block_count != 0;
+  _ISR_lock_Release_and_ISR_enable( &_Thread_queue_Stats_lock, &lock_context );
+
+  return used;
+}
+
+#endif /* RTEMS_PROFILING */
@@ -37,6 +37,13 @@ void _Watchdog_Insert(
   RBTree_Node  *old_first;
   RBTree_Node  *new_first;
 
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_insert( header, the_watchdog, expire );
+    return;
+  }
+#endif
+
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
   link = _RBTree_Root_reference( &header->Watchdogs );
@@ -0,0 +1,122 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief Watchdog Ticks Until Next Expiry
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/timecounter.h>
+
+static uint64_t _Watchdog_Ticks_until_clock_expiry(
+  const Watchdog_Header *header,
+  const struct timespec *now,
+  uint64_t               ticks
+)
+{
+  const Watchdog_Control *first;
+  uint64_t                expire;
+  uint64_t                current;
+  uint64_t                delta;
+
+  first = _Watchdog_Header_first( header );
+
+  if ( first == NULL ) {
+    return ticks;
+  }
+
+  expire = _Watchdog_Nanoseconds_from_ticks( first->expire );
+  current = _Watchdog_Nanoseconds_from_ticks(
+    _Watchdog_Ticks_from_timespec( now )
+  );
+
+  if ( expire <= current ) {
+    return 1;
+  }
+
+  delta = expire - current;
+  delta = ( delta + _Watchdog_Nanoseconds_per_tick - 1 )
+    / _Watchdog_Nanoseconds_per_tick;
+
+  return delta < ticks ? delta : ticks;
+}
+
+uint64_t _Watchdog_Ticks_until_next_expiry( const Per_CPU_Control *cpu )
+{
+  const Watchdog_Header  *header;
+  const Watchdog_Control *first;
+  uint64_t                expire;
+  uint64_t                ticks;
+  struct timespec         now;
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    expire = first->expire;
+  } else {
+    expire = WATCHDOG_MAXIMUM_TICKS;
+  }
+
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  if ( header->wheel != NULL ) {
+    expire = _Watchdog_Wheel_First_expire( header );
+  }
+#endif
+
+  if ( expire == WATCHDOG_MAXIMUM_TICKS ) {
+    ticks = WATCHDOG_MAXIMUM_TICKS;
+  } else if ( expire > cpu->Watchdog.ticks ) {
+    ticks = expire - cpu->Watchdog.ticks;
+  } else {
+    ticks = 1;
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+
+  if ( _Watchdog_Header_first( header ) != NULL ) {
+    _Timecounter_Getnanouptime( &now );
+    ticks = _Watchdog_Ticks_until_clock_expiry( header, &now, ticks );
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
+
+  if ( _Watchdog_Header_first( header ) != NULL ) {
+    _Timecounter_Getnanotime( &now );
+    ticks = _Watchdog_Ticks_until_clock_expiry( header, &now, ticks );
+  }
+
+  return ticks;
+}
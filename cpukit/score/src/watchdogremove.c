@@ -25,12 +25,22 @@
 #endif
 
 #include <rtems/score/watchdogimpl.h>
+#include <rtems/score/chainimpl.h>
 
 void _Watchdog_Remove(
   Watchdog_Header  *header,
   Watchdog_Control *the_watchdog
 )
 {
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  if ( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_SCHEDULED_WHEEL ) {
+    _Assert( header->wheel != NULL );
+    _Chain_Extract_unprotected( &the_watchdog->Node.Chain );
+    _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+    return;
+  }
+#endif
+
   if ( _Watchdog_Is_scheduled( the_watchdog ) ) {
     if ( header->first == &the_watchdog->Node.RBTree ) {
       _Watchdog_Next_first( header, the_watchdog );
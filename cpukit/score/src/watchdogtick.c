@@ -51,7 +51,7 @@ void _Watchdog_Do_tickle(
   } while ( first != NULL );
 }
 
-void _Watchdog_Tick( Per_CPU_Control *cpu )
+static void _Watchdog_Do_tick( Per_CPU_Control *cpu, uint32_t count )
 {
   ISR_lock_Context  lock_context;
   Watchdog_Header  *header;
@@ -60,17 +60,29 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   struct timespec   now;
 
   if ( _Per_CPU_Is_boot_processor( cpu ) ) {
-    ++_Watchdog_Ticks_since_boot;
+    _Watchdog_Ticks_since_boot += count;
   }
 
   _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
 
   ticks = cpu->Watchdog.ticks;
-  _Assert( ticks < UINT64_MAX );
-  ++ticks;
+  _Assert( ticks <= UINT64_MAX - count );
+  ticks += count;
   cpu->Watchdog.ticks = ticks;
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  if ( header->wheel != NULL ) {
+    _Watchdog_Tickle_wheel(
+      header,
+      ticks,
+      &cpu->Watchdog.Lock,
+      &lock_context
+    );
+  }
+#endif
+
   first = _Watchdog_Header_first( header );
 
   if ( first != NULL ) {
@@ -95,6 +107,10 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
       &cpu->Watchdog.Lock,
       &lock_context
     );
+
+    if ( _Watchdog_High_resolution_arm_handler != NULL ) {
+      _Watchdog_High_resolution_update( cpu );
+    }
   }
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
@@ -112,6 +128,16 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   }
 
   _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
 
+void _Watchdog_Tick( Per_CPU_Control *cpu )
+{
+  _Watchdog_Do_tick( cpu, 1 );
   _Scheduler_Tick( cpu );
 }
+
+void _Watchdog_Tick_catch_up( Per_CPU_Control *cpu, uint32_t ticks )
+{
+  _Assert( ticks > 0 );
+  _Watchdog_Do_tick( cpu, ticks );
+}
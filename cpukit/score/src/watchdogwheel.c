@@ -0,0 +1,296 @@
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief Watchdog Timing Wheel
+ */
+
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+
+#if defined(RTEMS_WATCHDOG_WHEEL)
+
+#include <rtems/score/chainimpl.h>
+#include <rtems/score/smp.h>
+
+#define WATCHDOG_WHEEL_SLOT_MASK ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+
+static Chain_Control *_Watchdog_Wheel_Get_slot(
+  Watchdog_Wheel *wheel,
+  uint64_t        expire
+)
+{
+  uint64_t delta;
+  int      level;
+
+  delta = expire - wheel->next;
+
+  for ( level = 0 ; level < WATCHDOG_WHEEL_LEVEL_COUNT ; ++level ) {
+    int shift;
+
+    shift = level * WATCHDOG_WHEEL_SLOT_BITS;
+
+    if ( ( delta >> ( shift + WATCHDOG_WHEEL_SLOT_BITS ) ) == 0 ) {
+      return &wheel->Slots[ level ][
+        ( expire >> shift ) & WATCHDOG_WHEEL_SLOT_MASK
+      ];
+    }
+  }
+
+  return &wheel->Overflow;
+}
+
+static void _Watchdog_Wheel_Enqueue(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  uint64_t expire;
+
+  expire = the_watchdog->expire;
+
+  /*
+   * Watchdogs which expired already are placed into the slot of the next tick
+   * to process.
+   */
+  if ( expire < wheel->next ) {
+    expire = wheel->next;
+  }
+
+  _Chain_Append_unprotected(
+    _Watchdog_Wheel_Get_slot( wheel, expire ),
+    &the_watchdog->Node.Chain
+  );
+}
+
+static void _Watchdog_Wheel_Move(
+  Chain_Control *from,
+  Chain_Control *to
+)
+{
+  if ( _Chain_Is_empty( from ) ) {
+    _Chain_Initialize_empty( to );
+  } else {
+    Chain_Node *first;
+    Chain_Node *last;
+
+    first = _Chain_First( from );
+    last = _Chain_Last( from );
+    _Chain_Head( to )->next = first;
+    _Chain_Head( to )->previous = NULL;
+    first->previous = _Chain_Head( to );
+    _Chain_Tail( to )->previous = last;
+    last->next = _Chain_Tail( to );
+    _Chain_Initialize_empty( from );
+  }
+}
+
+static void _Watchdog_Wheel_Cascade(
+  Watchdog_Wheel *wheel,
+  Chain_Control  *slot
+)
+{
+  Chain_Control  pending;
+  Chain_Node    *node;
+
+  _Watchdog_Wheel_Move( slot, &pending );
+
+  while ( ( node = _Chain_Get_unprotected( &pending ) ) != NULL ) {
+    _Watchdog_Wheel_Enqueue( wheel, (Watchdog_Control *) node );
+  }
+}
+
+void _Watchdog_Wheel_initialize(
+  Watchdog_Header *header,
+  Watchdog_Wheel  *wheel,
+  uint64_t         now
+)
+{
+  int level;
+  int index;
+
+  _Watchdog_Header_initialize( header );
+  header->wheel = wheel;
+
+  for ( level = 0 ; level < WATCHDOG_WHEEL_LEVEL_COUNT ; ++level ) {
+    for ( index = 0 ; index < WATCHDOG_WHEEL_SLOT_COUNT ; ++index ) {
+      _Chain_Initialize_empty( &wheel->Slots[ level ][ index ] );
+    }
+  }
+
+  _Chain_Initialize_empty( &wheel->Overflow );
+  wheel->next = now + 1;
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Header  *header,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
+
+  the_watchdog->expire = expire;
+  _Watchdog_Wheel_Enqueue( header->wheel, the_watchdog );
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_WHEEL );
+}
+
+uint64_t _Watchdog_Wheel_First_expire( const Watchdog_Header *header )
+{
+  const Watchdog_Wheel *wheel;
+  uint64_t              tick;
+  uint64_t              end;
+  int                   level;
+  int                   index;
+
+  wheel = header->wheel;
+  tick = wheel->next;
+  end = ( tick | WATCHDOG_WHEEL_SLOT_MASK ) + 1;
+
+  /*
+   * The level zero slots up to the next cascade contain only watchdogs which
+   * expire exactly at the corresponding tick.
+   */
+  while ( tick < end ) {
+    const Chain_Control *slot;
+
+    slot = &wheel->Slots[ 0 ][ tick & WATCHDOG_WHEEL_SLOT_MASK ];
+
+    if ( !_Chain_Is_empty( slot ) ) {
+      return tick;
+    }
+
+    ++tick;
+  }
+
+  /*
+   * All other watchdogs expire at or after the next cascade.
+   */
+  for ( level = 0 ; level < WATCHDOG_WHEEL_LEVEL_COUNT ; ++level ) {
+    for ( index = 0 ; index < WATCHDOG_WHEEL_SLOT_COUNT ; ++index ) {
+      if ( !_Chain_Is_empty( &wheel->Slots[ level ][ index ] ) ) {
+        return end;
+      }
+    }
+  }
+
+  if ( !_Chain_Is_empty( &wheel->Overflow ) ) {
+    return end;
+  }
+
+  return WATCHDOG_MAXIMUM_TICKS;
+}
+
+void _Watchdog_Do_tickle_wheel(
+  Watchdog_Header  *header,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  Watchdog_Wheel *wheel;
+
+  wheel = header->wheel;
+
+  while ( wheel->next <= now ) {
+    Chain_Control  expired;
+    Chain_Node    *node;
+    uint64_t       tick;
+    uint64_t       index;
+    int            level;
+
+    tick = wheel->next;
+    index = tick & WATCHDOG_WHEEL_SLOT_MASK;
+    level = 0;
+
+    /*
+     * Cascade the higher levels from the bottom up each time the index of the
+     * level below wraps around.  The entries are redistributed relative to
+     * the current tick, so they end up in slots which are not yet processed.
+     */
+    while ( index == 0 && level < WATCHDOG_WHEEL_LEVEL_COUNT - 1 ) {
+      ++level;
+      index = ( tick >> ( level * WATCHDOG_WHEEL_SLOT_BITS ) )
+        & WATCHDOG_WHEEL_SLOT_MASK;
+      _Watchdog_Wheel_Cascade( wheel, &wheel->Slots[ level ][ index ] );
+    }
+
+    if ( index == 0 && level == WATCHDOG_WHEEL_LEVEL_COUNT - 1 ) {
+      _Watchdog_Wheel_Cascade( wheel, &wheel->Overflow );
+    }
+
+    _Watchdog_Wheel_Move(
+      &wheel->Slots[ 0 ][ tick & WATCHDOG_WHEEL_SLOT_MASK ],
+      &expired
+    );
+    wheel->next = tick + 1;
+
+    while ( ( node = _Chain_Get_unprotected( &expired ) ) != NULL ) {
+      Watchdog_Control               *the_watchdog;
+      Watchdog_Service_routine_entry  routine;
+
+      the_watchdog = (Watchdog_Control *) node;
+      _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+      routine = the_watchdog->routine;
+
+      _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+      ( *routine )( the_watchdog );
+      _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+    }
+  }
+}
+
+void _Watchdog_Handler_initialization( void )
+{
+  uint32_t cpu_index;
+
+  for (
+    cpu_index = 0 ;
+    cpu_index < _SMP_Processor_configured_maximum ;
+    ++cpu_index
+  ) {
+    Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    _Watchdog_Wheel_initialize(
+      &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
+      &_Watchdog_Wheels[ cpu_index ],
+      cpu->Watchdog.ticks
+    );
+  }
+}
+
+#endif /* RTEMS_WATCHDOG_WHEEL */
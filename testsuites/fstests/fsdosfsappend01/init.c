@@ -0,0 +1,308 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/dosfs.h>
+#include <rtems/libio.h>
+#include <rtems/sparse-disk.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "FSDOSFSAPPEND 1";
+
+#define DEV_NAME "/dev/sda"
+
+#define MOUNT_DIR "/mnt"
+
+#define FILLER_FILE MOUNT_DIR "/filler"
+
+#define APPEND_FILE MOUNT_DIR "/append"
+
+#define SECTOR_SIZE 512
+
+#define SECTORS_PER_CLUSTER 4
+
+#define CLUSTER_SIZE (SECTOR_SIZE * SECTORS_PER_CLUSTER)
+
+/* A 64 MiB disk */
+#define DISK_SECTORS (128 * 1024)
+
+/*
+ * The file content is all zero and the sparse disk fill pattern is zero, so
+ * only the file system meta data needs sparse disk blocks.
+ */
+#define DISK_SECTORS_WITH_BUFFER 1024
+
+#define WRITE_SIZE (2 * CLUSTER_SIZE)
+
+#define APPEND_SIZE (256 * 1024)
+
+typedef struct {
+  uint8_t buf[WRITE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static void mount_disk(bool free_cluster_map)
+{
+  rtems_dosfs_mount_options mount_options;
+  int rv;
+
+  memset(&mount_options, 0, sizeof(mount_options));
+  mount_options.free_cluster_map = free_cluster_map;
+
+  rv = mount(
+    DEV_NAME,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_options
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void format_disk(void)
+{
+  static const msdos_format_request_param_t rqdata = {
+    .sectors_per_cluster = SECTORS_PER_CLUSTER,
+    .quick_format = true
+  };
+  int rv;
+
+  rv = msdos_format(DEV_NAME, &rqdata);
+  rtems_test_assert(rv == 0);
+}
+
+static void write_file(test_context *ctx, const char *path, off_t size)
+{
+  int fd;
+  int rv;
+
+  fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  while (size > 0) {
+    size_t chunk = sizeof(ctx->buf);
+    ssize_t n;
+
+    if ((off_t) chunk > size) {
+      chunk = (size_t) size;
+    }
+
+    n = write(fd, ctx->buf, chunk);
+    rtems_test_assert(n == (ssize_t) chunk);
+    size -= (off_t) chunk;
+  }
+
+  rv = fsync(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static uint64_t elapsed_ns(rtems_counter_ticks t0)
+{
+  rtems_counter_ticks d;
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  return rtems_counter_ticks_to_nanoseconds(d);
+}
+
+static fsblkcnt_t free_clusters(void)
+{
+  struct statvfs sv;
+  int rv;
+
+  rv = statvfs(MOUNT_DIR, &sv);
+  rtems_test_assert(rv == 0);
+
+  return sv.f_bfree;
+}
+
+static fsblkcnt_t append(
+  test_context *ctx,
+  const char *path,
+  bool free_cluster_map
+)
+{
+  rtems_counter_ticks t0;
+  uint64_t statvfs_ns;
+  uint64_t append_ns;
+  fsblkcnt_t before;
+  fsblkcnt_t after;
+  int rv;
+
+  /*
+   * Mount again to start with the state of a volume which was filled by
+   * another system.
+   */
+  mount_disk(free_cluster_map);
+
+  t0 = rtems_counter_read();
+  before = free_clusters();
+  statvfs_ns = elapsed_ns(t0);
+
+  t0 = rtems_counter_read();
+  write_file(ctx, path, APPEND_SIZE);
+  append_ns = elapsed_ns(t0);
+
+  if (append_ns == 0) {
+    append_ns = 1;
+  }
+
+  after = free_clusters();
+  rtems_test_assert(before - after == APPEND_SIZE / CLUSTER_SIZE);
+
+  printf(
+    "    <Append freeClusterMap=\"%s\">\n"
+    "      <FreeClusters>%lu</FreeClusters>\n"
+    "      <StatvfsDuration unit=\"ns\">%" PRIu64 "</StatvfsDuration>\n"
+    "      <AppendDuration unit=\"ns\">%" PRIu64 "</AppendDuration>\n"
+    "      <AppendBytesPerSecond>%" PRIu64 "</AppendBytesPerSecond>\n"
+    "    </Append>\n",
+    free_cluster_map ? "true" : "false",
+    (unsigned long) before,
+    statvfs_ns,
+    append_ns,
+    (uint64_t) APPEND_SIZE * 1000000000 / append_ns
+  );
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+
+  return before;
+}
+
+static void test_fill_level(test_context *ctx, int percent)
+{
+  struct statvfs sv;
+  fsblkcnt_t without_map;
+  fsblkcnt_t with_map;
+  off_t filler_size;
+  int rv;
+
+  format_disk();
+  mount_disk(false);
+
+  rv = statvfs(MOUNT_DIR, &sv);
+  rtems_test_assert(rv == 0);
+
+  filler_size = (off_t) sv.f_blocks * percent / 100 * sv.f_frsize;
+  write_file(ctx, FILLER_FILE, filler_size);
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+
+  printf("  <Fill percent=\"%i\">\n", percent);
+  without_map = append(ctx, APPEND_FILE "-0", false);
+  with_map = append(ctx, APPEND_FILE "-1", true);
+  printf("  </Fill>\n");
+
+  rtems_test_assert(without_map - with_map == APPEND_SIZE / CLUSTER_SIZE);
+}
+
+static void test(void)
+{
+  static const int fill_levels[] = { 10, 50, 95 };
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  size_t i;
+  int rv;
+
+  rv = mkdir(MOUNT_DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  sc = rtems_sparse_disk_create_and_register(
+    DEV_NAME,
+    SECTOR_SIZE,
+    DISK_SECTORS_WITH_BUFFER,
+    DISK_SECTORS,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "<FSDOSFSAppend01 clusterSize=\"%i\" appendSize=\"%i\">\n",
+    CLUSTER_SIZE,
+    APPEND_SIZE
+  );
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(fill_levels); ++i) {
+    test_fill_level(ctx, fill_levels[i]);
+  }
+
+  printf("</FSDOSFSAppend01>\n");
+
+  rv = unlink(DEV_NAME);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_UNLIMITED_OBJECTS
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
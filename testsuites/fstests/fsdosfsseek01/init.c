@@ -0,0 +1,291 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/dosfs.h>
+#include <rtems/libio.h>
+#include <rtems/sparse-disk.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "FSDOSFSSEEK 1";
+
+#define DEV_NAME "/dev/sda"
+
+#define MOUNT_DIR "/mnt"
+
+#define SECTOR_SIZE 512
+
+#define SECTORS_PER_CLUSTER 1
+
+#define CLUSTER_SIZE (SECTOR_SIZE * SECTORS_PER_CLUSTER)
+
+#define FILE_CLUSTERS 1024
+
+#define DISK_SECTORS (3 * FILE_CLUSTERS * SECTORS_PER_CLUSTER)
+
+#define SEEK_COUNT 512
+
+typedef struct {
+  uint8_t buf[CLUSTER_SIZE];
+  uint32_t random;
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->random = ctx->random * 1664525 + 1013904223;
+  return ctx->random >> 8;
+}
+
+static void format_and_mount(void)
+{
+  static const msdos_format_request_param_t rqdata = {
+    .sectors_per_cluster = SECTORS_PER_CLUSTER,
+    .quick_format = true
+  };
+  int rv;
+
+  rv = msdos_format(DEV_NAME, &rqdata);
+  rtems_test_assert(rv == 0);
+
+  rv = mount(
+    DEV_NAME,
+    MOUNT_DIR,
+    RTEMS_FILESYSTEM_TYPE_DOSFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static int create_file(const char *path)
+{
+  int fd;
+
+  fd = open(path, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(fd >= 0);
+
+  return fd;
+}
+
+/*
+ * Append clusters to the file.  In fragmented mode, a second file gets a
+ * cluster after each cluster of the file, so that the cluster chain of the
+ * file consists of extents of one cluster each.
+ */
+static void fill_file(test_context *ctx, int fd, int other_fd)
+{
+  uint32_t i;
+
+  for (i = 0; i < FILE_CLUSTERS; ++i) {
+    ssize_t n;
+
+    memset(ctx->buf, (int) i, sizeof(ctx->buf));
+    n = write(fd, ctx->buf, sizeof(ctx->buf));
+    rtems_test_assert(n == (ssize_t) sizeof(ctx->buf));
+
+    if (other_fd >= 0) {
+      n = write(other_fd, ctx->buf, sizeof(ctx->buf));
+      rtems_test_assert(n == (ssize_t) sizeof(ctx->buf));
+    }
+  }
+}
+
+static void random_read(test_context *ctx, const char *path, int pass)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  uint64_t ns;
+  int fd;
+  int rv;
+  uint32_t i;
+
+  fd = open(path, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  ctx->random = 0x12345678;
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < SEEK_COUNT; ++i) {
+    uint32_t cln;
+    off_t off;
+    ssize_t n;
+
+    cln = next_random(ctx) % FILE_CLUSTERS;
+    off = lseek(fd, (off_t) cln * CLUSTER_SIZE, SEEK_SET);
+    rtems_test_assert(off == (off_t) cln * CLUSTER_SIZE);
+
+    n = read(fd, ctx->buf, 1);
+    rtems_test_assert(n == 1);
+    rtems_test_assert(ctx->buf[0] == (uint8_t) cln);
+  }
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  ns = rtems_counter_ticks_to_nanoseconds(d);
+
+  printf(
+    "    <RandomRead pass=\"%i\">\n"
+    "      <Count>%i</Count>\n"
+    "      <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "      <NsPerSeek>%" PRIu64 "</NsPerSeek>\n"
+    "    </RandomRead>\n",
+    pass,
+    SEEK_COUNT,
+    ns,
+    ns / SEEK_COUNT
+  );
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_layout(test_context *ctx, bool fragmented)
+{
+  static const char file[] = MOUNT_DIR "/file";
+  static const char other[] = MOUNT_DIR "/other";
+  int fd;
+  int other_fd;
+  int rv;
+  int pass;
+
+  format_and_mount();
+
+  fd = create_file(file);
+
+  if (fragmented) {
+    other_fd = create_file(other);
+  } else {
+    other_fd = -1;
+  }
+
+  fill_file(ctx, fd, other_fd);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  if (other_fd >= 0) {
+    rv = close(other_fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  printf(
+    "  <Layout fragmented=\"%s\">\n",
+    fragmented ? "true" : "false"
+  );
+
+  /*
+   * The first pass includes the set up of the extent map of the file, the
+   * second pass reuses it.
+   */
+  for (pass = 0; pass < 2; ++pass) {
+    random_read(ctx, file, pass);
+  }
+
+  printf("  </Layout>\n");
+
+  rv = unmount(MOUNT_DIR);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  int rv;
+
+  rv = mkdir(MOUNT_DIR, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  sc = rtems_sparse_disk_create_and_register(
+    DEV_NAME,
+    SECTOR_SIZE,
+    DISK_SECTORS,
+    DISK_SECTORS,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf(
+    "<FSDOSFSSeek01 clusterSize=\"%i\" fileClusters=\"%i\">\n",
+    CLUSTER_SIZE,
+    FILE_CLUSTERS
+  );
+
+  test_layout(ctx, false);
+  test_layout(ctx, true);
+
+  printf("</FSDOSFSSeek01>\n");
+
+  rv = unlink(DEV_NAME);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_FILESYSTEM_DOSFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_UNLIMITED_OBJECTS
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,190 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+#ifndef TEST_NAME
+#define TEST_NAME "1"
+#define TEST_INDEX "Linear"
+#endif
+
+const char rtems_test_name[] = "FSIMFSDIR " TEST_NAME;
+
+#define DIR_PATH "/dir"
+
+#define ENTRY_COUNT 10000
+
+#define PATH_SIZE 32
+
+typedef enum {
+  OP_CREATE,
+  OP_LOOKUP,
+  OP_UNLINK
+} test_op;
+
+static void make_path(char *path, int i)
+{
+  int n;
+
+  n = snprintf(path, PATH_SIZE, DIR_PATH "/entry-%i", i);
+  rtems_test_assert(n > 0 && n < PATH_SIZE);
+}
+
+static void do_op(test_op op, int i)
+{
+  char path[PATH_SIZE];
+  struct stat st;
+  int rv;
+
+  make_path(path, i);
+
+  switch (op) {
+    case OP_CREATE:
+      rv = mknod(path, S_IFREG | S_IRWXU, 0);
+      break;
+    case OP_LOOKUP:
+      rv = stat(path, &st);
+      break;
+    default:
+      rtems_test_assert(op == OP_UNLINK);
+      rv = unlink(path);
+      break;
+  }
+
+  rtems_test_assert(rv == 0);
+}
+
+static void measure(const char *name, test_op op)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  uint64_t ns;
+  int i;
+
+  t0 = rtems_counter_read();
+
+  /*
+   * Use a stride to not look up the entries in the order of the directory
+   * entries.
+   */
+  for (i = 0; i < ENTRY_COUNT; ++i) {
+    do_op(op, (int) (((uint32_t) i * 7919) % ENTRY_COUNT));
+  }
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  ns = rtems_counter_ticks_to_nanoseconds(d);
+
+  printf(
+    "  <%s>\n"
+    "    <Count>%i</Count>\n"
+    "    <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "    <NsPerOperation>%" PRIu64 "</NsPerOperation>\n"
+    "  </%s>\n",
+    name,
+    ENTRY_COUNT,
+    ns,
+    ns / ENTRY_COUNT,
+    name
+  );
+}
+
+static void test(void)
+{
+  struct stat st;
+  int rv;
+
+  rv = mkdir(DIR_PATH, S_IRWXU);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "<FSIMFSDir%s index=\"%s\" entries=\"%i\">\n",
+    TEST_NAME,
+    TEST_INDEX,
+    ENTRY_COUNT
+  );
+
+  measure("Create", OP_CREATE);
+
+  rv = stat(DIR_PATH, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == ENTRY_COUNT * sizeof(struct dirent));
+
+  measure("Lookup", OP_LOOKUP);
+  measure("Unlink", OP_UNLINK);
+
+  rv = stat(DIR_PATH, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.st_size == 0);
+
+  printf("</FSIMFSDir%s>\n", TEST_NAME);
+
+  rv = rmdir(DIR_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
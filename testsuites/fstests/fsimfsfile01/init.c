@@ -0,0 +1,212 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+#ifndef TEST_NAME
+#define TEST_NAME "1"
+#define TEST_FILE "Memfile"
+#endif
+
+const char rtems_test_name[] = "FSIMFSFILE " TEST_NAME;
+
+#define FILE_PATH "/file"
+
+#define CHUNK_SIZE 4096
+
+#define MIN_FILE_SIZE (4 * 1024)
+
+#define MAX_FILE_SIZE (64 * 1024 * 1024)
+
+typedef struct {
+  uint8_t buf[CHUNK_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static uint64_t elapsed_ns(rtems_counter_ticks t0)
+{
+  rtems_counter_ticks d;
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  return rtems_counter_ticks_to_nanoseconds(d);
+}
+
+static uint64_t bytes_per_second(size_t size, uint64_t ns)
+{
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return (uint64_t) size * 1000000000 / ns;
+}
+
+static void test_file_size(test_context *ctx, size_t size)
+{
+  rtems_counter_ticks t0;
+  uint64_t write_ns;
+  uint64_t read_ns;
+  size_t done;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(FILE_PATH, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  memset(ctx->buf, 0xa5, sizeof(ctx->buf));
+  t0 = rtems_counter_read();
+
+  for (done = 0; done < size; done += CHUNK_SIZE) {
+    n = write(fd, ctx->buf, CHUNK_SIZE);
+
+    if (n < 0) {
+      /* Sizes which do not fit into the available memory are reported */
+      rtems_test_assert(errno == ENOSPC || errno == EFBIG);
+      break;
+    }
+
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  write_ns = elapsed_ns(t0);
+
+  if (done < size) {
+    printf("  <File size=\"%zu\"><NoSpace/></File>\n", size);
+  } else {
+    off_t off;
+
+    off = lseek(fd, 0, SEEK_SET);
+    rtems_test_assert(off == 0);
+
+    t0 = rtems_counter_read();
+
+    for (done = 0; done < size; done += CHUNK_SIZE) {
+      n = read(fd, ctx->buf, CHUNK_SIZE);
+      rtems_test_assert(n == CHUNK_SIZE);
+    }
+
+    read_ns = elapsed_ns(t0);
+
+    off = lseek(fd, 0, SEEK_SET);
+    rtems_test_assert(off == 0);
+
+    for (done = 0; done < size; done += CHUNK_SIZE) {
+      memset(ctx->buf, 0, sizeof(ctx->buf));
+      n = read(fd, ctx->buf, CHUNK_SIZE);
+      rtems_test_assert(n == CHUNK_SIZE);
+      rtems_test_assert(ctx->buf[0] == 0xa5);
+      rtems_test_assert(ctx->buf[CHUNK_SIZE - 1] == 0xa5);
+    }
+
+    printf(
+      "  <File size=\"%zu\">\n"
+      "    <WriteDuration unit=\"ns\">%" PRIu64 "</WriteDuration>\n"
+      "    <WriteBytesPerSecond>%" PRIu64 "</WriteBytesPerSecond>\n"
+      "    <ReadDuration unit=\"ns\">%" PRIu64 "</ReadDuration>\n"
+      "    <ReadBytesPerSecond>%" PRIu64 "</ReadBytesPerSecond>\n"
+      "  </File>\n",
+      size,
+      write_ns,
+      bytes_per_second(size, write_ns),
+      read_ns,
+      bytes_per_second(size, read_ns)
+    );
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(FILE_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  size_t size;
+
+  printf(
+    "<FSIMFSFile%s file=\"%s\" chunkSize=\"%i\">\n",
+    TEST_NAME,
+    TEST_FILE,
+    CHUNK_SIZE
+  );
+
+  for (size = MIN_FILE_SIZE; size <= MAX_FILE_SIZE; size *= 4) {
+    test_file_size(ctx, size);
+  }
+
+  printf("</FSIMFSFile%s>\n", TEST_NAME);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK 512
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,310 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/imfs.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "FSIMFSMMAP 1";
+
+#define LINFILE_PATH "/linfile"
+
+#define MEMFILE_PATH "/memfile"
+
+#define BLOCK_SIZE 512
+
+#define TABLE_ENTRIES (16 * 1024)
+
+#define LOOKUPS 4096
+
+typedef struct {
+  uint32_t table[TABLE_ENTRIES];
+  uint32_t buf[BLOCK_SIZE / sizeof(uint32_t)];
+} test_context;
+
+static test_context test_instance;
+
+static uint64_t elapsed_ns(rtems_counter_ticks t0)
+{
+  rtems_counter_ticks d;
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  return rtems_counter_ticks_to_nanoseconds(d);
+}
+
+static size_t next_index(size_t i)
+{
+  return (i * 1103515245 + 12345) % TABLE_ENTRIES;
+}
+
+static void test_linfile(test_context *ctx)
+{
+  void *addr;
+  int fd;
+  int rv;
+
+  fd = open(LINFILE_PATH, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  addr = mmap(NULL, sizeof(ctx->table), PROT_READ, MAP_SHARED, fd, 0);
+  rtems_test_assert(addr == ctx->table);
+
+  rv = munmap(addr, sizeof(ctx->table));
+  rtems_test_assert(rv == 0);
+
+  addr = mmap(NULL, BLOCK_SIZE, PROT_READ, MAP_PRIVATE, fd, BLOCK_SIZE);
+  rtems_test_assert(addr == &ctx->table[BLOCK_SIZE / sizeof(uint32_t)]);
+
+  rv = munmap(addr, BLOCK_SIZE);
+  rtems_test_assert(rv == 0);
+
+  errno = 0;
+  addr = mmap(
+    NULL,
+    sizeof(ctx->table) + 1,
+    PROT_READ,
+    MAP_SHARED,
+    fd,
+    0
+  );
+  rtems_test_assert(addr == MAP_FAILED);
+  rtems_test_assert(errno == EOVERFLOW);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_memfile(test_context *ctx)
+{
+  uint32_t *addr;
+  ssize_t n;
+  size_t i;
+  int fd;
+  int rv;
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(ctx->buf); ++i) {
+    ctx->buf[i] = i;
+  }
+
+  fd = open(MEMFILE_PATH, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  n = write(fd, ctx->buf, sizeof(ctx->buf));
+  rtems_test_assert(n == (ssize_t) sizeof(ctx->buf));
+
+  n = write(fd, ctx->buf, sizeof(ctx->buf));
+  rtems_test_assert(n == (ssize_t) sizeof(ctx->buf));
+
+  addr = mmap(NULL, BLOCK_SIZE / 2, PROT_READ, MAP_SHARED, fd, BLOCK_SIZE);
+  rtems_test_assert(addr != MAP_FAILED);
+  rtems_test_assert(memcmp(addr, ctx->buf, BLOCK_SIZE / 2) == 0);
+
+  /* The mapping refers directly to the file data */
+  ctx->buf[0] = 0xdeadbeef;
+  n = pwrite(fd, &ctx->buf[0], sizeof(ctx->buf[0]), BLOCK_SIZE);
+  rtems_test_assert(n == (ssize_t) sizeof(ctx->buf[0]));
+  rtems_test_assert(addr[0] == 0xdeadbeef);
+  ctx->buf[0] = 0;
+
+  rv = munmap(addr, BLOCK_SIZE / 2);
+  rtems_test_assert(rv == 0);
+
+  /* Writes through a mapping are not supported */
+  errno = 0;
+  addr = mmap(NULL, BLOCK_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  rtems_test_assert(addr == MAP_FAILED);
+  rtems_test_assert(errno == ENOTSUP);
+
+  /* A shared mapping across blocks depends on the block placement */
+  errno = 0;
+  addr = mmap(NULL, 2 * BLOCK_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+  rtems_test_assert(addr != MAP_FAILED || errno == ENOTSUP);
+
+  if (addr != MAP_FAILED) {
+    rv = munmap(addr, 2 * BLOCK_SIZE);
+    rtems_test_assert(rv == 0);
+  }
+
+  /* A private mapping falls back to a copy */
+  addr = mmap(NULL, 2 * BLOCK_SIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  rtems_test_assert(addr != MAP_FAILED);
+  rtems_test_assert(memcmp(addr, ctx->buf, BLOCK_SIZE) == 0);
+  rtems_test_assert(addr[BLOCK_SIZE / sizeof(uint32_t)] == 0xdeadbeef);
+
+  rv = munmap(addr, 2 * BLOCK_SIZE);
+  rtems_test_assert(rv == 0);
+
+  /* The mapped blocks are pinned until the munmap() */
+  addr = mmap(NULL, BLOCK_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+  rtems_test_assert(addr != MAP_FAILED);
+  rtems_test_assert(memcmp(addr, ctx->buf, BLOCK_SIZE) == 0);
+
+  errno = 0;
+  rv = ftruncate(fd, BLOCK_SIZE);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EBUSY);
+
+  rv = ftruncate(fd, 3 * BLOCK_SIZE);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  rv = unlink(MEMFILE_PATH);
+  rtems_test_assert(rv == 0);
+
+  rtems_test_assert(memcmp(addr, ctx->buf, BLOCK_SIZE) == 0);
+
+  rv = munmap(addr, BLOCK_SIZE);
+  rtems_test_assert(rv == 0);
+}
+
+static void benchmark(test_context *ctx)
+{
+  rtems_counter_ticks t0;
+  uint64_t read_ns;
+  uint64_t mmap_ns;
+  const uint32_t *addr;
+  uint32_t sum_read;
+  uint32_t sum_mmap;
+  uint32_t value;
+  size_t i;
+  size_t j;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(LINFILE_PATH, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  sum_read = 0;
+  j = 0;
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < LOOKUPS; ++i) {
+    j = next_index(j);
+    n = pread(fd, &value, sizeof(value), j * sizeof(value));
+    rtems_test_assert(n == (ssize_t) sizeof(value));
+    sum_read += value;
+  }
+
+  read_ns = elapsed_ns(t0);
+
+  sum_mmap = 0;
+  j = 0;
+  t0 = rtems_counter_read();
+  addr = mmap(NULL, sizeof(ctx->table), PROT_READ, MAP_SHARED, fd, 0);
+  rtems_test_assert(addr != MAP_FAILED);
+
+  for (i = 0; i < LOOKUPS; ++i) {
+    j = next_index(j);
+    sum_mmap += addr[j];
+  }
+
+  mmap_ns = elapsed_ns(t0);
+  rtems_test_assert(sum_read == sum_mmap);
+
+  rv = munmap(RTEMS_DECONST(uint32_t *, addr), sizeof(ctx->table));
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "<FSIMFSMmap01 tableSize=\"%zu\" lookups=\"%i\">\n"
+    "  <ReadDuration unit=\"ns\">%" PRIu64 "</ReadDuration>\n"
+    "  <MmapDuration unit=\"ns\">%" PRIu64 "</MmapDuration>\n"
+    "</FSIMFSMmap01>\n",
+    sizeof(ctx->table),
+    LOOKUPS,
+    read_ns,
+    mmap_ns
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  size_t i;
+  int rv;
+
+  TEST_BEGIN();
+
+  for (i = 0; i < TABLE_ENTRIES; ++i) {
+    ctx->table[i] = i * i;
+  }
+
+  rv = IMFS_make_linearfile(
+    LINFILE_PATH,
+    S_IRWXU,
+    ctx->table,
+    sizeof(ctx->table)
+  );
+  rtems_test_assert(rv == 0);
+
+  test_memfile(ctx);
+  benchmark(ctx);
+  test_linfile(ctx);
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_IMFS
+
+#define CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK BLOCK_SIZE
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
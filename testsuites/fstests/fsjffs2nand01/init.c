@@ -0,0 +1,510 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2NAND 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define BLOCK_COUNT 32
+
+#define FLASH_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+
+#define WRITE_SIZE 512
+
+#define PAGE_COUNT (FLASH_SIZE / WRITE_SIZE)
+
+#define OOB_SIZE 16
+
+#define BAD_BLOCK 3
+
+#define CHUNK_SIZE 32
+
+#define CHUNK_COUNT 256
+
+#define MOUNT_POINT "/jffs2"
+
+#define FILE_PATH MOUNT_POINT "/file"
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  size_t write_count;
+  size_t write_bytes;
+  size_t program_errors;
+  size_t flush_triggers;
+  bool bad[BLOCK_COUNT];
+  bool programmed[PAGE_COUNT];
+  unsigned char oob[PAGE_COUNT][OOB_SIZE];
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  ++self->write_count;
+  self->write_bytes += size_of_buffer;
+
+  if (super->write_size != 0) {
+    /* A NAND page may be programmed only once and only as a whole */
+    if (
+      offset % WRITE_SIZE != 0
+        || size_of_buffer % WRITE_SIZE != 0
+        || self->bad[offset / BLOCK_SIZE]
+    ) {
+      ++self->program_errors;
+    }
+
+    for (i = 0; i < size_of_buffer / WRITE_SIZE; ++i) {
+      size_t page = offset / WRITE_SIZE + i;
+
+      if (self->programmed[page]) {
+        ++self->program_errors;
+      }
+
+      self->programmed[page] = true;
+    }
+  }
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t page = offset / WRITE_SIZE;
+
+  if (self->bad[offset / BLOCK_SIZE]) {
+    return -EIO;
+  }
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+  memset(&self->oob[page][0], 0xff, (BLOCK_SIZE / WRITE_SIZE) * OOB_SIZE);
+  memset(&self->programmed[page], 0, BLOCK_SIZE / WRITE_SIZE);
+
+  return 0;
+}
+
+static int flash_block_is_bad(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  bool *bad
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  *bad = self->bad[offset / BLOCK_SIZE];
+
+  return 0;
+}
+
+static int flash_block_mark_bad(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  self->bad[offset / BLOCK_SIZE] = true;
+
+  return 0;
+}
+
+static int flash_oob_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+
+  rtems_test_assert(offset % WRITE_SIZE == 0);
+  rtems_test_assert(size_of_buffer <= OOB_SIZE);
+  memcpy(buffer, &self->oob[offset / WRITE_SIZE][0], size_of_buffer);
+
+  return 0;
+}
+
+static int flash_oob_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *oob = &self->oob[offset / WRITE_SIZE][0];
+  size_t i;
+
+  rtems_test_assert(offset % WRITE_SIZE == 0);
+  rtems_test_assert(size_of_buffer <= OOB_SIZE);
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    oob[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static void flash_trigger_write_buffer_flush(rtems_jffs2_flash_control *super)
+{
+  flash_control *self = get_flash_control(super);
+
+  ++self->flush_triggers;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static const rtems_jffs2_mount_data mount_data = {
+  .flash_control = &flash_instance.super
+};
+
+static unsigned char buf[CHUNK_SIZE * CHUNK_COUNT];
+
+static void erase_all(void)
+{
+  memset(&flash_instance.area[0], 0xff, sizeof(flash_instance.area));
+  memset(&flash_instance.oob[0][0], 0xff, sizeof(flash_instance.oob));
+  memset(&flash_instance.programmed[0], 0, sizeof(flash_instance.programmed));
+  memset(&flash_instance.bad[0], 0, sizeof(flash_instance.bad));
+}
+
+static void select_nor(void)
+{
+  rtems_jffs2_flash_control *fc = &flash_instance.super;
+
+  fc->write_size = 0;
+  fc->oob_size = 0;
+  fc->block_is_bad = NULL;
+  fc->block_mark_bad = NULL;
+  fc->oob_read = NULL;
+  fc->oob_write = NULL;
+  fc->trigger_write_buffer_flush = NULL;
+}
+
+static void select_nand(void)
+{
+  rtems_jffs2_flash_control *fc = &flash_instance.super;
+
+  fc->write_size = WRITE_SIZE;
+  fc->oob_size = OOB_SIZE;
+  fc->block_is_bad = flash_block_is_bad;
+  fc->block_mark_bad = flash_block_mark_bad;
+  fc->oob_read = flash_oob_read;
+  fc->oob_write = flash_oob_write;
+  fc->trigger_write_buffer_flush = flash_trigger_write_buffer_flush;
+}
+
+static void reset_counters(void)
+{
+  flash_instance.write_count = 0;
+  flash_instance.write_bytes = 0;
+  flash_instance.flush_triggers = 0;
+}
+
+static void do_mount(void)
+{
+  int rv;
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    &mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void fill_buffer(void)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof(buf); ++i) {
+    buf[i] = (unsigned char) (i * 7 + (i >> 8));
+  }
+}
+
+static void check_file(size_t size)
+{
+  static unsigned char actual[sizeof(buf)];
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(FILE_PATH, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  n = read(fd, actual, sizeof(actual));
+  rtems_test_assert(n == (ssize_t) size);
+  rtems_test_assert(memcmp(actual, buf, size) == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static size_t small_writes(const char *name)
+{
+  uint64_t begin;
+  uint64_t end;
+  size_t write_count;
+  size_t i;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  erase_all();
+  do_mount();
+
+  fd = open(FILE_PATH, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  reset_counters();
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < CHUNK_COUNT; ++i) {
+    n = write(fd, &buf[i * CHUNK_SIZE], CHUNK_SIZE);
+    rtems_test_assert(n == CHUNK_SIZE);
+  }
+
+  rv = fsync(fd);
+  rtems_test_assert(rv == 0);
+
+  end = rtems_clock_get_uptime_nanoseconds();
+  write_count = flash_instance.write_count;
+  rtems_test_assert(flash_instance.write_bytes >= sizeof(buf));
+
+  printf(
+    "<SmallWrites flash=\"%s\" count=\"%i\" size=\"%i\">\n"
+    "  <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "  <FlashWrites>%zu</FlashWrites>\n"
+    "  <FlashWriteBytes>%zu</FlashWriteBytes>\n"
+    "</SmallWrites>\n",
+    name,
+    CHUNK_COUNT,
+    CHUNK_SIZE,
+    end - begin,
+    write_count,
+    flash_instance.write_bytes
+  );
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  do_unmount();
+  do_mount();
+  check_file(sizeof(buf));
+  do_unmount();
+
+  return write_count;
+}
+
+static void test_flush(void)
+{
+  rtems_jffs2_info info;
+  size_t write_count;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  erase_all();
+  flash_instance.bad[BAD_BLOCK] = true;
+  do_mount();
+
+  fd = open(FILE_PATH, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_GET_INFO, &info);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(info.bad_blocks == 1);
+  rtems_test_assert(info.bad_size == BLOCK_SIZE);
+
+  /* A small write stays in the write buffer and triggers a flush request */
+  reset_counters();
+  n = write(fd, &buf[0], CHUNK_SIZE);
+  rtems_test_assert(n == CHUNK_SIZE);
+  rtems_test_assert(flash_instance.flush_triggers > 0);
+  rtems_test_assert(flash_instance.write_count == 0);
+
+  rv = ioctl(fd, RTEMS_JFFS2_FLUSH_WRITE_BUFFER);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(flash_instance.write_count > 0);
+
+  /* Nothing is pending now */
+  write_count = flash_instance.write_count;
+  rv = ioctl(fd, RTEMS_JFFS2_FLUSH_WRITE_BUFFER);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(flash_instance.write_count == write_count);
+
+  /* The data must be visible before and after the flush through fsync() */
+  n = write(fd, &buf[CHUNK_SIZE], CHUNK_SIZE);
+  rtems_test_assert(n == CHUNK_SIZE);
+  check_file(2 * CHUNK_SIZE);
+  write_count = flash_instance.write_count;
+  rv = fsync(fd);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(flash_instance.write_count > write_count);
+  check_file(2 * CHUNK_SIZE);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  /* The write buffer is padded and written out during unmount */
+  fd = open(FILE_PATH, O_WRONLY | O_APPEND);
+  rtems_test_assert(fd >= 0);
+  n = write(fd, &buf[2 * CHUNK_SIZE], CHUNK_SIZE);
+  rtems_test_assert(n == CHUNK_SIZE);
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  do_unmount();
+  rtems_test_assert(!flash_instance.bad[BAD_BLOCK - 1]);
+  rtems_test_assert(flash_instance.bad[BAD_BLOCK]);
+
+  do_mount();
+  check_file(3 * CHUNK_SIZE);
+  do_unmount();
+}
+
+static void test(void)
+{
+  size_t nor;
+  size_t nand;
+  int rv;
+
+  rv = mkdir(MOUNT_POINT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  fill_buffer();
+
+  select_nor();
+  nor = small_writes("NOR");
+
+  select_nand();
+  flash_instance.program_errors = 0;
+  nand = small_writes("NAND");
+  rtems_test_assert(flash_instance.program_errors == 0);
+  rtems_test_assert(nand < nor);
+
+  test_flush();
+  rtems_test_assert(flash_instance.program_errors == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,318 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/jffs2.h>
+#include <rtems/libio.h>
+
+const char rtems_test_name[] = "FSJFFS2SUM 1";
+
+#define BLOCK_SIZE (16UL * 1024UL)
+
+#define BLOCK_COUNT 64
+
+#define FLASH_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+
+#define FILE_COUNT 40
+
+#define FILE_SIZE (12UL * 1024UL)
+
+#define MOUNT_POINT "/jffs2"
+
+typedef struct {
+  rtems_jffs2_flash_control super;
+  size_t read_bytes;
+  unsigned char area[FLASH_SIZE];
+} flash_control;
+
+static flash_control *get_flash_control(rtems_jffs2_flash_control *super)
+{
+  return (flash_control *) super;
+}
+
+static int flash_read(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  self->read_bytes += size_of_buffer;
+  memcpy(buffer, chunk, size_of_buffer);
+
+  return 0;
+}
+
+static int flash_write(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset,
+  const unsigned char *buffer,
+  size_t size_of_buffer
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+  size_t i;
+
+  for (i = 0; i < size_of_buffer; ++i) {
+    chunk[i] &= buffer[i];
+  }
+
+  return 0;
+}
+
+static int flash_erase(
+  rtems_jffs2_flash_control *super,
+  uint32_t offset
+)
+{
+  flash_control *self = get_flash_control(super);
+  unsigned char *chunk = &self->area[offset];
+
+  memset(chunk, 0xff, BLOCK_SIZE);
+
+  return 0;
+}
+
+static flash_control flash_instance = {
+  .super = {
+    .block_size = BLOCK_SIZE,
+    .flash_size = FLASH_SIZE,
+    .read = flash_read,
+    .write = flash_write,
+    .erase = flash_erase
+  }
+};
+
+static const rtems_jffs2_mount_data mount_data_full_scan = {
+  .flash_control = &flash_instance.super
+};
+
+static const rtems_jffs2_mount_data mount_data_summary = {
+  .flash_control = &flash_instance.super,
+  .enable_summary = true
+};
+
+static unsigned char buf[FILE_SIZE];
+
+static void erase_all(void)
+{
+  memset(&flash_instance.area[0], 0xff, FLASH_SIZE);
+}
+
+static void do_mount(const rtems_jffs2_mount_data *mount_data)
+{
+  int rv;
+
+  rv = mount(
+    NULL,
+    MOUNT_POINT,
+    RTEMS_FILESYSTEM_TYPE_JFFS2,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    mount_data
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(MOUNT_POINT);
+  rtems_test_assert(rv == 0);
+}
+
+static void get_path(char *path, size_t size, int i)
+{
+  int n;
+
+  n = snprintf(path, size, MOUNT_POINT "/f%02i", i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void fill_buffer(int i)
+{
+  size_t j;
+
+  for (j = 0; j < FILE_SIZE; ++j) {
+    buf[j] = (unsigned char) (i * 131 + j * 7 + (j >> 8));
+  }
+}
+
+static void create_files(const rtems_jffs2_mount_data *mount_data)
+{
+  int i;
+
+  erase_all();
+  do_mount(mount_data);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    char path[32];
+    ssize_t n;
+    int fd;
+    int rv;
+
+    get_path(path, sizeof(path), i);
+    fill_buffer(i);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+    rtems_test_assert(fd >= 0);
+
+    n = write(fd, buf, sizeof(buf));
+    rtems_test_assert(n == (ssize_t) sizeof(buf));
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  do_unmount();
+}
+
+static void check_files(void)
+{
+  static unsigned char expected[FILE_SIZE];
+  int i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    char path[32];
+    ssize_t n;
+    int fd;
+    int rv;
+
+    get_path(path, sizeof(path), i);
+    fill_buffer(i);
+    memcpy(expected, buf, sizeof(expected));
+    memset(buf, 0, sizeof(buf));
+
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    n = read(fd, buf, sizeof(buf));
+    rtems_test_assert(n == (ssize_t) sizeof(buf));
+    rtems_test_assert(memcmp(buf, expected, sizeof(buf)) == 0);
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static size_t measure_mount(
+  const char *name,
+  const rtems_jffs2_mount_data *mount_data
+)
+{
+  uint64_t begin;
+  uint64_t end;
+  size_t read_bytes;
+
+  flash_instance.read_bytes = 0;
+  begin = rtems_clock_get_uptime_nanoseconds();
+  do_mount(mount_data);
+  end = rtems_clock_get_uptime_nanoseconds();
+  read_bytes = flash_instance.read_bytes;
+
+  printf(
+    "<Mount name=\"%s\">\n"
+    "  <Duration unit=\"ns\">%" PRIu64 "</Duration>\n"
+    "  <ReadBytes>%zu</ReadBytes>\n"
+    "</Mount>\n",
+    name,
+    end - begin,
+    read_bytes
+  );
+
+  check_files();
+  do_unmount();
+
+  return read_bytes;
+}
+
+static void test(void)
+{
+  size_t full_scan;
+  size_t fallback;
+  size_t summary;
+  int rv;
+
+  rv = mkdir(MOUNT_POINT, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  create_files(&mount_data_full_scan);
+  full_scan = measure_mount("FullScan", &mount_data_full_scan);
+
+  /* Blocks without a summary node must fall back to a full scan */
+  fallback = measure_mount("SummaryFallback", &mount_data_summary);
+
+  create_files(&mount_data_summary);
+  summary = measure_mount("Summary", &mount_data_summary);
+  rtems_test_assert(summary < full_scan);
+  rtems_test_assert(summary < fallback);
+
+  /* A summary enabled image must be mountable without summary support */
+  measure_mount("SummaryIgnored", &mount_data_full_scan);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_FILESYSTEM_JFFS2
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INIT_TASK_STACK_SIZE (32 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,407 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio_.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/rfs/rtems-rfs-block.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+#include <rtems/rfs/rtems-rfs-inode.h>
+
+const char rtems_test_name[] = "FSRFSALLOC 1";
+
+#define WRITER_COUNT 4
+
+#define BLOCK_SIZE 512
+
+#define FILE_SIZE (256 * 1024)
+
+#define READ_SIZE 4096
+
+static const char rda[] = "/dev/rda";
+
+static const char mnt[] = "/mnt";
+
+static rtems_rfs_format_config rfs_config = {
+  .block_size = BLOCK_SIZE
+};
+
+typedef struct {
+  rtems_id master;
+  rtems_id id;
+  bool preallocate;
+  int index;
+} writer_context;
+
+static writer_context writers[WRITER_COUNT];
+
+static uint8_t read_buf[READ_SIZE];
+
+static void make_path(char *path, size_t size, int i)
+{
+  int n;
+
+  n = snprintf(path, size, "%s/file-%i", mnt, i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static uint8_t pattern(int i, size_t offset)
+{
+  return (uint8_t) (i + offset / BLOCK_SIZE);
+}
+
+static void do_mount(const char *options)
+{
+  int rv;
+
+  rv = mount(
+    rda,
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+}
+
+static void writer_task(rtems_task_argument arg)
+{
+  writer_context *ctx;
+  uint8_t buf[BLOCK_SIZE];
+  char path[64];
+  size_t offset;
+  rtems_status_code sc;
+  int fd;
+  int rv;
+
+  ctx = (writer_context *) arg;
+  make_path(path, sizeof(path), ctx->index);
+
+  fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  if (ctx->preallocate) {
+    rv = ftruncate(fd, FILE_SIZE);
+    rtems_test_assert(rv == 0);
+  }
+
+  /*
+   * Write one block at a time and let the other writers run in between, so
+   * that the allocations of the writers interleave.
+   */
+  for (offset = 0; offset < FILE_SIZE; offset += sizeof(buf)) {
+    ssize_t n;
+
+    memset(buf, pattern(ctx->index, offset), sizeof(buf));
+    n = write(fd, buf, sizeof(buf));
+    rtems_test_assert(n == (ssize_t) sizeof(buf));
+
+    sc = rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  sc = rtems_event_transient_send(ctx->master);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Wait for the deletion by the master */
+  (void) rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(0);
+}
+
+static void write_files(bool preallocate)
+{
+  rtems_status_code sc;
+  int i;
+
+  for (i = 0; i < WRITER_COUNT; ++i) {
+    writer_context *ctx;
+
+    ctx = &writers[i];
+    ctx->master = rtems_task_self();
+    ctx->preallocate = preallocate;
+    ctx->index = i;
+
+    sc = rtems_task_create(
+      rtems_build_name('W', 'R', 'T', '0' + i),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE + BLOCK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(ctx->id, writer_task, (rtems_task_argument) ctx);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < WRITER_COUNT; ++i) {
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < WRITER_COUNT; ++i) {
+    sc = rtems_task_delete(writers[i].id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * Count the runs of contiguous data blocks of the file.  The file system is
+ * idle, so the block map can be walked without the file system lock.
+ */
+static uint32_t count_extents(int fd)
+{
+  rtems_rfs_file_system *fs;
+  rtems_rfs_inode_handle inode;
+  rtems_rfs_block_map map;
+  rtems_rfs_block_no block;
+  rtems_rfs_block_no last;
+  struct stat st;
+  uint32_t extents;
+  int rc;
+  int rv;
+
+  rv = fstat(fd, &st);
+  rtems_test_assert(rv == 0);
+
+  fs = rtems_libio_iop(fd)->pathinfo.mt_entry->fs_info;
+
+  rc = rtems_rfs_inode_open(fs, (rtems_rfs_ino) st.st_ino, &inode, true);
+  rtems_test_assert(rc == 0);
+
+  rc = rtems_rfs_block_map_open(fs, &inode, &map);
+  rtems_test_assert(rc == 0);
+
+  extents = 0;
+  last = 0;
+  rc = rtems_rfs_block_map_seek(fs, &map, 0, &block);
+
+  while (rc == 0) {
+    if (extents == 0 || block != last + 1) {
+      ++extents;
+    }
+
+    last = block;
+    rc = rtems_rfs_block_map_next_block(fs, &map, &block);
+  }
+
+  rtems_test_assert(rc == ENXIO);
+
+  rc = rtems_rfs_block_map_close(fs, &map);
+  rtems_test_assert(rc == 0);
+
+  rc = rtems_rfs_inode_close(fs, &inode);
+  rtems_test_assert(rc == 0);
+
+  return extents;
+}
+
+static uint32_t read_files(uint64_t *duration)
+{
+  uint32_t extents;
+  uint64_t begin;
+  int i;
+
+  extents = 0;
+  *duration = 0;
+
+  for (i = 0; i < WRITER_COUNT; ++i) {
+    char path[64];
+    size_t offset;
+    int fd;
+    int rv;
+
+    make_path(path, sizeof(path), i);
+    fd = open(path, O_RDONLY);
+    rtems_test_assert(fd >= 0);
+
+    extents += count_extents(fd);
+
+    begin = rtems_clock_get_uptime_nanoseconds();
+
+    for (offset = 0; offset < FILE_SIZE; offset += sizeof(read_buf)) {
+      ssize_t n;
+
+      n = read(fd, read_buf, sizeof(read_buf));
+      rtems_test_assert(n == (ssize_t) sizeof(read_buf));
+      rtems_test_assert(read_buf[0] == pattern(i, offset));
+      rtems_test_assert(
+        read_buf[sizeof(read_buf) - 1]
+          == pattern(i, offset + sizeof(read_buf) - 1)
+      );
+    }
+
+    *duration += rtems_clock_get_uptime_nanoseconds() - begin;
+
+    rv = close(fd);
+    rtems_test_assert(rv == 0);
+  }
+
+  return extents;
+}
+
+static void remove_files(void)
+{
+  int i;
+
+  for (i = 0; i < WRITER_COUNT; ++i) {
+    char path[64];
+    int rv;
+
+    make_path(path, sizeof(path), i);
+    rv = unlink(path);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static uint32_t allocation_benchmark(
+  const char *name,
+  const char *options,
+  bool preallocate
+)
+{
+  uint64_t write_begin;
+  uint64_t write_duration;
+  uint64_t read_duration;
+  uint32_t extents;
+  int rv;
+
+  rv = rtems_rfs_format(rda, &rfs_config);
+  rtems_test_assert(rv == 0);
+
+  do_mount(options);
+  write_begin = rtems_clock_get_uptime_nanoseconds();
+  write_files(preallocate);
+  write_duration = rtems_clock_get_uptime_nanoseconds() - write_begin;
+  do_unmount();
+
+  /* Remount so that no buffers are held by the file system */
+  do_mount(options);
+  extents = read_files(&read_duration);
+  remove_files();
+  do_unmount();
+
+  printf(
+    "<ConcurrentWriters name=\"%s\" writers=\"%i\" file-size=\"%i\">\n"
+    "  <Extents>%" PRIu32 "</Extents>\n"
+    "  <Write unit=\"ns\">%" PRIu64 "</Write>\n"
+    "  <SequentialRead unit=\"ns\">%" PRIu64 "</SequentialRead>\n"
+    "</ConcurrentWriters>\n",
+    name,
+    WRITER_COUNT,
+    FILE_SIZE,
+    extents,
+    write_duration,
+    read_duration
+  );
+
+  return extents;
+}
+
+static void test(void)
+{
+  uint32_t single;
+  uint32_t reserve;
+  uint32_t preallocate;
+  int rv;
+
+  rv = mkdir(mnt, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  single = allocation_benchmark("SingleBlock", "reserve-blocks=0", false);
+  reserve = allocation_benchmark("ReserveWindow", NULL, false);
+  preallocate = allocation_benchmark("Preallocate", "reserve-blocks=0", true);
+
+  rtems_test_assert(reserve < single);
+
+  /*
+   * A reservation does not cross a group boundary, so a preallocated file may
+   * have one extent for each group.
+   */
+  rtems_test_assert(preallocate <= 2 * WRITER_COUNT);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = BLOCK_SIZE, .block_num = 8192 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (4 + WRITER_COUNT)
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WRITER_COUNT)
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
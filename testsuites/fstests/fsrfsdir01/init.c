@@ -0,0 +1,345 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/rfs/rtems-rfs-data.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+
+const char rtems_test_name[] = "FSRFSDIR 1";
+
+#define FILE_COUNT 1000
+
+static const char rda[] = "/dev/rda";
+
+static const char mnt[] = "/mnt";
+
+static const char dir[] = "/mnt/dir";
+
+static rtems_rfs_format_config rfs_config = {
+  .block_size = 512,
+  .group_inodes = 1536
+};
+
+static void make_path(char *path, size_t size, const char *prefix, int i)
+{
+  int n;
+
+  n = snprintf(path, size, "%s/%s-%05i", dir, prefix, i);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void do_mount(const char *options)
+{
+  int rv;
+
+  rv = mount(
+    rda,
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+}
+
+static void create_files(void)
+{
+  char path[64];
+  int rv;
+  int i;
+
+  rv = mkdir(dir, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_path(path, sizeof(path), "file", i);
+    rv = mknod(path, S_IFREG | S_IRWXU, 0);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static uint64_t lookup_files(const char *prefix, int expected_errno)
+{
+  struct stat st;
+  char path[64];
+  uint64_t begin;
+  int rv;
+  int i;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_path(path, sizeof(path), prefix, i);
+    errno = 0;
+    rv = stat(path, &st);
+
+    if (expected_errno == 0) {
+      rtems_test_assert(rv == 0);
+      rtems_test_assert(S_ISREG(st.st_mode));
+    } else {
+      rtems_test_assert(rv == -1);
+      rtems_test_assert(errno == expected_errno);
+    }
+  }
+
+  return rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static void lookup_benchmark(const char *name)
+{
+  uint64_t found;
+  uint64_t not_found;
+
+  found = lookup_files("file", 0);
+  not_found = lookup_files("none", ENOENT);
+
+  printf(
+    "<LargeDirectory name=\"%s\" files=\"%i\">\n"
+    "  <Lookup unit=\"ns\">%" PRIu64 "</Lookup>\n"
+    "  <LookupNotFound unit=\"ns\">%" PRIu64 "</LookupNotFound>\n"
+    "</LargeDirectory>\n",
+    name,
+    FILE_COUNT,
+    found,
+    not_found
+  );
+}
+
+static int count_entries(void)
+{
+  struct dirent *de;
+  DIR *d;
+  int count;
+  int rv;
+
+  d = opendir(dir);
+  rtems_test_assert(d != NULL);
+
+  count = 0;
+
+  while ((de = readdir(d)) != NULL) {
+    ++count;
+  }
+
+  rv = closedir(d);
+  rtems_test_assert(rv == 0);
+
+  return count;
+}
+
+static void test_index_update(void)
+{
+  struct stat st;
+  char path[64];
+  char path_2[64];
+  int rv;
+  int i;
+
+  /* Remove every second file and rename the others */
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_path(path, sizeof(path), "file", i);
+
+    if ((i % 2) == 0) {
+      rv = unlink(path);
+      rtems_test_assert(rv == 0);
+    } else {
+      make_path(path_2, sizeof(path_2), "name", i);
+      rv = rename(path, path_2);
+      rtems_test_assert(rv == 0);
+    }
+  }
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_path(path, sizeof(path), "file", i);
+    errno = 0;
+    rv = stat(path, &st);
+    rtems_test_assert(rv == -1);
+    rtems_test_assert(errno == ENOENT);
+
+    make_path(path, sizeof(path), "name", i);
+    errno = 0;
+    rv = stat(path, &st);
+
+    if ((i % 2) == 0) {
+      rtems_test_assert(rv == -1);
+      rtems_test_assert(errno == ENOENT);
+    } else {
+      rtems_test_assert(rv == 0);
+    }
+  }
+
+  rtems_test_assert(count_entries() == 2 + FILE_COUNT / 2);
+
+  /* Refill the holes */
+  for (i = 0; i < FILE_COUNT; i += 2) {
+    make_path(path, sizeof(path), "file", i);
+    rv = mknod(path, S_IFREG | S_IRWXU, 0);
+    rtems_test_assert(rv == 0);
+  }
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_path(path, sizeof(path), (i % 2) == 0 ? "file" : "name", i);
+    rv = stat(path, &st);
+    rtems_test_assert(rv == 0);
+  }
+
+  rtems_test_assert(count_entries() == 2 + FILE_COUNT);
+}
+
+static void remove_files(void)
+{
+  char path[64];
+  int rv;
+  int i;
+
+  for (i = 0; i < FILE_COUNT; ++i) {
+    make_path(path, sizeof(path), (i % 2) == 0 ? "file" : "name", i);
+    rv = unlink(path);
+    rtems_test_assert(rv == 0);
+  }
+
+  rv = rmdir(dir);
+  rtems_test_assert(rv == 0);
+}
+
+static uint32_t read_version(void)
+{
+  uint8_t sb[RTEMS_RFS_SB_OFFSET_VERSION + 4];
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(rda, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  n = read(fd, sb, sizeof(sb));
+  rtems_test_assert(n == (ssize_t) sizeof(sb));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return rtems_rfs_read_u32(&sb[RTEMS_RFS_SB_OFFSET_VERSION]);
+}
+
+static void test(void)
+{
+  int rv;
+
+  rv = mkdir(mnt, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_rfs_format(rda, &rfs_config);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert((read_version() & RTEMS_RFS_FEATURE_DIR_INDEX) == 0);
+
+  do_mount(NULL);
+  create_files();
+  lookup_benchmark("NoIndex");
+  do_unmount();
+
+  do_mount("dir-index");
+  lookup_benchmark("IndexMountOption");
+  test_index_update();
+  do_unmount();
+
+  /* The index is rebuilt from the directory after a remount */
+  do_mount("dir-index");
+  lookup_benchmark("IndexRebuilt");
+  remove_files();
+  do_unmount();
+
+  rfs_config.dir_index = true;
+  rv = rtems_rfs_format(rda, &rfs_config);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert((read_version() & RTEMS_RFS_FEATURE_DIR_INDEX) != 0);
+
+  do_mount(NULL);
+  create_files();
+  lookup_benchmark("IndexFeature");
+  test_index_update();
+  remove_files();
+  do_unmount();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 4096 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
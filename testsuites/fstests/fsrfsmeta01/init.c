@@ -0,0 +1,322 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+#include <rtems/ramdisk.h>
+#include <rtems/rtems-rfs-format.h>
+
+const char rtems_test_name[] = "FSRFSMETA 1";
+
+#define DIR_COUNT 20
+
+#define FILES_PER_DIR 100
+
+#define FILE_COUNT (DIR_COUNT * FILES_PER_DIR)
+
+#define FILE_SIZE 100
+
+static const char rda[] = "/dev/rda";
+
+static const char mnt[] = "/mnt";
+
+static const rtems_rfs_format_config rfs_config = {
+  .block_size = 512,
+  .group_inodes = 2048
+};
+
+static char file_buf[FILE_SIZE];
+
+static void make_dir_path(char *path, size_t size, int d)
+{
+  int n;
+
+  n = snprintf(path, size, "%s/dir-%02i", mnt, d);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void make_file_path(char *path, size_t size, int d, int f)
+{
+  int n;
+
+  n = snprintf(path, size, "%s/dir-%02i/file-%03i", mnt, d, f);
+  rtems_test_assert(n > 0 && (size_t) n < size);
+}
+
+static void fill(int d, int f)
+{
+  memset(file_buf, 'a' + ((d + f) % 26), sizeof(file_buf));
+}
+
+static void do_mount(const char *options)
+{
+  int rv;
+
+  rv = mount(
+    rda,
+    mnt,
+    RTEMS_FILESYSTEM_TYPE_RFS,
+    RTEMS_FILESYSTEM_READ_WRITE,
+    options
+  );
+  rtems_test_assert(rv == 0);
+}
+
+static void do_unmount(void)
+{
+  int rv;
+
+  rv = unmount(mnt);
+  rtems_test_assert(rv == 0);
+}
+
+static void make_dirs(void)
+{
+  int d;
+
+  for (d = 0; d < DIR_COUNT; ++d) {
+    char path[64];
+    int rv;
+
+    make_dir_path(path, sizeof(path), d);
+    rv = mkdir(path, S_IRWXU | S_IRWXG | S_IRWXO);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static void remove_dirs(void)
+{
+  int d;
+
+  for (d = 0; d < DIR_COUNT; ++d) {
+    char path[64];
+    int rv;
+
+    make_dir_path(path, sizeof(path), d);
+    rv = rmdir(path);
+    rtems_test_assert(rv == 0);
+  }
+}
+
+static uint64_t create_files(void)
+{
+  uint64_t begin;
+  int d;
+  int f;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (f = 0; f < FILES_PER_DIR; ++f) {
+    for (d = 0; d < DIR_COUNT; ++d) {
+      char path[64];
+      ssize_t n;
+      int fd;
+      int rv;
+
+      make_file_path(path, sizeof(path), d, f);
+      fd = open(path, O_WRONLY | O_CREAT | O_EXCL, S_IRWXU);
+      rtems_test_assert(fd >= 0);
+
+      fill(d, f);
+      n = write(fd, file_buf, sizeof(file_buf));
+      rtems_test_assert(n == (ssize_t) sizeof(file_buf));
+
+      rv = close(fd);
+      rtems_test_assert(rv == 0);
+    }
+  }
+
+  return rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static void check_files(void)
+{
+  char buf[FILE_SIZE];
+  int d;
+  int f;
+
+  for (d = 0; d < DIR_COUNT; ++d) {
+    for (f = 0; f < FILES_PER_DIR; ++f) {
+      char path[64];
+      ssize_t n;
+      int fd;
+      int rv;
+
+      make_file_path(path, sizeof(path), d, f);
+      fd = open(path, O_RDONLY);
+      rtems_test_assert(fd >= 0);
+
+      fill(d, f);
+      n = read(fd, buf, sizeof(buf) + 1);
+      rtems_test_assert(n == (ssize_t) sizeof(buf));
+      rtems_test_assert(memcmp(buf, file_buf, sizeof(buf)) == 0);
+
+      rv = close(fd);
+      rtems_test_assert(rv == 0);
+    }
+  }
+}
+
+static uint64_t unlink_files(void)
+{
+  uint64_t begin;
+  int d;
+  int f;
+
+  begin = rtems_clock_get_uptime_nanoseconds();
+
+  for (f = 0; f < FILES_PER_DIR; ++f) {
+    for (d = 0; d < DIR_COUNT; ++d) {
+      char path[64];
+      int rv;
+
+      make_file_path(path, sizeof(path), d, f);
+      rv = unlink(path);
+      rtems_test_assert(rv == 0);
+    }
+  }
+
+  return rtems_clock_get_uptime_nanoseconds() - begin;
+}
+
+static uint64_t ops_per_second(uint64_t duration)
+{
+  if (duration == 0) {
+    return 0;
+  }
+
+  return (UINT64_C(1000000000) * FILE_COUNT) / duration;
+}
+
+static void metadata_benchmark(const char *name, const char *options)
+{
+  uint64_t create;
+  uint64_t remove;
+  struct statvfs st;
+  fsblkcnt_t bfree;
+  fsfilcnt_t ffree;
+  int rv;
+
+  rv = rtems_rfs_format(rda, &rfs_config);
+  rtems_test_assert(rv == 0);
+
+  do_mount(options);
+
+  rv = statvfs(mnt, &st);
+  rtems_test_assert(rv == 0);
+  bfree = st.f_bfree;
+  ffree = st.f_ffree;
+
+  make_dirs();
+  create = create_files();
+  do_unmount();
+
+  /* The metadata written by the create is found after a remount */
+  do_mount(options);
+  check_files();
+  remove = unlink_files();
+  remove_dirs();
+
+  rv = statvfs(mnt, &st);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(st.f_bfree == bfree);
+  rtems_test_assert(st.f_ffree == ffree);
+
+  do_unmount();
+
+  printf(
+    "<MetadataOperations name=\"%s\" files=\"%i\">\n"
+    "  <Create unit=\"1/s\">%" PRIu64 "</Create>\n"
+    "  <Unlink unit=\"1/s\">%" PRIu64 "</Unlink>\n"
+    "</MetadataOperations>\n",
+    name,
+    FILE_COUNT,
+    ops_per_second(create),
+    ops_per_second(remove)
+  );
+}
+
+static void test(void)
+{
+  int rv;
+
+  rv = mkdir(mnt, S_IRWXU | S_IRWXG | S_IRWXO);
+  rtems_test_assert(rv == 0);
+
+  metadata_benchmark("NoLocalCache", "no-local-cache");
+  metadata_benchmark("Default", NULL);
+  metadata_benchmark("HoldBuffers", "max-held-bufs=64");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+  test();
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration [] = {
+  { .block_size = 512, .block_num = 8192 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
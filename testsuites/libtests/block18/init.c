@@ -0,0 +1,270 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/bdbuf.h>
+#include <rtems/ramdisk.h>
+#include <rtems/test.h>
+#include <rtems.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "BLOCK 18";
+
+#ifdef RTEMS_SMP
+#define CPU_COUNT 32
+#else
+#define CPU_COUNT 1
+#endif
+
+#define TASK_PRIORITY 1
+
+#define PARTITION_COUNT 8
+
+#define DISK_COUNT 4
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 64
+
+#define TEST_COUNT 2
+
+typedef struct {
+  rtems_test_parallel_context base;
+  const char *name[TEST_COUNT];
+  rtems_disk_device *dd[DISK_COUNT];
+  unsigned long counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) arg;
+  unsigned long sum = 0;
+  size_t i;
+
+  printf("  <%s activeWorker=\"%zu\">\n", ctx->name[test], active_workers);
+
+  for (i = 0; i < active_workers; ++i) {
+    unsigned long counter = ctx->counter[active_workers - 1][test][i];
+
+    rtems_test_assert(counter > 0);
+    sum += counter;
+    printf(
+      "    <Counter worker=\"%zu\">%lu</Counter>\n",
+      i,
+      counter
+    );
+  }
+
+  printf(
+    "    <SumOfCounter>%lu</SumOfCounter>\n"
+    "  </%s>\n",
+    sum,
+    ctx->name[test]
+  );
+}
+
+static unsigned long read_blocks(
+  test_context *ctx,
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum block
+)
+{
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_bdbuf_release(bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    block = (block + 1) % BLOCK_COUNT;
+    ++counter;
+  }
+
+  return counter;
+}
+
+static void test_read_per_disk_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) arg;
+  rtems_disk_device *dd = ctx->dd[worker_index % DISK_COUNT];
+
+  ctx->counter[active_workers - 1][test][worker_index] =
+    read_blocks(ctx, dd, 0);
+}
+
+static void test_read_one_disk_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) arg;
+
+  ctx->counter[active_workers - 1][test][worker_index] =
+    read_blocks(ctx, ctx->dd[0], worker_index * 7 % BLOCK_COUNT);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_read_per_disk_body,
+    .fini = test_fini,
+    .cascade = true,
+    .arg = (void *) 0
+  }, {
+    .init = test_init,
+    .body = test_read_one_disk_body,
+    .fini = test_fini,
+    .cascade = true,
+    .arg = (void *) 1
+  }
+};
+
+static void do_ramdisk_register(
+  const char *disk,
+  rtems_disk_device **dd
+)
+{
+  rtems_status_code sc;
+  int fd;
+  int rv;
+
+  sc = ramdisk_register(BLOCK_SIZE, BLOCK_COUNT, false, disk);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(disk, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "Block18";
+  size_t i;
+
+  for (i = 0; i < DISK_COUNT; ++i) {
+    char disk[] = "/dev/rda";
+
+    disk[7] = (char) ('a' + i);
+    do_ramdisk_register(disk, &ctx->dd[i]);
+  }
+
+  ctx->name[0] = "ReadPerDisk";
+  ctx->name[1] = "ReadOneDisk";
+
+  rtems_test_assert(rtems_bdbuf_configuration.partitions == PARTITION_COUNT);
+  printf(
+    "<%s partitions=\"%" PRIu32 "\">\n",
+    test,
+    rtems_bdbuf_configuration.partitions
+  );
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</%s>\n", test);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS (DISK_COUNT + 3)
+
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE \
+  (2 * DISK_COUNT * BLOCK_COUNT * BLOCK_SIZE)
+
+#define CONFIGURE_BDBUF_CACHE_PARTITIONS PARTITION_COUNT
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
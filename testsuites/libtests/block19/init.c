@@ -0,0 +1,187 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/bdbuf.h>
+#include <rtems/counter.h>
+#include <rtems/ramdisk.h>
+#include <rtems.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "tmacros.h"
+
+#ifndef TEST_NAME
+#define TEST_NAME "19"
+#define TEST_INDEX "AVL"
+#endif
+
+const char rtems_test_name[] = "BLOCK " TEST_NAME;
+
+#define BLOCK_SIZE 64
+
+#define BLOCK_COUNT (64 * 1024)
+
+#define PASS_COUNT 8
+
+static const uint32_t buffer_counts[] = { 1024, 16 * 1024, 64 * 1024 };
+
+static void do_ramdisk_register(
+  const char *disk,
+  rtems_disk_device **dd
+)
+{
+  rtems_status_code sc;
+  int fd;
+  int rv;
+
+  sc = ramdisk_register(BLOCK_SIZE, BLOCK_COUNT, false, disk);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(disk, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static rtems_blkdev_bnum permute(uint32_t i, uint32_t buffer_count)
+{
+  /*
+   * The buffer count is a power of two, so an odd multiplier yields a
+   * permutation of the blocks.  This defeats the prefetching of the processor.
+   */
+  return (i * UINT32_C(40503)) & (buffer_count - 1);
+}
+
+static void test_hit_latency(rtems_disk_device *dd, uint32_t buffer_count)
+{
+  rtems_blkdev_stats before;
+  rtems_blkdev_stats after;
+  rtems_counter_ticks t0;
+  rtems_counter_ticks t1;
+  uint64_t ns;
+  uint32_t i;
+  uint32_t pass;
+
+  /* Make sure that all blocks of the working set are cached */
+  for (i = 0; i < buffer_count; ++i) {
+    read_block(dd, i);
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &before);
+  t0 = rtems_counter_read();
+
+  for (pass = 0; pass < PASS_COUNT; ++pass) {
+    for (i = 0; i < buffer_count; ++i) {
+      read_block(dd, permute(i, buffer_count));
+    }
+  }
+
+  t1 = rtems_counter_read();
+  ns = rtems_counter_ticks_to_nanoseconds(rtems_counter_difference(t1, t0));
+
+  rtems_bdbuf_get_device_stats(dd, &after);
+  rtems_test_assert(after.read_misses == before.read_misses);
+
+  printf(
+    "  <HitLatency buffers=\"%" PRIu32 "\" unit=\"ns\">%" PRIu64
+      "</HitLatency>\n",
+    buffer_count,
+    ns / ((uint64_t) PASS_COUNT * buffer_count)
+  );
+}
+
+static void test(void)
+{
+  rtems_disk_device *dd;
+  size_t i;
+
+  do_ramdisk_register("/dev/rda", &dd);
+
+  printf("<Block%s index=\"%s\">\n", TEST_NAME, TEST_INDEX);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(buffer_counts); ++i) {
+    test_hit_latency(dd, buffer_counts[i]);
+  }
+
+  printf("</Block%s>\n", TEST_NAME);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
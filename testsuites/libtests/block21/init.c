@@ -0,0 +1,277 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems.h>
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "BLOCK 21";
+
+#define DISK_PATH "/disk"
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 4096
+
+#define MAX_READ_AHEAD_BLOCKS 32
+
+#define PENDING_MAX 4
+
+#define PASS_COUNT 2
+
+typedef struct {
+  rtems_id timer;
+  rtems_blkdev_request *pending[PENDING_MAX];
+  size_t pending_count;
+  uint32_t transfers;
+} test_context;
+
+static test_context test_instance;
+
+RTEMS_INTERRUPT_LOCK_DEFINE(static, test_lock, "Test")
+
+static void complete_requests(rtems_id timer, void *arg)
+{
+  test_context *ctx = arg;
+  rtems_interrupt_lock_context lock_context;
+  rtems_blkdev_request *pending[PENDING_MAX];
+  size_t pending_count;
+  size_t i;
+
+  rtems_interrupt_lock_acquire(&test_lock, &lock_context);
+  pending_count = ctx->pending_count;
+  memcpy(pending, ctx->pending, pending_count * sizeof(pending[0]));
+  ctx->pending_count = 0;
+  rtems_interrupt_lock_release(&test_lock, &lock_context);
+
+  for (i = 0; i < pending_count; ++i) {
+    rtems_blkdev_request_done(pending[i], RTEMS_SUCCESSFUL);
+  }
+}
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  test_context *ctx = &test_instance;
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_interrupt_lock_context lock_context;
+    rtems_status_code sc;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_sg_buffer *sg = &breq->bufs[i];
+
+      rtems_test_assert(sg->block < BLOCK_COUNT);
+      memset(sg->buffer, (int) sg->block, sg->length);
+    }
+
+    /*
+     * Each request completes with the next clock tick.  This emulates a
+     * device with a high latency per request, for example an SD card.
+     */
+    rtems_interrupt_lock_acquire(&test_lock, &lock_context);
+    rtems_test_assert(ctx->pending_count < PENDING_MAX);
+    ctx->pending[ctx->pending_count] = breq;
+    ++ctx->pending_count;
+    ++ctx->transfers;
+    rtems_interrupt_lock_release(&test_lock, &lock_context);
+
+    sc = rtems_timer_fire_after(ctx->timer, 1, complete_requests, ctx);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void test_sequential_read(
+  test_context *ctx,
+  rtems_disk_device *dd,
+  int pass
+)
+{
+  rtems_blkdev_stats stats;
+  rtems_interval t0;
+  rtems_interval t1;
+  rtems_interval ticks;
+  rtems_blkdev_bnum block;
+
+  rtems_bdbuf_purge_dev(dd);
+  rtems_bdbuf_reset_device_stats(dd);
+  ctx->transfers = 0;
+
+  t0 = rtems_clock_get_ticks_since_boot();
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(bd->buffer[0] == (uint8_t) block);
+
+    sc = rtems_bdbuf_release(bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  t1 = rtems_clock_get_ticks_since_boot();
+  ticks = t1 - t0;
+
+  if (ticks == 0) {
+    ticks = 1;
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+
+  /*
+   * The read-ahead transfers multiple blocks per request, so there are far
+   * less transfer requests than blocks.
+   */
+  rtems_test_assert(stats.read_ahead_transfers > 0);
+  rtems_test_assert(stats.read_ahead_blocks > stats.read_ahead_transfers);
+  rtems_test_assert(ctx->transfers < BLOCK_COUNT / 2);
+
+  printf(
+    "  <SequentialRead pass=\"%i\">\n"
+    "    <Ticks>%" PRIu32 "</Ticks>\n"
+    "    <BlocksPerSecond>%" PRIu64 "</BlocksPerSecond>\n"
+    "    <Transfers>%" PRIu32 "</Transfers>\n"
+    "    <ReadMisses>%" PRIu32 "</ReadMisses>\n"
+    "    <ReadAheadTransfers>%" PRIu32 "</ReadAheadTransfers>\n"
+    "    <ReadAheadBlocks>%" PRIu32 "</ReadAheadBlocks>\n"
+    "    <ReadAheadHits>%" PRIu32 "</ReadAheadHits>\n"
+    "    <ReadAheadMisses>%" PRIu32 "</ReadAheadMisses>\n"
+    "  </SequentialRead>\n",
+    pass,
+    ticks,
+    (uint64_t) BLOCK_COUNT * rtems_clock_get_ticks_per_second() / ticks,
+    ctx->transfers,
+    stats.read_misses,
+    stats.read_ahead_transfers,
+    stats.read_ahead_blocks,
+    stats.read_ahead_hits,
+    stats.read_ahead_misses
+  );
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+  int pass;
+
+  sc = rtems_timer_create(rtems_build_name('D', 'I', 'S', 'K'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  printf(
+    "<Block21 maxReadAheadBlocks=\"%" PRIu32 "\">\n",
+    rtems_bdbuf_configuration.max_read_ahead_blocks
+  );
+
+  for (pass = 0; pass < PASS_COUNT; ++pass) {
+    test_sequential_read(ctx, dd, pass);
+  }
+
+  printf("</Block21>\n");
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE \
+  (4 * MAX_READ_AHEAD_BLOCKS * BLOCK_SIZE)
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS MAX_READ_AHEAD_BLOCKS
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
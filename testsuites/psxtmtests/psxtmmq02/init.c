@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <fcntl.h>
+#include <limits.h>
+#include <timesys.h>
+#include <rtems/btimer.h>
+#include "test_support.h"
+#include <tmacros.h>
+#include <mqueue.h>
+
+const char rtems_test_name[] = "PSXTMMQ 02";
+
+/* forward declarations to avoid warnings */
+void *POSIX_Init(void *argument);
+
+#define OPERATION_COUNT 1000
+
+#define MQ_MSGSIZE    sizeof(int)
+
+#define PRIORITY_COUNT 32
+
+static mqd_t queue;
+
+static int message[OPERATION_COUNT];
+
+static unsigned int priority[OPERATION_COUNT];
+
+static unsigned int message_priority(int i)
+{
+  /*
+   * Use descending priorities, so that each new message has to be enqueued
+   * behind all other pending messages.
+   */
+  return PRIORITY_COUNT - 1 - (unsigned int) (i * PRIORITY_COUNT)
+    / OPERATION_COUNT;
+}
+
+static void benchmark_mq_send(void)
+{
+  benchmark_timer_t end_time;
+  int               status;
+  int               i;
+
+  benchmark_timer_initialize();
+    for (i = 0; i < OPERATION_COUNT; i++) {
+      status = mq_send(
+        queue,
+        (const char *) &i,
+        MQ_MSGSIZE,
+        message_priority(i)
+      );
+    }
+  end_time = benchmark_timer_read();
+  rtems_test_assert(status == 0);
+
+  put_time(
+    "mq_send: 1000 messages pending: descending priority",
+    end_time,
+    OPERATION_COUNT,
+    0,
+    0
+  );
+}
+
+static void benchmark_mq_receive(void)
+{
+  benchmark_timer_t end_time;
+  int               status;
+  int               i;
+
+  benchmark_timer_initialize();
+    for (i = 0; i < OPERATION_COUNT; i++) {
+      status = mq_receive(
+        queue,
+        (char *) &message[i],
+        MQ_MSGSIZE,
+        &priority[i]
+      );
+    }
+  end_time = benchmark_timer_read();
+  rtems_test_assert(status == MQ_MSGSIZE);
+
+  put_time(
+    "mq_receive: 1000 messages pending: descending priority",
+    end_time,
+    OPERATION_COUNT,
+    0,
+    0
+  );
+
+  /* Messages of equal priority are received in FIFO order */
+  for (i = 0; i < OPERATION_COUNT; i++) {
+    rtems_test_assert(message[i] == i);
+    rtems_test_assert(priority[i] == message_priority(i));
+  }
+}
+
+static void test_highest_priority(void)
+{
+  unsigned int prio;
+  int          status;
+  int          i;
+
+  /* The priority MQ_PRIO_MAX is higher than all other priorities */
+  for (i = 0; i < 2; i++) {
+    status = mq_send(
+      queue,
+      (const char *) &i,
+      MQ_MSGSIZE,
+      MQ_PRIO_MAX - 1 + (unsigned int) i
+    );
+    rtems_test_assert(status == 0);
+  }
+
+  for (i = 1; i >= 0; i--) {
+    status = mq_receive(queue, (char *) &message[i], MQ_MSGSIZE, &prio);
+    rtems_test_assert(status == MQ_MSGSIZE);
+    rtems_test_assert(message[i] == i);
+    rtems_test_assert(prio == MQ_PRIO_MAX - 1 + (unsigned int) i);
+  }
+}
+
+void *POSIX_Init(
+  void *argument
+)
+{
+  struct mq_attr attr;
+  int            status;
+
+  TEST_BEGIN();
+
+  attr.mq_maxmsg  = OPERATION_COUNT;
+  attr.mq_msgsize = MQ_MSGSIZE;
+  queue = mq_open("queue", O_CREAT | O_RDWR, 0x777, &attr);
+  rtems_test_assert(queue != (-1));
+
+  benchmark_mq_send();
+  benchmark_mq_receive();
+  test_highest_priority();
+
+  status = mq_close(queue);
+  rtems_test_assert(status == 0);
+
+  status = mq_unlink("queue");
+  rtems_test_assert(status == 0);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS     1
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES  1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(OPERATION_COUNT, MQ_MSGSIZE)
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
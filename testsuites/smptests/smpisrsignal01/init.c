@@ -0,0 +1,467 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/test.h>
+#include <rtems/score/atomic.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPISRSIGNAL 1";
+
+/*
+ * One consumer and up to eight producers.
+ */
+#define CPU_COUNT 9
+
+#define PRODUCER_COUNT (CPU_COUNT - 1)
+
+#define TEST_COUNT 3
+
+typedef struct {
+  Atomic_Uint ready RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES);
+  rtems_counter_ticks send_time;
+  unsigned long sent;
+  uint64_t latency_min;
+  uint64_t latency_max;
+  uint64_t latency_sum;
+  unsigned long latency_count;
+} producer_context;
+
+typedef struct {
+  rtems_test_parallel_context base;
+  rtems_id consumer_id;
+  rtems_id semaphore_id;
+  unsigned long received;
+  producer_context producers[PRODUCER_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_event_set producer_event(size_t producer)
+{
+  return RTEMS_EVENT_0 << producer;
+}
+
+static rtems_event_set all_producer_events(size_t active_workers)
+{
+  return (RTEMS_EVENT_0 << (active_workers - 1)) - 1;
+}
+
+static bool has_no_producers(size_t active_workers)
+{
+  return active_workers == 1;
+}
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  rtems_event_set events;
+  size_t i;
+
+  /* The init handler runs on the consumer */
+  ctx->consumer_id = rtems_task_self();
+  ctx->received = 0;
+
+  (void) rtems_event_receive(
+    RTEMS_ALL_EVENTS,
+    RTEMS_EVENT_ANY | RTEMS_NO_WAIT,
+    0,
+    &events
+  );
+
+  while (
+    rtems_semaphore_obtain(ctx->semaphore_id, RTEMS_NO_WAIT, 0)
+      == RTEMS_SUCCESSFUL
+  ) {
+    /* Drain the semaphore */
+  }
+
+  for (i = 0; i < PRODUCER_COUNT; ++i) {
+    producer_context *producer = &ctx->producers[i];
+
+    _Atomic_Store_uint(&producer->ready, 1, ATOMIC_ORDER_RELAXED);
+    producer->sent = 0;
+    producer->latency_min = UINT64_MAX;
+    producer->latency_max = 0;
+    producer->latency_sum = 0;
+    producer->latency_count = 0;
+  }
+
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_fini(
+  test_context *ctx,
+  const char *name,
+  size_t active_workers,
+  bool latency
+)
+{
+  unsigned long sent = 0;
+  size_t n = active_workers - 1;
+  size_t i;
+
+  printf("  <%s producers=\"%zu\">\n", name, n);
+
+  for (i = 0; i < n; ++i) {
+    const producer_context *producer = &ctx->producers[i];
+
+    rtems_test_assert(producer->sent > 0);
+    sent += producer->sent;
+    printf(
+      "    <Producer index=\"%zu\"><Sent>%lu</Sent>",
+      i,
+      producer->sent
+    );
+
+    if (latency && producer->latency_count > 0) {
+      printf(
+        "<MinLatency unit=\"ns\">%" PRIu64 "</MinLatency>"
+        "<MaxLatency unit=\"ns\">%" PRIu64 "</MaxLatency>"
+        "<MeanLatency unit=\"ns\">%" PRIu64 "</MeanLatency>",
+        producer->latency_min,
+        producer->latency_max,
+        producer->latency_sum / producer->latency_count
+      );
+    }
+
+    printf("</Producer>\n");
+  }
+
+  /* Events of one producer may be merged before the consumer receives them */
+  rtems_test_assert(ctx->received <= sent);
+
+  printf(
+    "    <Sent>%lu</Sent>\n"
+    "    <Received>%lu</Received>\n"
+    "  </%s>\n",
+    sent,
+    ctx->received,
+    name
+  );
+}
+
+/*
+ * The producers signal the consumer with interrupts disabled to use the same
+ * code paths as interrupt service routines.
+ */
+
+static void event_throughput_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  if (rtems_test_parallel_is_master_worker(worker_index)) {
+    if (has_no_producers(active_workers)) {
+      return;
+    }
+
+    rtems_event_set all = all_producer_events(active_workers);
+    unsigned long received = 0;
+
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      rtems_event_set events;
+      rtems_status_code sc;
+
+      sc = rtems_event_receive(all, RTEMS_EVENT_ANY | RTEMS_WAIT, 1, &events);
+      if (sc == RTEMS_SUCCESSFUL) {
+        ++received;
+      }
+    }
+
+    ctx->received = received;
+  } else {
+    size_t i = worker_index - 1;
+    producer_context *producer = &ctx->producers[i];
+    rtems_event_set event = producer_event(i);
+    rtems_id consumer_id = ctx->consumer_id;
+    unsigned long sent = 0;
+
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      rtems_interrupt_level level;
+
+      rtems_interrupt_local_disable(level);
+      (void) rtems_event_send(consumer_id, event);
+      rtems_interrupt_local_enable(level);
+      ++sent;
+    }
+
+    producer->sent = sent;
+  }
+}
+
+static void event_throughput_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini((test_context *) base, "EventThroughput", active_workers, false);
+}
+
+static void semaphore_throughput_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  rtems_id semaphore_id = ctx->semaphore_id;
+
+  if (rtems_test_parallel_is_master_worker(worker_index)) {
+    if (has_no_producers(active_workers)) {
+      return;
+    }
+
+    unsigned long received = 0;
+
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      rtems_status_code sc;
+
+      sc = rtems_semaphore_obtain(semaphore_id, RTEMS_WAIT, 1);
+      if (sc == RTEMS_SUCCESSFUL) {
+        ++received;
+      }
+    }
+
+    ctx->received = received;
+  } else {
+    producer_context *producer = &ctx->producers[worker_index - 1];
+    unsigned long sent = 0;
+
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      rtems_interrupt_level level;
+
+      rtems_interrupt_local_disable(level);
+      (void) rtems_semaphore_release(semaphore_id);
+      rtems_interrupt_local_enable(level);
+      ++sent;
+    }
+
+    producer->sent = sent;
+  }
+}
+
+static void semaphore_throughput_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini(
+    (test_context *) base,
+    "SemaphoreThroughput",
+    active_workers,
+    false
+  );
+}
+
+static void event_latency_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+
+  if (rtems_test_parallel_is_master_worker(worker_index)) {
+    if (has_no_producers(active_workers)) {
+      return;
+    }
+
+    rtems_event_set all = all_producer_events(active_workers);
+    unsigned long received = 0;
+
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      rtems_event_set events;
+      rtems_counter_ticks now;
+      rtems_status_code sc;
+      size_t i;
+
+      sc = rtems_event_receive(all, RTEMS_EVENT_ANY | RTEMS_WAIT, 1, &events);
+      now = rtems_counter_read();
+
+      if (sc != RTEMS_SUCCESSFUL) {
+        continue;
+      }
+
+      for (i = 0; i < active_workers - 1; ++i) {
+        producer_context *producer = &ctx->producers[i];
+        uint64_t latency;
+
+        if ((events & producer_event(i)) == 0) {
+          continue;
+        }
+
+        latency = rtems_counter_ticks_to_nanoseconds(
+          rtems_counter_difference(now, producer->send_time)
+        );
+
+        if (latency < producer->latency_min) {
+          producer->latency_min = latency;
+        }
+
+        if (latency > producer->latency_max) {
+          producer->latency_max = latency;
+        }
+
+        producer->latency_sum += latency;
+        ++producer->latency_count;
+        ++received;
+        _Atomic_Store_uint(&producer->ready, 1, ATOMIC_ORDER_RELEASE);
+      }
+    }
+
+    ctx->received = received;
+  } else {
+    size_t i = worker_index - 1;
+    producer_context *producer = &ctx->producers[i];
+    rtems_event_set event = producer_event(i);
+    rtems_id consumer_id = ctx->consumer_id;
+    unsigned long sent = 0;
+
+    while (!rtems_test_parallel_stop_job(&ctx->base)) {
+      rtems_interrupt_level level;
+
+      /* Wait until the consumer processed the previous event */
+      if (_Atomic_Load_uint(&producer->ready, ATOMIC_ORDER_ACQUIRE) == 0) {
+        continue;
+      }
+
+      _Atomic_Store_uint(&producer->ready, 0, ATOMIC_ORDER_RELAXED);
+
+      rtems_interrupt_local_disable(level);
+      producer->send_time = rtems_counter_read();
+      (void) rtems_event_send(consumer_id, event);
+      rtems_interrupt_local_enable(level);
+      ++sent;
+    }
+
+    producer->sent = sent;
+  }
+}
+
+static void event_latency_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_fini((test_context *) base, "EventLatency", active_workers, true);
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = event_throughput_body,
+    .fini = event_throughput_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = semaphore_throughput_body,
+    .fini = semaphore_throughput_fini,
+    .cascade = true
+  }, {
+    .init = test_init,
+    .body = event_latency_body,
+    .fini = event_latency_fini,
+    .cascade = true
+  }
+};
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('S', 'I', 'G', 'N'),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->semaphore_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  printf("<SMPISRSignal01>\n");
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</SMPISRSignal01>\n");
+
+  sc = rtems_semaphore_delete(ctx->semaphore_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,257 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/malloc.h>
+#include <rtems/score/protectedheap.h>
+#include <rtems/test.h>
+#include <rtems.h>
+
+#include <stdlib.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPMALLOC 1";
+
+#define TASK_PRIORITY 1
+
+#define CPU_COUNT 32
+
+#define CACHE_DEPTH 32
+
+#define OBJECT_COUNT 8
+
+#define TEST_COUNT 3
+
+typedef struct {
+  rtems_test_parallel_context base;
+  const char *name[TEST_COUNT];
+  unsigned long counter[CPU_COUNT][TEST_COUNT][CPU_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t test_sizes[OBJECT_COUNT] = {
+  24, 64, 64, 128, 200, 512, 1000, 1500
+};
+
+static rtems_interval test_init(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  return rtems_clock_get_ticks_per_second();
+}
+
+static void test_fini(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) arg;
+  unsigned long sum = 0;
+  size_t i;
+
+  printf("  <%s activeWorker=\"%zu\">\n", ctx->name[test], active_workers);
+
+  for (i = 0; i < active_workers; ++i) {
+    unsigned long counter = ctx->counter[active_workers - 1][test][i];
+
+    rtems_test_assert(counter > 0);
+    sum += counter;
+    printf(
+      "    <Counter worker=\"%zu\">%lu</Counter>\n",
+      i,
+      counter
+    );
+  }
+
+  printf(
+    "    <SumOfCounter>%lu</SumOfCounter>\n"
+    "  </%s>\n",
+    sum,
+    ctx->name[test]
+  );
+}
+
+static void test_malloc_free_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) arg;
+  unsigned long counter = 0;
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    void *p;
+
+    p = malloc(64);
+    rtems_test_assert(p != NULL);
+    free(p);
+    ++counter;
+  }
+
+  ctx->counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_malloc_free_mixed_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) arg;
+  unsigned long counter = 0;
+  void *p[OBJECT_COUNT];
+
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    size_t i;
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      p[i] = malloc(test_sizes[i]);
+      rtems_test_assert(p[i] != NULL);
+    }
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      free(p[(i * 3) % OBJECT_COUNT]);
+    }
+
+    counter += OBJECT_COUNT;
+  }
+
+  ctx->counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static void test_heap_allocate_free_body(
+  rtems_test_parallel_context *base,
+  void *arg,
+  size_t active_workers,
+  size_t worker_index
+)
+{
+  test_context *ctx = (test_context *) base;
+  size_t test = (size_t) arg;
+  unsigned long counter = 0;
+
+  /*
+   * This bypasses the per-processor caches and uses the C program heap
+   * protected by the allocator lock directly.
+   */
+  while (!rtems_test_parallel_stop_job(&ctx->base)) {
+    void *p;
+    bool ok;
+
+    p = _Protected_heap_Allocate(RTEMS_Malloc_Heap, 64);
+    rtems_test_assert(p != NULL);
+    ok = _Protected_heap_Free(RTEMS_Malloc_Heap, p);
+    rtems_test_assert(ok);
+    ++counter;
+  }
+
+  ctx->counter[active_workers - 1][test][worker_index] = counter;
+}
+
+static const rtems_test_parallel_job test_jobs[TEST_COUNT] = {
+  {
+    .init = test_init,
+    .body = test_heap_allocate_free_body,
+    .fini = test_fini,
+    .cascade = true,
+    .arg = (void *) 0
+  }, {
+    .init = test_init,
+    .body = test_malloc_free_body,
+    .fini = test_fini,
+    .cascade = true,
+    .arg = (void *) 1
+  }, {
+    .init = test_init,
+    .body = test_malloc_free_mixed_body,
+    .fini = test_fini,
+    .cascade = true,
+    .arg = (void *) 2
+  }
+};
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  const char *test = "SMPMalloc01";
+
+  ctx->name[0] = "HeapAllocateFree";
+  ctx->name[1] = "MallocFree";
+  ctx->name[2] = "MallocFreeMixed";
+
+  rtems_test_assert(_Malloc_Cache_depth == CACHE_DEPTH);
+  printf("<%s cacheDepth=\"%" PRIu32 "\">\n", test, _Malloc_Cache_depth);
+  rtems_test_parallel(&ctx->base, NULL, &test_jobs[0], TEST_COUNT);
+  printf("</%s>\n", test);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE_DEPTH CACHE_DEPTH
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
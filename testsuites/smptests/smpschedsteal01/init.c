@@ -0,0 +1,275 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPSCHEDSTEAL 1";
+
+#define CPU_COUNT 4
+
+#define SCHEDULER_COUNT 2
+
+#define TASKS_PER_CPU 2
+
+#define SWITCHES 10000
+
+#define SCHED_MAIN rtems_build_name('M', 'A', 'I', 'N')
+
+#define SCHED_STEAL rtems_build_name('S', 'T', 'E', 'A')
+
+#define SCHED_PRIO rtems_build_name('P', 'R', 'I', 'O')
+
+typedef struct {
+  rtems_name name;
+  rtems_id scheduler_id;
+} test_scheduler;
+
+typedef struct {
+  rtems_id main_scheduler_id;
+  rtems_id done_id;
+  rtems_id task_ids[TASKS_PER_CPU * CPU_COUNT];
+  test_scheduler schedulers[SCHEDULER_COUNT];
+} test_context;
+
+static test_context test_instance = {
+  .schedulers = {
+    { .name = SCHED_STEAL },
+    { .name = SCHED_PRIO }
+  }
+};
+
+static void switch_task(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+  uint32_t i;
+
+  ctx = (test_context *) arg;
+
+  for (i = 0; i < SWITCHES; ++i) {
+    rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+  }
+
+  sc = rtems_semaphore_release(ctx->done_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  while (true) {
+    rtems_task_suspend(RTEMS_SELF);
+  }
+}
+
+static void move_processor(uint32_t cpu_index, rtems_id scheduler_id)
+{
+  rtems_status_code sc;
+  rtems_id current_id;
+
+  sc = rtems_scheduler_ident_by_processor(cpu_index, &current_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  if (current_id != scheduler_id) {
+    sc = rtems_scheduler_remove_processor(current_id, cpu_index);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_scheduler_add_processor(scheduler_id, cpu_index);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * Assigns the processors one up to and including the worker processor count
+ * to the scheduler instance under test and all other processors to the
+ * scheduler instance of the Init task.
+ */
+static void set_processors(
+  test_context *ctx,
+  const test_scheduler *s,
+  uint32_t cpu_max,
+  uint32_t worker_cpus
+)
+{
+  uint32_t cpu_index;
+
+  for (cpu_index = 1; cpu_index < cpu_max; ++cpu_index) {
+    if (cpu_index <= worker_cpus) {
+      move_processor(cpu_index, s->scheduler_id);
+    } else {
+      move_processor(cpu_index, ctx->main_scheduler_id);
+    }
+  }
+}
+
+/*
+ * Each worker processor carries out TASKS_PER_CPU * SWITCHES task switches
+ * concurrently to the other worker processors.  The operations of all worker
+ * processors are serialized by the scheduler instance lock.
+ */
+static void do_task_switches(
+  test_context *ctx,
+  const test_scheduler *s,
+  uint32_t worker_cpus
+)
+{
+  rtems_status_code sc;
+  uint32_t task_count;
+  uint32_t i;
+
+  task_count = TASKS_PER_CPU * worker_cpus;
+
+  for (i = 0; i < task_count; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('S', 'W', 'I', 'T'),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->task_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_scheduler(ctx->task_ids[i], s->scheduler_id, 2);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < task_count; ++i) {
+    sc = rtems_task_start(
+      ctx->task_ids[i],
+      switch_task,
+      (rtems_task_argument) ctx
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < task_count; ++i) {
+    sc = rtems_semaphore_obtain(ctx->done_id, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < task_count; ++i) {
+    sc = rtems_task_delete(ctx->task_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test(test_context *ctx, uint32_t cpu_max)
+{
+  rtems_status_code sc;
+  uint32_t worker_cpus;
+  size_t i;
+
+  sc = rtems_scheduler_ident(SCHED_MAIN, &ctx->main_scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('D', 'O', 'N', 'E'),
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &ctx->done_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    test_scheduler *s;
+
+    s = &ctx->schedulers[i];
+    sc = rtems_scheduler_ident(s->name, &s->scheduler_id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    for (worker_cpus = 1; worker_cpus < cpu_max; ++worker_cpus) {
+      set_processors(ctx, s, cpu_max, worker_cpus);
+      do_task_switches(ctx, s, worker_cpus);
+    }
+  }
+
+  sc = rtems_semaphore_delete(ctx->done_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  uint32_t cpu_max;
+
+  TEST_BEGIN();
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  if (cpu_max >= 2) {
+    test(&test_instance, cpu_max);
+  } else {
+    puts("warning: not enough processors to run the test");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + TASKS_PER_CPU * CPU_COUNT)
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+#define CONFIGURE_SCHEDULER_PRIORITY_STEALING_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_PRIORITY_SMP(a, 256);
+
+RTEMS_SCHEDULER_PRIORITY_STEALING_SMP(b, 256);
+
+RTEMS_SCHEDULER_PRIORITY_SMP(c, 256);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(a, SCHED_MAIN), \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_STEALING_SMP(b, SCHED_STEAL), \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(c, SCHED_PRIO)
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,286 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPSTRONGAPA 3";
+
+#define CPU_COUNT 4
+
+#define SCHEDULER_COUNT 2
+
+#define TASK_COUNT 8
+
+#define SAMPLES 1000
+
+#define SCHED_APA rtems_build_name('A', 'P', 'A', ' ')
+
+#define SCHED_PRIO rtems_build_name('P', 'R', 'I', 'O')
+
+typedef struct {
+  rtems_name name;
+  uint32_t first_cpu;
+  rtems_id scheduler_id;
+  rtems_id task_ids[TASK_COUNT];
+  uint64_t min;
+  uint64_t max;
+  uint64_t total;
+} test_scheduler;
+
+typedef struct {
+  test_scheduler schedulers[SCHEDULER_COUNT];
+} test_context;
+
+static test_context test_instance = {
+  .schedulers = {
+    { .name = SCHED_APA, .first_cpu = 0 },
+    { .name = SCHED_PRIO, .first_cpu = 2 }
+  }
+};
+
+static void do_nothing_task(rtems_task_argument arg)
+{
+  (void) arg;
+
+  while (true) {
+    /* Do nothing */
+  }
+}
+
+static void set_affinity(rtems_id id, uint32_t cpu_index, bool both)
+{
+  rtems_status_code sc;
+  cpu_set_t cpu_set;
+
+  CPU_ZERO(&cpu_set);
+  CPU_SET((int) cpu_index + 1, &cpu_set);
+
+  if (both) {
+    CPU_SET((int) cpu_index, &cpu_set);
+  }
+
+  sc = rtems_task_set_affinity(id, sizeof(cpu_set), &cpu_set);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void create_tasks(test_scheduler *s)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  sc = rtems_scheduler_ident(s->name, &s->scheduler_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      2 + i,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &s->task_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_scheduler(s->task_ids[i], s->scheduler_id, 2 + i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    /*
+     * Every second task may only use the second processor of the scheduler
+     * instance.  The Deterministic Priority SMP scheduler ignores this.
+     */
+    set_affinity(s->task_ids[i], s->first_cpu, (i % 2) == 0);
+
+    sc = rtems_task_start(s->task_ids[i], do_nothing_task, 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_suspend(s->task_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void delete_tasks(test_scheduler *s)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < TASK_COUNT; ++i) {
+    sc = rtems_task_delete(s->task_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void measure(test_scheduler *s)
+{
+  rtems_status_code sc;
+  size_t sample;
+
+  /* Carry out the scheduler operations in the scheduler instance under test */
+  sc = rtems_task_set_scheduler(RTEMS_SELF, s->scheduler_id, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  s->min = UINT64_MAX;
+  s->max = 0;
+  s->total = 0;
+
+  for (sample = 0; sample < SAMPLES; ++sample) {
+    rtems_counter_ticks t0;
+    rtems_counter_ticks d;
+    uint64_t ns;
+    size_t i;
+
+    t0 = rtems_counter_read();
+
+    for (i = 0; i < TASK_COUNT; ++i) {
+      sc = rtems_task_resume(s->task_ids[i]);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    for (i = 0; i < TASK_COUNT; ++i) {
+      sc = rtems_task_suspend(s->task_ids[i]);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    d = rtems_counter_difference(rtems_counter_read(), t0);
+    ns = rtems_counter_ticks_to_nanoseconds(d) / (2 * TASK_COUNT);
+
+    if (ns < s->min) {
+      s->min = ns;
+    }
+
+    if (ns > s->max) {
+      s->max = ns;
+    }
+
+    s->total += ns;
+  }
+
+  rtems_test_assert(s->min <= s->max);
+}
+
+static void test(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    create_tasks(&ctx->schedulers[i]);
+  }
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    measure(&ctx->schedulers[i]);
+  }
+
+  printf(
+    "<SMPStrongAPA3 tasks=\"%i\" samples=\"%i\">\n",
+    TASK_COUNT,
+    SAMPLES
+  );
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    const test_scheduler *s;
+    char name[5];
+
+    s = &ctx->schedulers[i];
+    rtems_name_to_characters(s->name, &name[0], &name[1], &name[2], &name[3]);
+    name[4] = '\0';
+    printf(
+      "  <Scheduler name=\"%s\">\n"
+      "    <Min unit=\"ns\">%" PRIu64 "</Min>\n"
+      "    <Avg unit=\"ns\">%" PRIu64 "</Avg>\n"
+      "    <Max unit=\"ns\">%" PRIu64 "</Max>\n"
+      "  </Scheduler>\n",
+      name,
+      s->min,
+      s->total / SAMPLES,
+      s->max
+    );
+  }
+
+  printf("</SMPStrongAPA3>\n");
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    delete_tasks(&ctx->schedulers[i]);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_scheduler_get_processor_maximum() == CPU_COUNT) {
+    test(&test_instance);
+  } else {
+    puts("warning: wrong processor count to run the test");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + SCHEDULER_COUNT * TASK_COUNT)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_SCHEDULER_STRONG_APA
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_STRONG_APA(a, 256);
+
+RTEMS_SCHEDULER_PRIORITY_SMP(b, 256);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_STRONG_APA(a, SCHED_APA), \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(b, SCHED_PRIO)
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL), \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
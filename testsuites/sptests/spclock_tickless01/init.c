@@ -0,0 +1,181 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/clockdrv.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SPCLOCK TICKLESS 1";
+
+#define IDLE_TICKS 100
+
+#define TIMER_TICKS 50
+
+#define EVENT RTEMS_EVENT_0
+
+typedef struct {
+  rtems_id task;
+  rtems_id timer;
+  uint32_t isrs;
+  rtems_interval ticks;
+} test_context;
+
+static test_context test_instance;
+
+static void start(test_context *ctx)
+{
+  ctx->isrs = Clock_driver_ticks;
+  ctx->ticks = rtems_clock_get_ticks_since_boot();
+}
+
+static void stop(test_context *ctx, rtems_interval expected)
+{
+  uint32_t isrs;
+  rtems_interval ticks;
+
+  isrs = Clock_driver_ticks - ctx->isrs;
+  ticks = rtems_clock_get_ticks_since_boot() - ctx->ticks;
+
+  rtems_test_assert(ticks >= expected);
+  rtems_test_assert(ticks <= expected + 1);
+
+#if CLOCK_DRIVER_USE_TICKLESS_IDLE && !defined(RTEMS_SMP)
+  rtems_test_assert(isrs <= 2);
+#endif
+}
+
+static void timer(rtems_id id, void *arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  ctx = arg;
+  sc = rtems_event_send(ctx->task, EVENT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_wake_after(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  start(ctx);
+  sc = rtems_task_wake_after(IDLE_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  stop(ctx, IDLE_TICKS);
+}
+
+static void test_timer(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  start(ctx);
+  sc = rtems_timer_fire_after(ctx->timer, TIMER_TICKS, timer, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  events = 0;
+  sc = rtems_event_receive(EVENT, RTEMS_WAIT, 2 * TIMER_TICKS, &events);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(events == EVENT);
+  stop(ctx, TIMER_TICKS);
+}
+
+static void test_uptime(test_context *ctx)
+{
+  rtems_status_code sc;
+  struct timespec a;
+  struct timespec b;
+  rtems_interval ticks;
+  uint64_t ns;
+  uint64_t ns_per_tick;
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_clock_get_uptime(&a);
+  ticks = rtems_clock_get_ticks_since_boot();
+  sc = rtems_task_wake_after(IDLE_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  ticks = rtems_clock_get_ticks_since_boot() - ticks;
+  rtems_clock_get_uptime(&b);
+
+  ns = (uint64_t) (b.tv_sec - a.tv_sec) * 1000000000
+    + (uint64_t) b.tv_nsec - (uint64_t) a.tv_nsec;
+  ns_per_tick = 1000ULL * rtems_configuration_get_microseconds_per_tick();
+
+  rtems_test_assert(ns + ns_per_tick >= ticks * ns_per_tick);
+  rtems_test_assert(ns <= (ticks + 1) * ns_per_tick);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx;
+  rtems_status_code sc;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  ctx->task = rtems_task_self();
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_wake_after(ctx);
+  test_timer(ctx);
+  test_uptime(ctx);
+
+  sc = rtems_timer_delete(ctx->timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -125,12 +125,87 @@ static void test_report_xml(void)
   printf("characters produced by rtems_profiling_report_xml(): %i\n", rv);
 }
 
+typedef struct {
+  rtems_id id;
+  uint64_t block_count;
+  uint64_t max_wait_time;
+  uint64_t total_wait_time;
+} contention_context;
+
+static void contention_visitor(void *arg, const rtems_profiling_data *data)
+{
+  contention_context *ctx = arg;
+
+  if (data->header.type == RTEMS_PROFILING_THREAD_QUEUE) {
+    const rtems_profiling_thread_queue *ptq = &data->thread_queue;
+
+    if (ptq->id == ctx->id) {
+      rtems_test_assert(strcmp(ptq->name, "CONT") == 0);
+      rtems_test_assert(ptq->max_wait_owner == 0);
+      ctx->block_count = ptq->block_count;
+      ctx->max_wait_time = ptq->max_wait_time;
+      ctx->total_wait_time = ptq->total_wait_time;
+    }
+  }
+}
+
+static void test_contention(void)
+{
+  contention_context ctx_instance;
+  contention_context *ctx = &ctx_instance;
+  rtems_status_code sc;
+  int rv;
+  int i;
+
+  memset(ctx, 0, sizeof(*ctx));
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('C', 'O', 'N', 'T'),
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &ctx->id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < 2; ++i) {
+    sc = rtems_semaphore_obtain(ctx->id, RTEMS_WAIT, 2);
+    rtems_test_assert(sc == RTEMS_TIMEOUT);
+  }
+
+  rtems_profiling_iterate(contention_visitor, ctx);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(ctx->block_count == 2);
+  rtems_test_assert(ctx->max_wait_time > 0);
+  rtems_test_assert(ctx->total_wait_time >= ctx->max_wait_time);
+#else
+  rtems_test_assert(ctx->block_count == 0);
+#endif
+
+  rv = rtems_profiling_report_contention_xml(
+    "X",
+    &rtems_test_printer,
+    1,
+    "  ",
+    1
+  );
+  printf(
+    "characters produced by rtems_profiling_report_contention_xml(): %i\n",
+    rv
+  );
+
+  sc = rtems_semaphore_delete(ctx->id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
 static void Init(rtems_task_argument arg)
 {
   TEST_BEGIN();
 
   test_iterate();
   test_report_xml();
+  test_contention();
 
   TEST_END();
 
@@ -142,6 +217,8 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_MAXIMUM_TASKS 1
 
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
 #define CONFIGURE_RTEMS_INIT_TASKS_TABLE
 
 #define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
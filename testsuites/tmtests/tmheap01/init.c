@@ -0,0 +1,200 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/heapimpl.h>
+
+const char rtems_test_name[] = "TMHEAP 1";
+
+#define AREA_SIZE (256 * 1024)
+
+#define SLOT_COUNT 1024
+
+#define FRAGMENTATION_STEPS 100000
+
+#define SAMPLE_COUNT 64
+
+typedef struct {
+  Heap_Control heap;
+  void *slots[SLOT_COUNT];
+  uint32_t random;
+  char area[AREA_SIZE] RTEMS_ALIGNED(CPU_HEAP_ALIGNMENT);
+} test_context;
+
+static test_context test_instances[2];
+
+static const uintptr_t alloc_sizes[] = { 16, 64, 256, 1024, 4096 };
+
+static uint32_t next_random(test_context *ctx)
+{
+  ctx->random = ctx->random * 1103515245 + 12345;
+
+  return ctx->random >> 8;
+}
+
+static uintptr_t random_size(test_context *ctx)
+{
+  uint32_t r = next_random(ctx);
+
+  if ((r & 0xf) == 0) {
+    return (r >> 4) % 4096;
+  }
+
+  return (r >> 4) % 256;
+}
+
+static void fragment(test_context *ctx)
+{
+  size_t i;
+
+  for (i = 0; i < FRAGMENTATION_STEPS; ++i) {
+    size_t j = next_random(ctx) % SLOT_COUNT;
+
+    if (ctx->slots[j] != NULL) {
+      bool ok = _Heap_Free(&ctx->heap, ctx->slots[j]);
+      rtems_test_assert(ok);
+      ctx->slots[j] = NULL;
+    } else {
+      ctx->slots[j] = _Heap_Allocate(&ctx->heap, random_size(ctx));
+    }
+  }
+
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+}
+
+static void measure(test_context *ctx, uintptr_t alloc_size)
+{
+  rtems_counter_ticks max = 0;
+  size_t i;
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    rtems_interrupt_level level;
+    rtems_counter_ticks a;
+    rtems_counter_ticks b;
+    rtems_counter_ticks d;
+    void *p;
+    bool ok;
+
+    rtems_interrupt_local_disable(level);
+    a = rtems_counter_read();
+    p = _Heap_Allocate(&ctx->heap, alloc_size);
+    b = rtems_counter_read();
+    rtems_interrupt_local_enable(level);
+
+    rtems_test_assert(p != NULL);
+    ok = _Heap_Free(&ctx->heap, p);
+    rtems_test_assert(ok);
+
+    d = rtems_counter_difference(b, a);
+    if (d > max) {
+      max = d;
+    }
+  }
+
+  printf(
+    "    <WorstCase allocSize=\"%" PRIuPTR "\" unit=\"ns\">%" PRIu64
+      "</WorstCase>\n",
+    alloc_size,
+    rtems_counter_ticks_to_nanoseconds(max)
+  );
+}
+
+static void test_heap(test_context *ctx, const char *name, bool index)
+{
+  uintptr_t size;
+  size_t i;
+
+  ctx->random = 1;
+  size = _Heap_Initialize(&ctx->heap, ctx->area, sizeof(ctx->area), 0);
+  rtems_test_assert(size > 0);
+
+  if (index) {
+    bool ok = _Heap_Free_index_enable(&ctx->heap);
+    rtems_test_assert(ok);
+  }
+
+  fragment(ctx);
+
+  printf(
+    "  <Heap name=\"%s\" freeBlocks=\"%" PRIu32 "\" maxSearch=\"%" PRIu32
+      "\">\n",
+    name,
+    ctx->heap.stats.free_blocks,
+    ctx->heap.stats.max_search
+  );
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(alloc_sizes); ++i) {
+    measure(ctx, alloc_sizes[i]);
+  }
+
+  rtems_test_assert(_Heap_Walk(&ctx->heap, 0, false));
+
+  printf("  </Heap>\n");
+}
+
+static void test(void)
+{
+  printf("<TMHeap01>\n");
+  test_heap(&test_instances[0], "FirstFit", false);
+  test_heap(&test_instances[1], "SegregatedFit", true);
+  printf("</TMHeap01>\n");
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MALLOC_SEGREGATED_FIT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,346 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+const char rtems_test_name[] = "TMMSGQ 1";
+
+#define MAX_MESSAGE_SIZE 4096
+
+#define MAX_MESSAGES 4
+
+#define SAMPLES 1000
+
+typedef struct {
+  rtems_id queue;
+  rtems_id worker;
+  void *worker_buffer;
+  size_t worker_size;
+  rtems_status_code worker_status;
+  uint8_t source[MAX_MESSAGE_SIZE];
+  uint8_t destination[MAX_MESSAGE_SIZE];
+} test_context;
+
+static test_context test_instance;
+
+static const size_t message_sizes[] = { 16, 64, 256, 1024, 2048, 4096 };
+
+static uint64_t elapsed_ns(rtems_counter_ticks t0)
+{
+  rtems_counter_ticks d;
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  return rtems_counter_ticks_to_nanoseconds(d);
+}
+
+static void worker(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    ctx->worker_status = rtems_message_queue_receive_borrow(
+      ctx->queue,
+      &ctx->worker_buffer,
+      &ctx->worker_size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_task_suspend(RTEMS_SELF);
+  }
+}
+
+static void test_zero_copy(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffers[MAX_MESSAGES + 1];
+  void *buffer;
+  size_t size;
+  size_t i;
+
+  sc = rtems_message_queue_receive_borrow(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_message_queue_receive_borrow(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_WAIT,
+    1
+  );
+  rtems_test_assert(sc == RTEMS_TIMEOUT);
+
+  for (i = 0; i < MAX_MESSAGES; ++i) {
+    sc = rtems_message_queue_reserve(ctx->queue, &buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_message_queue_reserve(ctx->queue, &buffers[MAX_MESSAGES]);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  sc = rtems_message_queue_send(ctx->queue, ctx->source, 1);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  sc = rtems_message_queue_commit(
+    ctx->queue,
+    buffers[0],
+    MAX_MESSAGE_SIZE + 1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  sc = rtems_message_queue_commit(ctx->queue, ctx->source, 1);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_release(
+    ctx->queue,
+    (uint8_t *) buffers[0] + 1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  /* A commit without a waiting task queues the buffer itself */
+  memcpy(buffers[0], "abc", 3);
+  sc = rtems_message_queue_commit(ctx->queue, buffers[0], 3);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_receive_borrow(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(buffer == buffers[0]);
+  rtems_test_assert(size == 3);
+  rtems_test_assert(memcmp(buffer, "abc", 3) == 0);
+
+  /* A commit to a waiting borrower hands over the buffer */
+  sc = rtems_task_start(ctx->worker, worker, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_commit(ctx->queue, buffers[1], 5);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->worker_status == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->worker_buffer == buffers[1]);
+  rtems_test_assert(ctx->worker_size == 5);
+
+  /* A send to a waiting borrower uses a free buffer */
+  sc = rtems_message_queue_release(ctx->queue, buffers[0]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_resume(ctx->worker);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_send(ctx->queue, "xy", 2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->worker_status == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->worker_size == 2);
+  rtems_test_assert(memcmp(ctx->worker_buffer, "xy", 2) == 0);
+
+  sc = rtems_message_queue_release(ctx->queue, ctx->worker_buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_release(ctx->queue, buffers[1]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 2; i < MAX_MESSAGES; ++i) {
+    sc = rtems_message_queue_release(ctx->queue, buffers[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_task_delete(ctx->worker);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static uint64_t measure_copy(test_context *ctx, size_t message_size)
+{
+  rtems_counter_ticks t0;
+  rtems_status_code sc;
+  size_t size;
+  size_t i;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < SAMPLES; ++i) {
+    memset(ctx->source, (int) i, message_size);
+    sc = rtems_message_queue_send(ctx->queue, ctx->source, message_size);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_message_queue_receive(
+      ctx->queue,
+      ctx->destination,
+      &size,
+      RTEMS_NO_WAIT,
+      0
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(size == message_size);
+    rtems_test_assert(ctx->destination[0] == (uint8_t) i);
+    rtems_test_assert(ctx->destination[message_size - 1] == (uint8_t) i);
+  }
+
+  return elapsed_ns(t0) / SAMPLES;
+}
+
+static uint64_t measure_zero_copy(test_context *ctx, size_t message_size)
+{
+  rtems_counter_ticks t0;
+  rtems_status_code sc;
+  void *buffer;
+  size_t size;
+  size_t i;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < SAMPLES; ++i) {
+    sc = rtems_message_queue_reserve(ctx->queue, &buffer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    memset(buffer, (int) i, message_size);
+    sc = rtems_message_queue_commit(ctx->queue, buffer, message_size);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_message_queue_receive_borrow(
+      ctx->queue,
+      &buffer,
+      &size,
+      RTEMS_NO_WAIT,
+      0
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(size == message_size);
+    rtems_test_assert(((uint8_t *) buffer)[0] == (uint8_t) i);
+    rtems_test_assert(((uint8_t *) buffer)[message_size - 1] == (uint8_t) i);
+
+    sc = rtems_message_queue_release(ctx->queue, buffer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  return elapsed_ns(t0) / SAMPLES;
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+  size_t i;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('M', 'S', 'G', 'Q'),
+    MAX_MESSAGES,
+    MAX_MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_zero_copy(ctx);
+
+  printf("<TMMsgQ01 samples=\"%i\">\n", SAMPLES);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(message_sizes); ++i) {
+    size_t message_size;
+    uint64_t copy_ns;
+    uint64_t zero_copy_ns;
+
+    message_size = message_sizes[i];
+    copy_ns = measure_copy(ctx, message_size);
+    zero_copy_ns = measure_zero_copy(ctx, message_size);
+
+    printf(
+      "  <Sample>\n"
+      "    <MessageSize>%zu</MessageSize>\n"
+      "    <Copy unit=\"ns\">%" PRIu64 "</Copy>\n"
+      "    <ZeroCopy unit=\"ns\">%" PRIu64 "</ZeroCopy>\n"
+      "  </Sample>\n",
+      message_size,
+      copy_ns,
+      zero_copy_ns
+    );
+  }
+
+  printf("</TMMsgQ01>\n");
+
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MAX_MESSAGES, MAX_MESSAGE_SIZE)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,267 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <semaphore.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+
+#include "tmacros.h"
+
+#ifndef TEST_NAME
+#define TEST_NAME "1"
+#define TEST_INDEX "Linear"
+#endif
+
+const char rtems_test_name[] = "TMSEMIDENT " TEST_NAME;
+
+#define SEMAPHORE_COUNT 4096
+
+#define SAMPLES 100
+
+typedef struct {
+  rtems_id ids[SEMAPHORE_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static rtems_name semaphore_name(size_t i)
+{
+  static const char hex[] = "0123456789ABCDEF";
+
+  return rtems_build_name(
+    'S',
+    hex[(i >> 8) & 0xf],
+    hex[(i >> 4) & 0xf],
+    hex[i & 0xf]
+  );
+}
+
+static uint64_t measure_ident(
+  rtems_name name,
+  rtems_status_code expected_sc,
+  rtems_id expected_id
+)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  rtems_status_code sc;
+  rtems_id id;
+  int i;
+
+  t0 = rtems_counter_read();
+
+  for (i = 0; i < SAMPLES; ++i) {
+    sc = rtems_semaphore_ident(name, RTEMS_SEARCH_LOCAL_NODE, &id);
+    rtems_test_assert(sc == expected_sc);
+  }
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+
+  if (sc == RTEMS_SUCCESSFUL) {
+    rtems_test_assert(id == expected_id);
+  }
+
+  return rtems_counter_ticks_to_nanoseconds(d) / SAMPLES;
+}
+
+static void test_create(test_context *ctx)
+{
+  rtems_status_code sc;
+  size_t i;
+
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    sc = rtems_semaphore_create(
+      semaphore_name(i),
+      0,
+      RTEMS_COUNTING_SEMAPHORE,
+      0,
+      &ctx->ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  for (i = 0; i < SEMAPHORE_COUNT; ++i) {
+    rtems_id id;
+
+    sc = rtems_semaphore_ident(semaphore_name(i), RTEMS_SEARCH_LOCAL_NODE, &id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(id == ctx->ids[i]);
+  }
+}
+
+static void test_rename_and_delete(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_name name;
+  rtems_id id;
+  size_t i;
+
+  /* The lookup of duplicate names returns the object with the lowest index */
+  i = SEMAPHORE_COUNT / 2;
+  sc = rtems_object_set_name(ctx->ids[i + 1], "S000");
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_ident(semaphore_name(0), RTEMS_SEARCH_LOCAL_NODE, &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == ctx->ids[0]);
+
+  sc = rtems_semaphore_ident(
+    semaphore_name(i + 1),
+    RTEMS_SEARCH_LOCAL_NODE,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+
+  sc = rtems_semaphore_delete(ctx->ids[0]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_ident(semaphore_name(0), RTEMS_SEARCH_LOCAL_NODE, &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(id == ctx->ids[i + 1]);
+
+  sc = rtems_semaphore_delete(ctx->ids[i + 1]);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_semaphore_ident(semaphore_name(0), RTEMS_SEARCH_LOCAL_NODE, &id);
+  rtems_test_assert(sc == RTEMS_INVALID_NAME);
+
+  for (i = 1; i < SEMAPHORE_COUNT; ++i) {
+    if (i == SEMAPHORE_COUNT / 2 + 1) {
+      continue;
+    }
+
+    name = semaphore_name(i);
+    sc = rtems_semaphore_delete(ctx->ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_ident(name, RTEMS_SEARCH_LOCAL_NODE, &id);
+    rtems_test_assert(sc == RTEMS_INVALID_NAME);
+  }
+}
+
+static void test_posix_semaphore(void)
+{
+  sem_t *sem;
+  sem_t *sem2;
+  int rv;
+
+  sem = sem_open("/sem", O_CREAT | O_EXCL, 0777, 1);
+  rtems_test_assert(sem != SEM_FAILED);
+
+  sem2 = sem_open("/sem", 0);
+  rtems_test_assert(sem2 == sem);
+
+  rv = sem_close(sem2);
+  rtems_test_assert(rv == 0);
+
+  rv = sem_unlink("/sem");
+  rtems_test_assert(rv == 0);
+
+  sem2 = sem_open("/sem", 0);
+  rtems_test_assert(sem2 == SEM_FAILED);
+  rtems_test_assert(errno == ENOENT);
+
+  rv = sem_close(sem);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(test_context *ctx)
+{
+  test_create(ctx);
+
+  printf(
+    "<TMSemIdent%s index=\"%s\" semaphores=\"%i\" samples=\"%i\">\n"
+    "  <First unit=\"ns\">%" PRIu64 "</First>\n"
+    "  <Middle unit=\"ns\">%" PRIu64 "</Middle>\n"
+    "  <Last unit=\"ns\">%" PRIu64 "</Last>\n"
+    "  <Missing unit=\"ns\">%" PRIu64 "</Missing>\n"
+    "</TMSemIdent%s>\n",
+    TEST_NAME,
+    TEST_INDEX,
+    SEMAPHORE_COUNT,
+    SAMPLES,
+    measure_ident(semaphore_name(0), RTEMS_SUCCESSFUL, ctx->ids[0]),
+    measure_ident(
+      semaphore_name(SEMAPHORE_COUNT / 2),
+      RTEMS_SUCCESSFUL,
+      ctx->ids[SEMAPHORE_COUNT / 2]
+    ),
+    measure_ident(
+      semaphore_name(SEMAPHORE_COUNT - 1),
+      RTEMS_SUCCESSFUL,
+      ctx->ids[SEMAPHORE_COUNT - 1]
+    ),
+    measure_ident(
+      rtems_build_name('N', 'O', 'N', 'E'),
+      RTEMS_INVALID_NAME,
+      0
+    ),
+    TEST_NAME
+  );
+
+  test_rename_and_delete(ctx);
+  test_posix_semaphore();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test(&test_instance);
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES SEMAPHORE_COUNT
+
+#define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES 1
+
+/* Space for the object name hash indices */
+#define CONFIGURE_MEMORY_OVERHEAD 32
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
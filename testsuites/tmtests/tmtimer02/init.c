@@ -0,0 +1,333 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/score/watchdogimpl.h>
+
+const char rtems_test_name[] = "TMTIMER 2";
+
+#define WATCHDOG_COUNT 4096
+
+#define TICK_COUNT 256
+
+#define INTERVAL 1000
+
+typedef struct {
+  Watchdog_Control Base;
+  Watchdog_Header *header;
+  uint64_t period;
+} test_watchdog;
+
+typedef struct {
+  size_t cache_line_size;
+  size_t data_cache_size;
+  int dummy_value;
+  volatile int *dummy_data;
+  ISR_LOCK_MEMBER(lock)
+  uint64_t now;
+  uint32_t expirations;
+  Watchdog_Header header;
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  Watchdog_Wheel wheel;
+#endif
+  test_watchdog watchdogs[WATCHDOG_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static void prepare_cache(test_context *ctx)
+{
+  volatile int *data = ctx->dummy_data;
+  size_t m = ctx->data_cache_size / sizeof(*data);
+  size_t k = ctx->cache_line_size / sizeof(*data);
+  size_t j = ctx->dummy_value;
+  size_t i;
+
+  for (i = 0; i < m; i += k) {
+    data[i] = i + j;
+  }
+
+  ctx->dummy_value = i + j;
+  rtems_cache_invalidate_entire_instruction();
+}
+
+static void never(Watchdog_Control *w)
+{
+  rtems_test_assert(0);
+}
+
+static void rearm(Watchdog_Control *w)
+{
+  test_watchdog *tw = (test_watchdog *) w;
+
+  ++test_instance.expirations;
+  _Watchdog_Insert(tw->header, w, w->expire + tw->period);
+}
+
+static void tick(test_context *ctx)
+{
+  ISR_lock_Context lock_context;
+  Watchdog_Control *first;
+
+  _ISR_lock_ISR_disable_and_acquire(&ctx->lock, &lock_context);
+  ++ctx->now;
+
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  if (ctx->header.wheel != NULL) {
+    _Watchdog_Tickle_wheel(
+      &ctx->header,
+      ctx->now,
+      &ctx->lock,
+      &lock_context
+    );
+  }
+#endif
+
+  first = _Watchdog_Header_first(&ctx->header);
+
+  if (first != NULL) {
+    _Watchdog_Tickle(
+      &ctx->header,
+      first,
+      ctx->now,
+      &ctx->lock,
+      &lock_context
+    );
+  }
+
+  _ISR_lock_Release_and_ISR_enable(&ctx->lock, &lock_context);
+}
+
+static void arm(
+  test_context *ctx,
+  size_t i,
+  Watchdog_Service_routine_entry routine,
+  uint64_t expire,
+  uint64_t period
+)
+{
+  test_watchdog *tw = &ctx->watchdogs[i];
+
+  _Watchdog_Initialize(&tw->Base, routine);
+  tw->header = &ctx->header;
+  tw->period = period;
+  _Watchdog_Insert(&ctx->header, &tw->Base, expire);
+}
+
+static void disarm_all(test_context *ctx, size_t j)
+{
+  size_t i;
+
+  for (i = 0; i < j; ++i) {
+    _Watchdog_Remove(&ctx->header, &ctx->watchdogs[i].Base);
+  }
+}
+
+static void test_insert_and_remove(
+  test_context *ctx,
+  size_t i,
+  uint64_t delta,
+  const char *name
+)
+{
+  Watchdog_Control *w;
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  rtems_interrupt_level level;
+
+  w = &ctx->watchdogs[i].Base;
+  _Watchdog_Initialize(w, never);
+  prepare_cache(ctx);
+
+  rtems_interrupt_local_disable(level);
+  a = rtems_counter_read();
+  _Watchdog_Insert(&ctx->header, w, ctx->now + delta);
+  _Watchdog_Remove(&ctx->header, w);
+  b = rtems_counter_read();
+  rtems_interrupt_local_enable(level);
+
+  d = rtems_counter_difference(b, a);
+  rtems_test_assert(!_Watchdog_Is_scheduled(w));
+
+  printf(
+    "<%s unit=\"ns\">%" PRIu64 "</%s>",
+    name,
+    rtems_counter_ticks_to_nanoseconds(d),
+    name
+  );
+}
+
+static void test_tick(test_context *ctx, size_t j)
+{
+  rtems_counter_ticks a;
+  rtems_counter_ticks b;
+  rtems_counter_ticks d;
+  size_t i;
+
+  /* Exactly one watchdog expires and is re-armed in each tick */
+  for (i = 0; i < j; ++i) {
+    arm(ctx, i, rearm, ctx->now + i + 1, j);
+  }
+
+  prepare_cache(ctx);
+  ctx->expirations = 0;
+
+  a = rtems_counter_read();
+
+  for (i = 0; i < TICK_COUNT; ++i) {
+    tick(ctx);
+  }
+
+  b = rtems_counter_read();
+  d = rtems_counter_difference(b, a);
+  rtems_test_assert(ctx->expirations == (j > 0 ? TICK_COUNT : 0));
+
+  disarm_all(ctx, j);
+
+  printf(
+    "<Tick unit=\"ns\">%" PRIu64 "</Tick>",
+    rtems_counter_ticks_to_nanoseconds(d) / TICK_COUNT
+  );
+}
+
+static void test_case(test_context *ctx, size_t j)
+{
+  size_t i;
+
+  for (i = 0; i < j; ++i) {
+    arm(ctx, i, never, ctx->now + (i + 1) * INTERVAL, 0);
+  }
+
+  printf("    <Sample>\n      <ActiveWatchdogs>%zu</ActiveWatchdogs>", j);
+
+  test_insert_and_remove(ctx, j, 1, "First");
+  test_insert_and_remove(ctx, j, (j / 2) * INTERVAL + INTERVAL / 2, "Middle");
+  test_insert_and_remove(ctx, j, (j + 1) * INTERVAL, "Last");
+
+  disarm_all(ctx, j);
+
+  test_tick(ctx, j);
+
+  printf("\n    </Sample>\n");
+}
+
+static void test_implementation(test_context *ctx, const char *name)
+{
+  size_t j;
+
+  printf("  <Implementation name=\"%s\">\n", name);
+
+  j = 0;
+
+  while (j < WATCHDOG_COUNT) {
+    test_case(ctx, j);
+    j = (123 * (j + 1) + 99) / 100;
+  }
+
+  test_case(ctx, WATCHDOG_COUNT - 1);
+
+  printf("  </Implementation>\n");
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  size_t i;
+
+  ctx->cache_line_size = rtems_cache_get_data_line_size();
+  if (ctx->cache_line_size == 0) {
+    ctx->cache_line_size = 32;
+  }
+
+  ctx->data_cache_size = rtems_cache_get_data_cache_size(0);
+  if (ctx->data_cache_size == 0) {
+    ctx->data_cache_size = ctx->cache_line_size;
+  }
+
+  ctx->dummy_data = malloc(ctx->data_cache_size);
+  rtems_test_assert(ctx->dummy_data != NULL);
+
+  _ISR_lock_Initialize(&ctx->lock, "Test");
+
+  for (i = 0; i < WATCHDOG_COUNT; ++i) {
+    _Watchdog_Preinitialize(&ctx->watchdogs[i].Base, _Per_CPU_Get_snapshot());
+  }
+
+  printf("<TMTimer02 watchdogCount=\"%i\">\n", WATCHDOG_COUNT);
+
+  ctx->now = 0;
+  _Watchdog_Header_initialize(&ctx->header);
+  test_implementation(ctx, "RBTree");
+  _Watchdog_Header_destroy(&ctx->header);
+
+#if defined(RTEMS_WATCHDOG_WHEEL)
+  ctx->now = 0;
+  _Watchdog_Wheel_initialize(&ctx->header, &ctx->wheel, ctx->now);
+  test_implementation(ctx, "Wheel");
+  _Watchdog_Header_destroy(&ctx->header);
+#endif
+
+  printf("</TMTimer02>\n");
+
+  _ISR_lock_Destroy(&ctx->lock);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 50000
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,241 @@
+/*
+ * SPDX-License-Identifier: BSD-2-Clause
+ *
+ * Copyright (C) 2026 RTEMS Project and contributors
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <rtems.h>
+
+const char rtems_test_name[] = "TMTIMER 3";
+
+#define SAMPLE_COUNT 1000
+
+#define NS_PER_S 1000000000
+
+typedef struct {
+  uint64_t min;
+  uint64_t max;
+  uint64_t sum;
+} test_stats;
+
+static const uint64_t test_periods[] = {
+  10000,
+  100000,
+  1000000
+};
+
+static void to_timespec(uint64_t ns, struct timespec *ts)
+{
+  ts->tv_sec = (time_t) (ns / NS_PER_S);
+  ts->tv_nsec = (long) (ns % NS_PER_S);
+}
+
+static void init_stats(test_stats *stats)
+{
+  stats->min = UINT64_MAX;
+  stats->max = 0;
+  stats->sum = 0;
+}
+
+static void add_sample(test_stats *stats, uint64_t expected)
+{
+  uint64_t now;
+  uint64_t latency;
+
+  now = rtems_clock_get_uptime_nanoseconds();
+  rtems_test_assert(now >= expected);
+  latency = now - expected;
+
+  if (latency < stats->min) {
+    stats->min = latency;
+  }
+
+  if (latency > stats->max) {
+    stats->max = latency;
+  }
+
+  stats->sum += latency;
+}
+
+static void print_stats(
+  const test_stats *stats,
+  const char *method,
+  uint64_t period
+)
+{
+  printf(
+    "  <Sample method=\"%s\" period=\"%" PRIu64 "\">"
+    "<Min unit=\"ns\">%" PRIu64 "</Min>"
+    "<Max unit=\"ns\">%" PRIu64 "</Max>"
+    "<Mean unit=\"ns\">%" PRIu64 "</Mean></Sample>\n",
+    method,
+    period,
+    stats->min,
+    stats->max,
+    stats->sum / SAMPLE_COUNT
+  );
+}
+
+static void test_clock_nanosleep(uint64_t period)
+{
+  test_stats stats;
+  size_t i;
+
+  init_stats(&stats);
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    struct timespec ts;
+    uint64_t expected;
+    int eno;
+
+    expected = rtems_clock_get_uptime_nanoseconds() + period;
+    to_timespec(expected, &ts);
+
+    eno = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    rtems_test_assert(eno == 0);
+
+    add_sample(&stats, expected);
+  }
+
+  print_stats(&stats, "ClockNanosleep", period);
+}
+
+#ifdef RTEMS_POSIX_API
+static void test_timer(timer_t timer, const sigset_t *set, uint64_t period)
+{
+  test_stats stats;
+  size_t i;
+
+  init_stats(&stats);
+
+  for (i = 0; i < SAMPLE_COUNT; ++i) {
+    struct itimerspec its;
+    uint64_t expected;
+    int sig;
+    int rv;
+
+    expected = rtems_clock_get_uptime_nanoseconds() + period;
+    to_timespec(expected, &its.it_value);
+    its.it_interval.tv_sec = 0;
+    its.it_interval.tv_nsec = 0;
+
+    rv = timer_settime(timer, TIMER_ABSTIME, &its, NULL);
+    rtems_test_assert(rv == 0);
+
+    sig = 0;
+    rv = sigwait(set, &sig);
+    rtems_test_assert(rv == 0);
+    rtems_test_assert(sig == SIGALRM);
+
+    add_sample(&stats, expected);
+  }
+
+  print_stats(&stats, "Timer", period);
+}
+#endif
+
+static void test(void)
+{
+  size_t i;
+#ifdef RTEMS_POSIX_API
+  struct sigevent evp;
+  sigset_t set;
+  timer_t timer;
+  int rv;
+
+  sigemptyset(&set);
+  sigaddset(&set, SIGALRM);
+  rv = sigprocmask(SIG_BLOCK, &set, NULL);
+  rtems_test_assert(rv == 0);
+
+  memset(&evp, 0, sizeof(evp));
+  evp.sigev_notify = SIGEV_SIGNAL;
+  evp.sigev_signo = SIGALRM;
+  rv = timer_create(CLOCK_MONOTONIC, &evp, &timer);
+  rtems_test_assert(rv == 0);
+#endif
+
+  printf("<TMTimer03 sampleCount=\"%i\">\n", SAMPLE_COUNT);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(test_periods); ++i) {
+    test_clock_nanosleep(test_periods[i]);
+#ifdef RTEMS_POSIX_API
+    test_timer(timer, &set, test_periods[i]);
+#endif
+  }
+
+  printf("</TMTimer03>\n");
+
+#ifdef RTEMS_POSIX_API
+  rv = timer_delete(timer);
+  rtems_test_assert(rv == 0);
+#endif
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+/*
+ * Use a clock tick interval well above the measured periods, so that the
+ * results show whether the timeouts are driven by a high resolution event
+ * device or only by the clock tick.
+ */
+#define CONFIGURE_MICROSECONDS_PER_TICK 10000
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#ifdef RTEMS_POSIX_API
+#define CONFIGURE_MAXIMUM_POSIX_TIMERS 1
+#endif
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>